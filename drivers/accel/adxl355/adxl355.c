@@ -303,6 +303,7 @@ int adxl355_soft_reset(struct adxl355_dev *dev)
 					GET_ADXL355_TRANSF_LEN(ADXL355_RESET), &data);
 	if (ret)
 		return ret;
+	dev->fifo_set_len = 0;
 
 	// After soft reset, the data in the shadow registers will be valid only after NVM is not busy anymore
 	ret = adxl355_get_sts_reg(dev, &flags);
@@ -704,8 +705,10 @@ int adxl355_set_fifo_samples(struct adxl355_dev *dev, uint8_t reg_value)
 	ret = adxl355_write_device_data(dev, ADXL355_ADDR(ADXL355_FIFO_SAMPLES),
 					GET_ADXL355_TRANSF_LEN(ADXL355_FIFO_SAMPLES), &reg_value);
 
-	if (!ret)
+	if (!ret) {
 		dev->fifo_samples = reg_value;
+		dev->fifo_set_len = 0;
+	}
 
 	return ret;
 }
@@ -754,6 +757,124 @@ int adxl355_get_raw_fifo_data(struct adxl355_dev *dev, uint8_t *fifo_entries,
 	return ret;
 }
 
+/***************************************************************************//**
+ * @brief Reads a burst from the FIFO data register into comm_buff. On SPI the
+ * burst goes through DMA when the platform supports it.
+ *
+ * @param dev  - The device structure.
+ * @param size - Number of bytes to read.
+ * @param data - Start of the data read, inside comm_buff.
+ *
+ * @return ret - Result of the reading procedure.
+*******************************************************************************/
+static int adxl355_read_fifo_burst(struct adxl355_dev *dev, uint16_t size,
+				   uint8_t **data)
+{
+	uint8_t addr = ADXL355_ADDR(ADXL355_FIFO_DATA);
+	struct no_os_spi_msg msg = {
+		.tx_buff = dev->comm_buff,
+		.rx_buff = dev->comm_buff,
+		.bytes_number = size + 1,
+		.cs_change = 1,
+	};
+	int ret;
+
+	if (dev->comm_type == ADXL355_SPI_COMM) {
+		dev->comm_buff[0] = ADXL355_SPI_READ | (addr << 1);
+		ret = no_os_spi_transfer_dma(dev->com_desc.spi_desc, &msg, 1);
+		if (ret == -ENOSYS)
+			ret = no_os_spi_write_and_read(dev->com_desc.spi_desc,
+						       dev->comm_buff, size + 1);
+		*data = &dev->comm_buff[1];
+	} else {
+		ret = no_os_i2c_write(dev->com_desc.i2c_desc, &addr, 1, 0);
+		if (ret)
+			return ret;
+		ret = no_os_i2c_read(dev->com_desc.i2c_desc, dev->comm_buff, size, 1);
+		*data = dev->comm_buff;
+	}
+
+	return ret;
+}
+
+/***************************************************************************//**
+ * @brief Reads a burst of FIFO entries in a single transfer and returns the
+ * complete XYZ sets. The sets are realigned on the X-axis marker: entries of a
+ * set whose X entry was lost are dropped and a set split between two bursts is
+ * completed by the next call.
+ *
+ * @param dev        - The device structure.
+ * @param nb_entries - Number of FIFO entries to read. 0 reads the FIFO
+ *                     watermark, which is available once FIFO_FULL is set.
+ * @param raw_xyz    - Interleaved X, Y, Z raw data, with room for the number
+ *                     of entries read plus 2.
+ * @param nb_sets    - Number of XYZ sets written in raw_xyz.
+ * @param nb_dropped - Number of sets dropped while realigning. Optional.
+ *
+ * @return ret       - Result of the reading procedure.
+*******************************************************************************/
+int adxl355_get_raw_fifo_sets(struct adxl355_dev *dev, uint8_t nb_entries,
+			      uint32_t *raw_xyz, uint8_t *nb_sets,
+			      uint8_t *nb_dropped)
+{
+	bool resync = false;
+	uint8_t dropped = 0;
+	uint8_t sets = 0;
+	uint8_t *entry;
+	uint8_t *data;
+	uint8_t i;
+	int ret;
+
+	if (!dev || !raw_xyz || !nb_sets)
+		return -EINVAL;
+
+	if (!nb_entries)
+		nb_entries = dev->fifo_samples;
+	nb_entries = no_os_min(nb_entries, ADXL355_MAX_FIFO_SAMPLES_VAL);
+
+	ret = adxl355_read_fifo_burst(dev, nb_entries * 3, &data);
+	if (ret)
+		return ret;
+
+	for (i = 0; i < nb_entries; i++) {
+		entry = &data[i * 3];
+
+		// Entries read while the FIFO is empty carry no data
+		if (entry[2] & ADXL355_FIFO_EMPTY_MARKER)
+			continue;
+
+		if (entry[2] & ADXL355_FIFO_X_MARKER) {
+			if (dev->fifo_set_len)
+				dropped++;
+			dev->fifo_set_len = 0;
+			resync = false;
+		} else if (!dev->fifo_set_len) {
+			// Y or Z entry without its X entry
+			if (!resync)
+				dropped++;
+			resync = true;
+			continue;
+		}
+
+		memcpy(&dev->fifo_set[dev->fifo_set_len], entry, 3);
+		dev->fifo_set_len += 3;
+		if (dev->fifo_set_len < sizeof(dev->fifo_set))
+			continue;
+
+		raw_xyz[sets * 3] = adxl355_accel_array_conv(dev, &dev->fifo_set[0]);
+		raw_xyz[sets * 3 + 1] = adxl355_accel_array_conv(dev, &dev->fifo_set[3]);
+		raw_xyz[sets * 3 + 2] = adxl355_accel_array_conv(dev, &dev->fifo_set[6]);
+		sets++;
+		dev->fifo_set_len = 0;
+	}
+
+	*nb_sets = sets;
+	if (nb_dropped)
+		*nb_dropped = dropped;
+
+	return 0;
+}
+
 /***************************************************************************//**
  * @brief Reads fifo data and returns the values converted in m/s^2.
  *
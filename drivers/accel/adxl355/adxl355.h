@@ -78,6 +78,9 @@
 
 #define ADXL355_SHADOW_REGISTER_BASE_ADDR (ADXL355_ADDR(0x50) | SET_ADXL355_TRANSF_LEN(5))
 #define ADXL355_MAX_FIFO_SAMPLES_VAL  0x60
+/* FIFO entry marker bits, in the last byte of each entry */
+#define ADXL355_FIFO_X_MARKER         NO_OS_BIT(0)
+#define ADXL355_FIFO_EMPTY_MARKER     NO_OS_BIT(1)
 #define ADXL355_SELF_TEST_TRIGGER_VAL 0x03
 #define ADXL355_RESET_CODE            0x52
 
@@ -300,6 +303,10 @@ struct adxl355_dev {
 	uint8_t act_cnt;
 	uint16_t act_thr;
 	uint8_t comm_buff[289];
+	/** Entries of a FIFO set split between two bursts */
+	uint8_t fifo_set[9];
+	/** Number of bytes held in fifo_set */
+	uint8_t fifo_set_len;
 };
 
 /*! Init. the comm. peripheral and checks if the ADXL355 part is present. */
@@ -365,6 +372,11 @@ int adxl355_set_fifo_samples(struct adxl355_dev *dev, uint8_t reg_value);
 int adxl355_get_raw_fifo_data(struct adxl355_dev *dev, uint8_t *fifo_entries,
 			      uint32_t *raw_x, uint32_t *raw_y, uint32_t *raw_z);
 
+/*! Reads a FIFO burst and returns the complete XYZ sets. */
+int adxl355_get_raw_fifo_sets(struct adxl355_dev *dev, uint8_t nb_entries,
+			      uint32_t *raw_xyz, uint8_t *nb_sets,
+			      uint8_t *nb_dropped);
+
 /*! Reads fifo data and returns the values converted in g. */
 int adxl355_get_fifo_data(struct adxl355_dev *dev, uint8_t *fifo_entries,
 			  struct adxl355_frac_repr *x, struct adxl355_frac_repr *y,
@@ -44,6 +44,9 @@
 #define ACCEL_AXIS_Y (uint32_t) 1
 #define ACCEL_AXIS_Z (uint32_t) 2
 
+/* FIFO bursts read by a trigger before giving up on releasing the watermark */
+#define ADXL355_IIO_FIFO_MAX_BURSTS 4
+
 static const int adxl355_iio_odr_table[11][2] = {
 	{4000, 0},
 	{2000, 0},
@@ -196,6 +199,7 @@ static struct iio_channel adxl355_channels[] = {
 		.attributes = adxl355_iio_temp_attrs,
 		.ch_out = false,
 	},
+	IIO_CHAN_SOFT_TIMESTAMP(3),
 };
 
 static struct iio_device adxl355_iio_dev = {
@@ -960,6 +964,96 @@ static int adxl355_iio_update_channels(void* dev, uint32_t mask)
 
 	iio_adxl355->no_of_active_channels = counter;
 
+	if (!iio_adxl355->fifo_watermark)
+		return 0;
+
+	return adxl355_set_fifo_samples(iio_adxl355->adxl355_dev,
+					iio_adxl355->fifo_watermark * 3);
+}
+
+/***************************************************************************//**
+ * @brief Packs the active axes of XYZ sets read from the FIFO and writes them
+ * to the buffer. The newest set was sampled when the burst was read and each
+ * older set one output data period before.
+ *
+ * @param dev_data - The iio device data structure.
+ * @param raw_xyz  - Interleaved X, Y, Z raw data.
+ * @param nb_sets  - Number of XYZ sets.
+ *
+ * @return ret     - Result of the pushing procedure.
+*******************************************************************************/
+static int adxl355_iio_push_fifo_sets(struct iio_device_data *dev_data,
+				      uint32_t *raw_xyz, uint8_t nb_sets)
+{
+	struct adxl355_iio_dev *iio_adxl355 = dev_data->dev;
+	uint32_t mask = dev_data->buffer->active_mask;
+	uint64_t period_ns;
+	uint64_t age_ns;
+	uint64_t now;
+	/* Room for the padding before the timestamp of a 3 axis scan */
+	int32_t scan[4] = {0};
+	uint8_t i, j, k;
+	int ret;
+
+	period_ns = 250000ULL << iio_adxl355->adxl355_dev->odr_lpf;
+	now = iio_buffer_get_timestamp(dev_data->buffer);
+
+	for (i = 0; i < nb_sets; i++) {
+		k = 0;
+		for (j = 0; j < 3; j++)
+			if (mask & NO_OS_BIT(j))
+				scan[k++] = no_os_sign_extend32(raw_xyz[i * 3 + j], 19);
+
+		age_ns = (nb_sets - 1 - i) * period_ns;
+		ret = iio_buffer_push_scan_ts(dev_data->buffer, scan,
+					      now > age_ns ? now - age_ns : 0);
+		if (ret)
+			return ret;
+	}
+
+	return 0;
+}
+
+/***************************************************************************//**
+ * @brief Handles the FIFO watermark trigger: reads the FIFO in single bursts
+ * until it drops below the watermark, so that the interrupt line is released.
+ *
+ * @param dev_data  - The iio device data structure.
+ *
+ * @return ret - Result of the handling procedure.
+*******************************************************************************/
+static int32_t adxl355_fifo_trigger_handler(struct iio_device_data *dev_data)
+{
+	struct adxl355_iio_dev *iio_adxl355 = dev_data->dev;
+	struct adxl355_dev *adxl355 = iio_adxl355->adxl355_dev;
+	uint8_t nb_dropped;
+	uint8_t nb_sets;
+	uint8_t entries;
+	uint8_t i;
+	int ret;
+
+	for (i = 0; i < ADXL355_IIO_FIFO_MAX_BURSTS; i++) {
+		ret = adxl355_get_nb_of_fifo_entries(adxl355, &entries);
+		if (ret)
+			return ret;
+
+		if (!entries || (i && entries < adxl355->fifo_samples))
+			return 0;
+
+		ret = adxl355_get_raw_fifo_sets(adxl355, entries,
+						iio_adxl355->fifo_raw,
+						&nb_sets, &nb_dropped);
+		if (ret)
+			return ret;
+
+		iio_buffer_drop_scans(dev_data->buffer, nb_dropped);
+
+		ret = adxl355_iio_push_fifo_sets(dev_data, iio_adxl355->fifo_raw,
+						 nb_sets);
+		if (ret)
+			return ret;
+	}
+
 	return 0;
 }
 
@@ -973,7 +1067,7 @@ static int adxl355_iio_update_channels(void* dev, uint32_t mask)
 *******************************************************************************/
 static int32_t adxl355_trigger_handler(struct iio_device_data *dev_data)
 {
-	int32_t data_buff[3];
+	int32_t data_buff[4] = {0};
 	uint32_t x, y, z;
 	uint8_t i = 0;
 
@@ -990,6 +1084,9 @@ static int32_t adxl355_trigger_handler(struct iio_device_data *dev_data)
 
 	adxl355 = iio_adxl355->adxl355_dev;
 
+	if (iio_adxl355->fifo_watermark)
+		return adxl355_fifo_trigger_handler(dev_data);
+
 	adxl355_get_raw_xyz(adxl355, &x, &y, &z);
 
 	if (dev_data->buffer->active_mask & NO_OS_BIT(0)) {
@@ -1051,6 +1148,21 @@ int adxl355_iio_init(struct adxl355_iio_dev **iio_dev,
 	if (ret)
 		goto error_config;
 
+	if (init_param->fifo_watermark) {
+		if (init_param->fifo_watermark > ADXL355_MAX_FIFO_SAMPLES_VAL / 3) {
+			ret = -EINVAL;
+			goto error_config;
+		}
+
+		ret = adxl355_config_int_pins(desc->adxl355_dev, (union adxl355_int_mask) {
+			.fields.FULL_EN1 = 1
+		});
+		if (ret)
+			goto error_config;
+
+		desc->fifo_watermark = init_param->fifo_watermark;
+	}
+
 	*iio_dev = desc;
 
 	return 0;
@@ -35,6 +35,7 @@
 
 #include "iio.h"
 #include "no_os_irq.h"
+#include "adxl355.h"
 
 extern struct iio_trigger adxl355_iio_trig_desc;
 
@@ -44,10 +45,20 @@ struct adxl355_iio_dev {
 	int adxl355_hpf_3db_table[7][2];
 	uint32_t active_channels;
 	uint8_t no_of_active_channels;
+	/* XYZ sets per FIFO watermark interrupt, 0 for one sample per trigger */
+	uint8_t fifo_watermark;
+	/* Raw data of a FIFO burst */
+	uint32_t fifo_raw[ADXL355_MAX_FIFO_SAMPLES_VAL + 2];
 };
 
 struct adxl355_iio_dev_init_param {
 	struct adxl355_init_param *adxl355_dev_init;
+	/*
+	 * XYZ sets per FIFO watermark interrupt, up to 32. When set, FIFO_FULL
+	 * is routed to INT1, which must drive the trigger, and each trigger
+	 * reads the FIFO in bursts. 0 reads one sample per trigger.
+	 */
+	uint8_t fifo_watermark;
 };
 
 int adxl355_iio_init(struct adxl355_iio_dev **iio_dev,
@@ -35,6 +35,7 @@
 #include <stdlib.h>
 #include <stdbool.h>
 #include <string.h>
+#include <errno.h>
 #include "adxl372.h"
 #include "no_os_alloc.h"
 
@@ -517,6 +518,7 @@ int32_t adxl372_configure_fifo(struct adxl372_dev *dev,
 	dev->fifo_config.fifo_format = format;
 	dev->fifo_config.fifo_mode = mode;
 	dev->fifo_config.fifo_samples = fifo_samples;
+	dev->fifo_set_len = 0;
 
 	return ret;
 }
@@ -607,6 +609,125 @@ int32_t adxl372_get_fifo_xyz_data(struct adxl372_dev *dev,
 	return ret;
 }
 
+/**
+ * Read a burst from the FIFO DATA reg. On SPI the burst goes through DMA when
+ * the platform supports it, with the command sent from the byte before buf.
+ * @param dev - The device structure.
+ * @param buf - Burst data, preceded by one spare byte.
+ * @param count - Number of bytes to read.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+static int32_t adxl372_read_fifo_burst(struct adxl372_dev *dev, uint8_t *buf,
+				       uint16_t count)
+{
+	struct no_os_spi_msg msg = {
+		.tx_buff = buf - 1,
+		.rx_buff = buf - 1,
+		.bytes_number = count + 1,
+		.cs_change = 1,
+	};
+	int32_t ret;
+
+	if (dev->comm_type != SPI)
+		return adxl372_read_reg_multiple(dev, ADXL372_FIFO_DATA, buf, count);
+
+	buf[-1] = ADXL372_REG_READ(ADXL372_FIFO_DATA);
+	memset(buf, 0x00, count);
+
+	ret = no_os_spi_transfer_dma(dev->spi_desc, &msg, 1);
+	if (ret == -ENOSYS)
+		ret = no_os_spi_write_and_read(dev->spi_desc, buf - 1, count + 1);
+
+	return ret;
+}
+
+/**
+ * Read FIFO samples in a single burst and return the complete (x, y, z) sets.
+ * The sets are realigned on the series start marker of the x-axis sample:
+ * samples of a set whose x-axis sample was lost are dropped and a set split
+ * between two bursts is completed by the next call. Only the XYZ FIFO format
+ * is supported.
+ * @param dev - The device structure.
+ * @param samples - Array where the (x, y, z) sets will be stored. The raw burst
+ *		    is read at its end, so it must have room for cnt / 3 + 2
+ *		    sets.
+ * @param cnt - How many samples should be retrieved from the FIFO DATA reg,
+ *		up to ADXL372_FIFO_BURST_MAX. 0 reads the FIFO watermark less
+ *		one set, which must be left in the FIFO after every read.
+ * @param nb_sets - Number of sets stored in samples.
+ * @param nb_dropped - Number of sets dropped while realigning. Optional.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+int32_t adxl372_get_fifo_xyz_sets(struct adxl372_dev *dev,
+				  struct adxl372_xyz_accel_data *samples,
+				  uint16_t cnt,
+				  uint16_t *nb_sets,
+				  uint16_t *nb_dropped)
+{
+	uint16_t dropped = 0;
+	uint16_t sets = 0;
+	bool resync = false;
+	uint8_t *buf;
+	uint8_t *set;
+	uint16_t i;
+	int32_t ret;
+
+	if (!dev || !samples || !nb_sets ||
+	    dev->fifo_config.fifo_format != ADXL372_XYZ_FIFO)
+		return -EINVAL;
+
+	if (!cnt) {
+		if (dev->fifo_config.fifo_samples <= 3)
+			return -EINVAL;
+		cnt = dev->fifo_config.fifo_samples - 3;
+	}
+	cnt = no_os_min(cnt, ADXL372_FIFO_BURST_MAX);
+
+	/*
+	 * Sets are written at the start of samples while the burst is parsed
+	 * from its end. A set is written only once its 3 samples were copied
+	 * out, so the output never overtakes the unparsed data. The byte before
+	 * the burst holds the SPI command.
+	 */
+	buf = (uint8_t *)&samples[cnt / 3 + 2] - cnt * 2;
+	ret = adxl372_read_fifo_burst(dev, buf, cnt * 2);
+	if (ret < 0)
+		return ret;
+
+	for (i = 0; i < cnt * 2; i += 2) {
+		if (buf[i + 1] & ADXL372_FIFO_X_MARKER) {
+			if (dev->fifo_set_len)
+				dropped++;
+			dev->fifo_set_len = 0;
+			resync = false;
+		} else if (!dev->fifo_set_len) {
+			/* y or z sample without its x sample */
+			if (!resync)
+				dropped++;
+			resync = true;
+			continue;
+		}
+
+		memcpy(&dev->fifo_set[dev->fifo_set_len], &buf[i], 2);
+		dev->fifo_set_len += 2;
+		if (dev->fifo_set_len < sizeof(dev->fifo_set))
+			continue;
+
+		set = dev->fifo_set;
+		samples[sets].x = (set[0] << 4) | (set[1] >> 4);
+		samples[sets].y = (set[2] << 4) | (set[3] >> 4);
+		samples[sets].z = (set[4] << 4) | (set[5] >> 4);
+		sets++;
+		dev->fifo_set_len = 0;
+	}
+
+	*nb_sets = sets;
+	if (nb_dropped)
+		*nb_dropped = dropped;
+
+	return 0;
+}
+
 /**
  * Retrieve the highest magnitude (x, y, z) sample recorded since the last
  * read of the MAXPEAK registers
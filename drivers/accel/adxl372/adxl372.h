@@ -149,6 +149,10 @@
 #define ADXL372_FIFO_CTL_SAMPLES_MSK		NO_OS_BIT(0)
 #define ADXL372_FIFO_CTL_SAMPLES_MODE(x)	(((x) > 0xFF) ? 1 : 0)
 
+/* ADXL372_FIFO_DATA */
+#define ADXL372_FIFO_X_MARKER			NO_OS_BIT(0)
+#define ADXL372_FIFO_BURST_MAX			255
+
 /* ADXL372_STATUS_1 */
 #define ADXL372_STATUS_1_DATA_RDY(x)		(((x) >> 0) & 0x1)
 #define ADXL372_STATUS_1_FIFO_RDY(x)		(((x) >> 1) & 0x1)
@@ -372,6 +376,9 @@ struct adxl372_dev {
 	enum adxl372_instant_on_th_mode	th_mode;
 	struct adxl372_fifo_config	fifo_config;
 	enum adxl372_comm_type		comm_type;
+	/* FIFO set split between two bursts */
+	uint8_t				fifo_set[6];
+	uint8_t				fifo_set_len;
 };
 
 struct adxl372_init_param {
@@ -462,6 +469,11 @@ int32_t adxl372_configure_fifo(struct adxl372_dev *dev,
 int32_t adxl372_get_fifo_xyz_data(struct adxl372_dev *dev,
 				  struct adxl372_xyz_accel_data *fifo_data,
 				  uint16_t cnt);
+int32_t adxl372_get_fifo_xyz_sets(struct adxl372_dev *dev,
+				  struct adxl372_xyz_accel_data *samples,
+				  uint16_t cnt,
+				  uint16_t *nb_sets,
+				  uint16_t *nb_dropped);
 int32_t adxl372_service_fifo_ev(struct adxl372_dev *dev,
 				struct adxl372_xyz_accel_data *fifo_data,
 				uint16_t *fifo_entries);
@@ -940,8 +940,118 @@ int adxl38x_accel_set_FIFO(struct adxl38x_dev *dev, uint16_t num_samples,
 		write_data |= NO_OS_BIT(3);
 
 	ret = adxl38x_write_device_data(dev, ADXL38X_FIFO_CFG0, 1, &write_data);
+	if (ret)
+		return ret;
 
-	return ret;
+	dev->fifo_samples = num_samples;
+	dev->fifo_set_len = 0;
+
+	return 0;
+}
+
+/***************************************************************************//**
+ * @brief Reads FIFO entries in a single burst and returns the complete XYZ
+ * sets. The FIFO must store the channel ID, which is used to realign the sets:
+ * entries of a set whose X entry was lost are dropped and a set split between
+ * two bursts is completed by the next call. Temperature entries are skipped.
+ *
+ * @param dev        		- The device structure.
+ * @param nb_entries 		- Number of FIFO entries to read, up to
+ *				  ADXL38X_FIFO_BURST_MAX. 0 reads the FIFO
+ *				  watermark.
+ * @param xyz        		- Interleaved X, Y, Z raw data, with room for
+ *				  the number of entries read plus 2.
+ * @param nb_sets      		- Number of XYZ sets written in xyz.
+ * @param nb_dropped      	- Number of sets dropped while realigning.
+ *				  Optional.
+ *
+ * @return ret      		- Result of the procedure.
+*******************************************************************************/
+int adxl38x_get_fifo_xyz_sets(struct adxl38x_dev *dev, uint16_t nb_entries,
+			      int16_t *xyz, uint16_t *nb_sets,
+			      uint16_t *nb_dropped)
+{
+	struct no_os_spi_msg msg = {
+		.tx_buff = dev->comm_buff,
+		.rx_buff = dev->comm_buff,
+		.cs_change = 1,
+	};
+	uint16_t dropped = 0;
+	uint16_t sets = 0;
+	bool resync = false;
+	uint8_t *entry;
+	uint8_t *data;
+	uint16_t size;
+	uint16_t i;
+	int ret;
+
+	if (!dev || !xyz || !nb_sets)
+		return -EINVAL;
+
+	if (!nb_entries)
+		nb_entries = dev->fifo_samples;
+	nb_entries = no_os_min(nb_entries, ADXL38X_FIFO_BURST_MAX);
+	size = nb_entries * ADXL38X_FIFO_ENTRY_SIZE;
+
+	/*
+	 * Burst through comm_buff, the generic read is limited to a few bytes.
+	 * On SPI the burst goes through DMA when the platform supports it.
+	 */
+	if (dev->comm_type == ADXL38X_SPI_COMM) {
+		dev->comm_buff[0] = (ADXL38X_FIFO_DATA << 1) | ADXL38X_SPI_READ;
+		msg.bytes_number = size + 1;
+		ret = no_os_spi_transfer_dma(dev->com_desc.spi_desc, &msg, 1);
+		if (ret == -ENOSYS)
+			ret = no_os_spi_write_and_read(dev->com_desc.spi_desc,
+						       dev->comm_buff, size + 1);
+		data = &dev->comm_buff[1];
+	} else {
+		dev->comm_buff[0] = ADXL38X_FIFO_DATA;
+		ret = no_os_i2c_write(dev->com_desc.i2c_desc, dev->comm_buff, 1, 0);
+		if (ret)
+			return ret;
+		ret = no_os_i2c_read(dev->com_desc.i2c_desc, dev->comm_buff, size, 1);
+		data = dev->comm_buff;
+	}
+	if (ret)
+		return ret;
+
+	for (i = 0; i < size; i += ADXL38X_FIFO_ENTRY_SIZE) {
+		entry = &data[i];
+
+		if (entry[0] > ADXL38X_FIFO_CH_ID_Z)
+			continue;
+
+		if (entry[0] == ADXL38X_FIFO_CH_ID_X) {
+			if (dev->fifo_set_len)
+				dropped++;
+			dev->fifo_set_len = 0;
+			resync = false;
+		} else if (entry[0] != dev->fifo_set_len) {
+			// Y or Z entry out of sequence
+			if (!resync)
+				dropped++;
+			dev->fifo_set_len = 0;
+			resync = true;
+			continue;
+		}
+
+		dev->fifo_set[dev->fifo_set_len++] = no_os_get_unaligned_be16(&entry[1]);
+		if (dev->fifo_set_len < NO_OS_ARRAY_SIZE(dev->fifo_set))
+			continue;
+
+		xyz[sets * 3] = dev->fifo_set[0];
+		xyz[sets * 3 + 1] = dev->fifo_set[1];
+		xyz[sets * 3 + 2] = dev->fifo_set[2];
+		sets++;
+		dev->fifo_set_len = 0;
+	}
+
+	*nb_sets = sets;
+	if (nb_dropped)
+		*nb_dropped = dropped;
+
+	return 0;
 }
 
 /***************************************************************************//**
@@ -155,6 +155,14 @@
 #define ADXL38X_SLF_TST_CTRL_MSK		0xE0
 #define ADXL38X_FIFOCFG_FIFOMODE_MSK		0x30
 
+/* FIFO entries with channel ID: ID byte followed by the big endian data */
+#define ADXL38X_FIFO_CH_ID_X			0
+#define ADXL38X_FIFO_CH_ID_Y			1
+#define ADXL38X_FIFO_CH_ID_Z			2
+#define ADXL38X_FIFO_ENTRY_SIZE			3
+/* Entries of a FIFO burst read through comm_buff, after the command byte */
+#define ADXL38X_FIFO_BURST_MAX			106
+
 /* Pre-defined codes */
 #define ADXL38X_RESET_CODE            		0x52
 #define ADXL38X_RESET_STATUS			0x80000400
@@ -334,6 +342,12 @@ struct adxl38x_dev {
 	enum adxl38x_range range;
 	/** Modes - Measurement, Standby */
 	enum adxl38x_op_mode op_mode;
+	/** FIFO watermark, in entries */
+	uint16_t fifo_samples;
+	/** Axis data of a FIFO set split between two bursts */
+	int16_t fifo_set[3];
+	/** Number of axes held in fifo_set */
+	uint8_t fifo_set_len;
 
 	uint8_t comm_buff[320];
 };
@@ -448,6 +462,10 @@ int adxl38x_accel_set_FIFO(struct adxl38x_dev *dev, uint16_t numSamples,
 			   bool externalTrigger, enum adxl38x_fifo_mode fifo_mode,
 			   bool chIDEnable, bool readReset);
 
+int adxl38x_get_fifo_xyz_sets(struct adxl38x_dev *dev, uint16_t nb_entries,
+			      int16_t *xyz, uint16_t *nb_sets,
+			      uint16_t *nb_dropped);
+
 int adxl38x_data_raw_to_gees(struct adxl38x_dev *dev, uint8_t *raw_accel_data,
 			     struct adxl38x_fractional_val *data_frac);
 
@@ -40,6 +40,7 @@
 #include "ad463x.h"
 #include "no_os_print_log.h"
 #include "no_os_alloc.h"
+#include "no_os_unpack.h"
 #include "no_os_spi.h"
 
 #define AD463x_TEST_DATA 0xAA
@@ -446,8 +447,13 @@ int32_t ad463x_read_data_offload(struct ad463x_dev *dev,
 		dev->dcache_invalidate_range(msg.rx_addr, samples * 2 * sizeof(buf[0]));
 
 	if (dev->lane_mode == AD463X_SHARED_TWO_CH) {
-		for (int i = 0; i < samples * 2; i++)
-			buf[i] = no_os_get_unaligned_be32(&buf[i]);
+		struct no_os_unpack_fmt fmt = {
+			.word_bits = 32,
+			.data_bits = 32,
+		};
+
+		ret = no_os_unpack_s32(&fmt, (uint8_t *)buf, samples * 2,
+				       (int32_t *)buf);
 	}
 
 	return ret;
@@ -495,44 +501,46 @@ static void ad463x_pext(uint8_t in0, uint8_t in1,
  * @brief Parallel Bits Extract for sample
  * @param buf - buffer of interleaved data
  * @param size - number of bytes in the buffer
- * @param ch0_out - unscrambled byte 0
- * @param ch1_out - unscrambled byte 1
+ * @param raw - channel 0 then channel 1 word, big endian
  */
-static void ad463x_pext_sample(struct ad463x_dev *dev,
-			       uint8_t *buf, int size,
-			       uint32_t *ch0_out,
-			       uint32_t *ch1_out)
+static void ad463x_pext_sample(uint8_t *buf, int size, uint8_t *raw)
 {
 	uint8_t data[8] = {0};
-	uint8_t ch0[4];
-	uint8_t ch1[4];
-	int shift;
 
 	memcpy(data, buf, size);
-	ad463x_pext(data[0], data[1], &ch0[0], &ch1[0]);
-	ad463x_pext(data[2], data[3], &ch0[1], &ch1[1]);
-	ad463x_pext(data[4], data[5], &ch0[2], &ch1[2]);
-	ad463x_pext(data[6], data[7], &ch0[3], &ch1[3]);
-
-	*ch0_out = no_os_get_unaligned_be32(ch0);
-	*ch1_out = no_os_get_unaligned_be32(ch1);
-
-	shift = 32 - dev->real_bits_precision;
-	if (shift) {
-		*ch1_out >>= shift;
-		*ch0_out >>= shift;
-	}
+	ad463x_pext(data[0], data[1], &raw[0], &raw[4]);
+	ad463x_pext(data[2], data[3], &raw[1], &raw[5]);
+	ad463x_pext(data[4], data[5], &raw[2], &raw[6]);
+	ad463x_pext(data[6], data[7], &raw[3], &raw[7]);
+}
+
+/**
+ * @brief Convert the extracted words into right aligned samples
+ * @param dev - ad463x_dev device handler.
+ * @param raw - words written by ad463x_pext_sample().
+ * @param nb_words - number of words.
+ * @param out - samples, may be the same buffer as raw.
+ * @return 0 in case of success, negative otherwise.
+ */
+static int ad463x_unpack_samples(struct ad463x_dev *dev, uint8_t *raw,
+				 uint32_t nb_words, uint32_t *out)
+{
+	struct no_os_unpack_fmt fmt = {
+		.word_bits = 32,
+		.data_bits = dev->real_bits_precision,
+		.shift = 32 - dev->real_bits_precision,
+	};
+
+	return no_os_unpack_s32(&fmt, raw, nb_words, (int32_t *)out);
 }
 
 /**
  * @brief read a single sample of data
  * @param dev - ad469x_dev device handler.
- * @param ch0_out - pointer to store channel 0 data
- * @param ch1_out - pointer to store channel 1 data
+ * @param raw - pointer to store the channel words, see ad463x_pext_sample()
  * @return 0 in case of success, negative value otherwise.
  */
-static int32_t ad463x_read_single_sample(struct ad463x_dev *dev,
-		uint32_t *ch0_out,  uint32_t *ch1_out)
+static int32_t ad463x_read_single_sample(struct ad463x_dev *dev, uint8_t *raw)
 {
 	uint8_t data[8] = {0};
 	int ret;
@@ -552,7 +560,7 @@ static int32_t ad463x_read_single_sample(struct ad463x_dev *dev,
 	if (ret)
 		return ret;
 
-	ad463x_pext_sample(dev, data, dev->read_bytes_no, ch0_out, ch1_out);
+	ad463x_pext_sample(data, dev->read_bytes_no, raw);
 
 	return 0;
 }
@@ -599,10 +607,12 @@ static int32_t ad463x_read_data_dma(struct ad463x_dev *dev,
 
 	rx_sample = rx_buf;
 	for (i = 0; i < samples; i++) {
-		ad463x_pext_sample(dev, rx_sample, 6, p_buf, p_buf + 1);
+		ad463x_pext_sample(rx_sample, 6, (uint8_t *)p_buf);
 		rx_sample += dev->read_bytes_no;
 		p_buf += 2;
 	}
+
+	ret = ad463x_unpack_samples(dev, (uint8_t *)buf, 2 * samples, buf);
 out:
 	no_os_free(rx_buf);
 	return ret;
@@ -633,11 +643,12 @@ int32_t ad463x_read_data(struct ad463x_dev *dev,
 		return ad463x_read_data_dma(dev, buf, samples);
 
 	for (i = 0, p_buf = buf; i < samples; i++, p_buf += 2) {
-		ret = ad463x_read_single_sample(dev, p_buf, p_buf + 1);
+		ret = ad463x_read_single_sample(dev, (uint8_t *)p_buf);
 		if (ret)
 			return ret;
 	}
-	return 0;
+
+	return ad463x_unpack_samples(dev, (uint8_t *)buf, 2 * samples, buf);
 }
 
 /**
@@ -33,10 +33,14 @@
 
 #include <stdlib.h>
 #include <stdbool.h>
+#include <string.h>
 #include "ad7124.h"
 #include "no_os_delay.h"
 #include "no_os_alloc.h"
 #include "no_os_error.h"
+#include "no_os_crc.h"
+
+NO_OS_DECLARE_CRC_ENGINE(ad7124_crc8, 8, AD7124_CRC8_POLYNOMIAL_REPRESENTATION);
 
 /*
  * Post reset delay required to ensure all internal config done
@@ -66,6 +70,10 @@ int32_t ad7124_no_check_read_register(struct ad7124_dev *dev,
 	if (!dev || !p_reg)
 		return -EINVAL;
 
+	/* Commands are ignored in continuous read mode */
+	if (dev->cont_read)
+		return -EBUSY;
+
 	/* Build the Command word */
 	buffer[0] = AD7124_COMM_REG_WEN | AD7124_COMM_REG_RD |
 		    AD7124_COMM_REG_RA(p_reg->addr);
@@ -134,6 +142,10 @@ int32_t ad7124_no_check_write_register(struct ad7124_dev *dev,
 	if (!dev)
 		return -EINVAL;
 
+	/* Commands are ignored in continuous read mode */
+	if (dev->cont_read)
+		return -EBUSY;
+
 	/* Build the Command word */
 	wr_buf[0] = AD7124_COMM_REG_WEN | AD7124_COMM_REG_WR |
 		    AD7124_COMM_REG_RA(reg.addr);
@@ -197,6 +209,9 @@ int32_t ad7124_read_register2(struct ad7124_dev *dev,
 {
 	int32_t ret;
 
+	if (dev->regmap)
+		return no_os_regmap_read(dev->regmap, reg, readval);
+
 	ret = ad7124_read_register(dev, &dev->regs[reg]);
 	if (ret)
 		return ret;
@@ -244,9 +259,131 @@ int32_t ad7124_write_register2(struct ad7124_dev *dev,
 {
 	dev->regs[reg].value = writeval;
 
+	if (dev->regmap)
+		return no_os_regmap_write(dev->regmap, reg, writeval);
+
 	return ad7124_write_register(dev, dev->regs[reg]);
 }
 
+/***************************************************************************//**
+ * @brief Register cache read callback.
+ * @param ctx - The handler of the instance of the driver.
+ * @param reg - Register index.
+ * @param val - The value read from the device.
+ * @return Returns 0 for success or negative error code otherwise.
+*******************************************************************************/
+static int ad7124_regmap_read(void *ctx, uint32_t reg, uint32_t *val)
+{
+	struct ad7124_dev *dev = ctx;
+	int ret;
+
+	ret = ad7124_read_register(dev, &dev->regs[reg]);
+	if (ret)
+		return ret;
+
+	*val = dev->regs[reg].value;
+
+	return 0;
+}
+
+/***************************************************************************//**
+ * @brief Register cache write callback.
+ * @param ctx - The handler of the instance of the driver.
+ * @param reg - Register index.
+ * @param val - The value to be written.
+ * @return Returns 0 for success or negative error code otherwise.
+*******************************************************************************/
+static int ad7124_regmap_write(void *ctx, uint32_t reg, uint32_t val)
+{
+	struct ad7124_dev *dev = ctx;
+
+	dev->regs[reg].value = val;
+
+	return ad7124_write_register(dev, dev->regs[reg]);
+}
+
+/***************************************************************************//**
+ * @brief Register cache bulk write callback. The device has no address auto
+ *        increment, so each register gets its own frame, but all frames are
+ *        chained in a single SPI transfer after one ready check.
+ * @param ctx  - The handler of the instance of the driver.
+ * @param reg  - First register index.
+ * @param vals - The values to be written.
+ * @param nb   - Number of registers.
+ * @return Returns 0 for success or negative error code otherwise.
+*******************************************************************************/
+static int ad7124_regmap_bulk_write(void *ctx, uint32_t reg,
+				    const uint32_t *vals, uint32_t nb)
+{
+	struct ad7124_dev *dev = ctx;
+	struct no_os_spi_msg msgs[AD7124_REGMAP_MAX_BURST] = { 0 };
+	uint8_t buf[AD7124_REGMAP_MAX_BURST][5];
+	struct ad7124_st_reg *p_reg;
+	uint32_t i;
+	int32_t j;
+	int ret;
+
+	if (nb > AD7124_REGMAP_MAX_BURST)
+		return -EINVAL;
+
+	if (dev->check_ready) {
+		ret = ad7124_wait_for_spi_ready(dev, dev->spi_rdy_poll_cnt);
+		if (ret)
+			return ret;
+	}
+
+	for (i = 0; i < nb; i++) {
+		p_reg = &dev->regs[reg + i];
+		p_reg->value = vals[i];
+
+		buf[i][0] = AD7124_COMM_REG_WEN | AD7124_COMM_REG_WR |
+			    AD7124_COMM_REG_RA(p_reg->addr);
+		for (j = 0; j < p_reg->size; j++)
+			buf[i][p_reg->size - j] = (vals[i] >> (8 * j)) & 0xFF;
+
+		msgs[i].tx_buff = buf[i];
+		msgs[i].rx_buff = buf[i];
+		msgs[i].bytes_number = p_reg->size + 1;
+		msgs[i].cs_change = 1;
+
+		if (dev->use_crc != AD7124_DISABLE_CRC) {
+			buf[i][p_reg->size + 1] = ad7124_compute_crc8(buf[i],
+						  p_reg->size + 1);
+			msgs[i].bytes_number++;
+		}
+	}
+
+	return no_os_spi_transfer(dev->spi_desc, msgs, nb);
+}
+
+/***************************************************************************//**
+ * @brief Tell the register cache which registers change on their own: status,
+ *        data and error reporting, the ADC mode which returns to standby after
+ *        single conversions, and the calibration results.
+ * @param ctx - The handler of the instance of the driver.
+ * @param reg - Register index.
+ * @return true if the register must not be cached.
+*******************************************************************************/
+static bool ad7124_regmap_volatile(void *ctx, uint32_t reg)
+{
+	switch (reg) {
+	case AD7124_Status:
+	case AD7124_ADC_Control:
+	case AD7124_Data:
+	case AD7124_Error:
+	case AD7124_Mclk_Count:
+		return true;
+	default:
+		return reg >= AD7124_Offset_0;
+	}
+}
+
+static const struct no_os_regmap_bus ad7124_regmap_bus = {
+	.reg_read = ad7124_regmap_read,
+	.reg_write = ad7124_regmap_write,
+	.bulk_write = ad7124_regmap_bulk_write,
+};
+
 /***************************************************************************//**
  * @brief Resets the device.
  * @param dev - The handler of the instance of the driver.
@@ -266,6 +403,11 @@ int32_t ad7124_reset(struct ad7124_dev *dev)
 
 	/* CRC is disabled after reset */
 	dev->use_crc = AD7124_DISABLE_CRC;
+	/* Continuous read mode is left as well */
+	dev->cont_read = false;
+
+	if (dev->regmap)
+		no_os_regmap_cache_invalidate(dev->regmap, 0, AD7124_REG_NO - 1);
 
 	/* Read POR bit to clear */
 	ret = ad7124_wait_to_power_on(dev, dev->spi_rdy_poll_cnt);
@@ -430,6 +572,205 @@ int32_t ad7124_get_read_chan_id(struct ad7124_dev *dev, uint32_t *status)
 	return 0;
 }
 
+/***************************************************************************//**
+ * @brief Enter continuous read mode, converting continuously with the status
+ *        register appended to each result. From now on, every conversion is
+ *        read with a single transfer, started when DOUT/RDY goes low, and
+ *        register accesses fail with -EBUSY until ad7124_cont_read_stop().
+ * @param dev       - The handler of the instance of the driver.
+ * @param scan_mask - Channels assembled by ad7124_cont_read_scan(), bit n for
+ *                    channel n.
+ * @return Returns 0 for success or negative error code otherwise.
+*******************************************************************************/
+int ad7124_cont_read_start(struct ad7124_dev *dev, uint16_t scan_mask)
+{
+	uint32_t mask = AD7124_ADC_CTRL_REG_CONT_READ |
+			AD7124_ADC_CTRL_REG_DATA_STATUS |
+			AD7124_ADC_CTRL_REG_MODE_MSK;
+	uint32_t adc_ctrl;
+	int ret;
+
+	if (!dev || !scan_mask)
+		return -EINVAL;
+
+	if (dev->cont_read)
+		return -EBUSY;
+
+	ret = ad7124_read_register2(dev, AD7124_ADC_Control, &adc_ctrl);
+	if (ret)
+		return ret;
+
+	memset(&dev->cr, 0, sizeof(dev->cr));
+	dev->cr.saved_adc_ctrl = adc_ctrl;
+	dev->cr.saved_mode = dev->mode;
+	dev->cr.adc_ctrl = (adc_ctrl & ~mask) |
+			   AD7124_ADC_CTRL_REG_CONT_READ |
+			   AD7124_ADC_CTRL_REG_DATA_STATUS |
+			   no_os_field_prep(AD7124_ADC_CTRL_REG_MODE_MSK,
+					    AD7124_CONTINUOUS);
+
+	ret = ad7124_write_register2(dev, AD7124_ADC_Control, dev->cr.adc_ctrl);
+	if (ret)
+		return ret;
+
+	dev->cr.scan_mask = scan_mask;
+	dev->mode = AD7124_CONTINUOUS;
+	dev->cont_read = true;
+
+	return 0;
+}
+
+/***************************************************************************//**
+ * @brief Read one result in continuous read mode. Data, status and, when
+ *        enabled, CRC are clocked out in one transfer, which must start after
+ *        DOUT/RDY went low. The CRC is checked as for a read of the data
+ *        register.
+ * @param dev    - The handler of the instance of the driver.
+ * @param data   - The conversion result.
+ * @param status - The status register, holding the channel of the result.
+ * @return Returns 0 for success or negative error code otherwise.
+*******************************************************************************/
+int ad7124_cont_read_sample(struct ad7124_dev *dev, uint32_t *data,
+			    uint8_t *status)
+{
+	uint8_t buf[6] = { 0 };
+	uint8_t size;
+	uint8_t i;
+	int ret;
+
+	if (!dev || !data || !status)
+		return -EINVAL;
+
+	if (!dev->cont_read)
+		return -EINVAL;
+
+	size = dev->regs[AD7124_Data].size;
+
+	/* buf[0] holds the implicit data register read command for the CRC */
+	ret = no_os_spi_write_and_read(dev->spi_desc, &buf[1],
+				       size + 1 + (dev->use_crc != AD7124_DISABLE_CRC));
+	if (ret)
+		return ret;
+
+	if (dev->use_crc == AD7124_USE_CRC) {
+		buf[0] = AD7124_COMM_REG_WEN | AD7124_COMM_REG_RD |
+			 AD7124_COMM_REG_RA(AD7124_DATA_REG);
+		if (ad7124_compute_crc8(buf, size + 3))
+			return -EBADMSG;
+	}
+
+	*data = 0;
+	for (i = 1; i <= size; i++)
+		*data = (*data << 8) | buf[i];
+	*status = buf[size + 1];
+
+	return 0;
+}
+
+/***************************************************************************//**
+ * @brief Read one result in continuous read mode and demultiplex it by channel
+ *        ID into the scan of the channels selected at ad7124_cont_read_start().
+ *        The sequencer converts the enabled channels in ascending order, so a
+ *        result of a channel already present in the scan means one was missed;
+ *        the partial scan is then discarded.
+ * @param dev  - The handler of the instance of the driver.
+ * @param scan - The results of the selected channels, in ascending channel
+ *               order. Written once a scan is complete.
+ * @return 1 if a scan was completed, 0 if more results are needed, negative
+ *         error code otherwise.
+*******************************************************************************/
+int ad7124_cont_read_scan(struct ad7124_dev *dev, uint32_t *scan)
+{
+	struct ad7124_cont_read *cr;
+	uint16_t bit;
+	uint32_t data;
+	uint8_t status;
+	uint8_t ch;
+	int ret;
+
+	ret = ad7124_cont_read_sample(dev, &data, &status);
+	if (ret)
+		return ret;
+
+	cr = &dev->cr;
+	ch = AD7124_STATUS_REG_CH_ACTIVE(status);
+	bit = NO_OS_BIT(ch);
+	if (!(cr->scan_mask & bit))
+		return 0;
+
+	if (cr->scan_seen & bit) {
+		cr->nb_dropped++;
+		cr->scan_seen = 0;
+	}
+
+	cr->data[ch] = data;
+	cr->scan_seen |= bit;
+	if (cr->scan_seen != cr->scan_mask)
+		return 0;
+
+	cr->scan_seen = 0;
+	for (ch = 0; ch < AD7124_MAX_CHANNELS; ch++)
+		if (cr->scan_mask & NO_OS_BIT(ch))
+			*scan++ = cr->data[ch];
+
+	return 1;
+}
+
+/***************************************************************************//**
+ * @brief Exit continuous read mode. The device only accepts the data read
+ *        command while DOUT/RDY is low, so the command is repeated until the
+ *        ADC control register reads back, for at most spi_rdy_poll_cnt tries.
+ *        The ADC control register and mode saved by ad7124_cont_read_start()
+ *        are then restored.
+ * @param dev - The handler of the instance of the driver.
+ * @return Returns 0 for success or negative error code otherwise.
+*******************************************************************************/
+int ad7124_cont_read_stop(struct ad7124_dev *dev)
+{
+	struct ad7124_st_reg data_reg, ctrl_reg;
+	uint32_t expected;
+	int16_t timeout;
+	int32_t ret;
+
+	if (!dev)
+		return -EINVAL;
+
+	if (!dev->cont_read)
+		return 0;
+
+	dev->cont_read = false;
+
+	data_reg = dev->regs[AD7124_Data];
+	ctrl_reg = dev->regs[AD7124_ADC_Control];
+	expected = dev->cr.adc_ctrl & ~AD7124_ADC_CTRL_REG_CONT_READ;
+
+	for (timeout = dev->spi_rdy_poll_cnt; timeout > 0; timeout--) {
+		/* The data read command, reading the pending result */
+		ad7124_no_check_read_register(dev, &data_reg);
+
+		ret = ad7124_no_check_read_register(dev, &ctrl_reg);
+		if (!ret && (ctrl_reg.value & ~AD7124_ADC_CTRL_REG_CONT_READ) ==
+		    expected)
+			break;
+
+		no_os_udelay(100);
+	}
+
+	if (!timeout) {
+		dev->cont_read = true;
+		return -ETIMEDOUT;
+	}
+
+	ret = ad7124_write_register2(dev, AD7124_ADC_Control,
+				     dev->cr.saved_adc_ctrl);
+	if (ret)
+		return ret;
+
+	dev->mode = dev->cr.saved_mode;
+
+	return 0;
+}
+
 /***************************************************************************//**
  * @brief Computes the CRC checksum for a data buffer.
  * @param p_buf    - Data buffer
@@ -438,26 +779,7 @@ int32_t ad7124_get_read_chan_id(struct ad7124_dev *dev, uint32_t *status)
 *******************************************************************************/
 uint8_t ad7124_compute_crc8(uint8_t * p_buf, uint8_t buf_size)
 {
-	uint8_t i = 0;
-	uint8_t crc = 0;
-
-	while (buf_size) {
-		for (i = 0x80; i != 0; i >>= 1) {
-			bool cmp1 = (crc & 0x80) != 0;
-			bool cmp2 = (*p_buf & i) != 0;
-			if (cmp1 != cmp2) {
-				/* MSB of CRC register XOR input Bit from Data */
-				crc <<= 1;
-				crc ^= AD7124_CRC8_POLYNOMIAL_REPRESENTATION;
-			} else {
-				crc <<= 1;
-			}
-		}
-		p_buf++;
-		buf_size--;
-	}
-
-	return crc;
+	return no_os_crc_compute(&ad7124_crc8, p_buf, buf_size, 0);
 }
 
 /***************************************************************************//**
@@ -694,6 +1016,9 @@ int ad7124_reg_write_msk(struct ad7124_dev *dev,
 	int ret;
 	uint32_t reg_data;
 
+	if (dev->regmap)
+		return no_os_regmap_update_bits(dev->regmap, reg_addr, mask, data);
+
 	ret = ad7124_read_register2(dev, reg_addr, &reg_data);
 	if (ret)
 		return ret;
@@ -1039,6 +1364,7 @@ int32_t ad7124_setup(struct ad7124_dev **device,
 {
 	int32_t ret;
 	struct ad7124_dev *dev;
+	struct no_os_regmap_init_param regmap_ip;
 	uint8_t setup_index;
 	uint8_t ch_index;
 
@@ -1047,6 +1373,7 @@ int32_t ad7124_setup(struct ad7124_dev **device,
 		return -ENOMEM;
 
 	dev->regs = init_param->regs;
+	dev->regmap = NULL;
 	dev->spi_rdy_poll_cnt = init_param->spi_rdy_poll_cnt;
 
 	/* Initialize the SPI communication. */
@@ -1054,18 +1381,30 @@ int32_t ad7124_setup(struct ad7124_dev **device,
 	if (ret)
 		goto error_dev;
 
+	regmap_ip = (struct no_os_regmap_init_param) {
+		.bus = &ad7124_regmap_bus,
+		.ctx = dev,
+		.nb_regs = AD7124_REG_NO,
+		.cache_type = NO_OS_REGMAP_CACHE_WRITE_THROUGH,
+		.max_burst = AD7124_REGMAP_MAX_BURST,
+		.volatile_reg = ad7124_regmap_volatile,
+	};
+	ret = no_os_regmap_init(&dev->regmap, &regmap_ip);
+	if (ret)
+		goto error_spi;
+
 	/* Update the device structure with power-on/reset settings. */
 	dev->check_ready = init_param->check_ready;
 
 	/*  Reset the device interface.*/
 	ret = ad7124_reset(dev);
 	if (ret)
-		goto error_spi;
+		goto error_regmap;
 
 	/* Initialize ADC mode register. */
 	ret = ad7124_write_register(dev, dev->regs[AD7124_ADC_CTRL_REG]);
 	if (ret)
-		goto error_spi;
+		goto error_regmap;
 
 	/* Get CRC State. */
 	ad7124_update_crcsetting(dev);
@@ -1076,7 +1415,7 @@ int32_t ad7124_setup(struct ad7124_dev **device,
 	/* Read ID register to identify the part. */
 	ret = ad7124_read_register(dev, &dev->regs[AD7124_ID_REG]);
 	if (ret)
-		goto error_spi;
+		goto error_regmap;
 
 	if (dev->active_device == ID_AD7124_4) {
 		switch (dev->regs[AD7124_ID_REG].value) {
@@ -1086,7 +1425,7 @@ int32_t ad7124_setup(struct ad7124_dev **device,
 			break;
 
 		default:
-			goto error_spi;
+			goto error_regmap;
 		}
 	}
 
@@ -1098,79 +1437,99 @@ int32_t ad7124_setup(struct ad7124_dev **device,
 			break;
 
 		default:
-			goto error_spi;
+			goto error_regmap;
 		}
 	}
 
+	/*
+	 * Collect the setup and channel configuration in the register cache and
+	 * write each register once, instead of once per field.
+	 */
+	ret = no_os_regmap_set_cache_type(dev->regmap,
+					  NO_OS_REGMAP_CACHE_WRITE_BACK);
+	if (ret)
+		goto error_regmap;
+
 	for (setup_index = 0; setup_index < AD7124_MAX_SETUPS; setup_index++) {
 		ret = ad7124_set_polarity(dev,
 					  init_param->setups[setup_index].bi_unipolar,
 					  setup_index);
 		if (ret)
-			goto error_spi;
+			goto error_regmap;
 
 		ret = ad7124_set_burnout(dev,
 					 init_param->setups[setup_index].burnout,
 					 setup_index);
 
 		if (ret)
-			goto error_spi;
+			goto error_regmap;
 
 		ret = ad7124_set_reference_source(dev,
 						  init_param->setups[setup_index].ref_source,
 						  setup_index,
 						  init_param->ref_en);
 		if (ret)
-			goto error_spi;
+			goto error_regmap;
 
 		ret = ad7124_enable_buffers(dev,
 					    init_param->setups[setup_index].ain_buff,
 					    init_param->setups[setup_index].ref_buff,
 					    setup_index);
 		if (ret)
-			goto error_spi;
+			goto error_regmap;
 
 		ret = ad7124_set_pga(dev,
 				     init_param->setups[setup_index].pga,
 				     setup_index);
 
 		if (ret)
-			goto error_spi;
+			goto error_regmap;
 	}
 
+	ret = no_os_regmap_sync(dev->regmap);
+	if (ret)
+		goto error_regmap;
+
 	ret = ad7124_set_adc_mode(dev, init_param->mode);
 	if (ret)
-		goto error_spi;
+		goto error_regmap;
 
 	ret = ad7124_set_power_mode(dev,
 				    init_param->power_mode);
 	if (ret)
-		goto error_spi;
+		goto error_regmap;
 
 	for (ch_index = 0; ch_index < AD7124_MAX_CHANNELS; ch_index++) {
 		ret = ad7124_connect_analog_input(dev,
 						  ch_index,
 						  init_param->chan_map[ch_index].ain);
 		if (ret)
-			goto error_spi;
+			goto error_regmap;
 
 		ret = ad7124_assign_setup(dev,
 					  ch_index,
 					  init_param->chan_map[ch_index].setup_sel);
 		if (ret)
-			goto error_spi;
+			goto error_regmap;
 
 		ret = ad7124_set_channel_status(dev,
 						ch_index,
 						init_param->chan_map[ch_index].channel_enable);
 		if (ret)
-			goto error_spi;
+			goto error_regmap;
 	}
 
+	ret = no_os_regmap_set_cache_type(dev->regmap,
+					  NO_OS_REGMAP_CACHE_WRITE_THROUGH);
+	if (ret)
+		goto error_regmap;
+
 	*device = dev;
 
 	return 0;
 
+error_regmap:
+	no_os_regmap_remove(dev->regmap);
 error_spi:
 	no_os_spi_remove(dev->spi_desc);
 error_dev:
@@ -1192,6 +1551,7 @@ int32_t ad7124_remove(struct ad7124_dev *dev)
 	if (ret)
 		return ret;
 
+	no_os_regmap_remove(dev->regmap);
 	no_os_free(dev);
 
 	return 0;
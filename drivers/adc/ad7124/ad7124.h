@@ -38,11 +38,15 @@
 #include "no_os_spi.h"
 #include "no_os_delay.h"
 #include "no_os_util.h"
+#include "no_os_regmap.h"
 
 #define	AD7124_RW 1   /* Read and Write */
 #define	AD7124_R  2   /* Read only */
 #define AD7124_W  3   /* Write only */
 
+/* Maximum number of registers flushed by the register cache in one transfer */
+#define AD7124_REGMAP_MAX_BURST	8
+
 /* Total Number of Setups */
 #define AD7124_MAX_SETUPS	8
 /* Maximum number of channels */
@@ -499,6 +503,27 @@ enum ad7124_registers {
 	AD7124_REG_NO
 };
 
+/**
+ * @struct ad7124_cont_read
+ * @brief Continuous read mode state, used to assemble scans from the results
+ *        of the channel sequencer.
+ **/
+struct ad7124_cont_read {
+	/* Channels assembled into a scan, bit n for channel n */
+	uint16_t scan_mask;
+	/* Channels of the current scan received so far */
+	uint16_t scan_seen;
+	/* Partial scans discarded because a result was missed */
+	uint32_t nb_dropped;
+	/* ADC control register value while in continuous read mode */
+	uint32_t adc_ctrl;
+	/* ADC control register value and mode restored on exit */
+	uint32_t saved_adc_ctrl;
+	enum ad7124_mode saved_mode;
+	/* Latest result of each channel */
+	uint32_t data[AD7124_MAX_CHANNELS];
+};
+
 /**
  * The structure describes the device and is used with the ad7124 driver.
  * @brief Device Structure
@@ -508,6 +533,8 @@ struct ad7124_dev {
 	struct no_os_spi_desc		*spi_desc;
 	/* Device Settings */
 	struct ad7124_st_reg	*regs;
+	/* Register cache */
+	struct no_os_regmap	*regmap;
 	int16_t use_crc;
 	int16_t check_ready;
 	int16_t spi_rdy_poll_cnt;
@@ -522,6 +549,10 @@ struct ad7124_dev {
 	struct ad7124_channel_setup setups[AD7124_MAX_SETUPS];
 	/* Channel Mapping*/
 	struct ad7124_channel_map chan_map[AD7124_MAX_CHANNELS];
+	/* Set while the device is in continuous read mode */
+	bool cont_read;
+	/* Continuous read state */
+	struct ad7124_cont_read cr;
 };
 
 struct ad7124_init_param {
@@ -593,6 +624,19 @@ int32_t ad7124_read_data(struct ad7124_dev *dev,
 /* Get the ID of the channel of the latest conversion. */
 int32_t ad7124_get_read_chan_id(struct ad7124_dev *dev, uint32_t *status);
 
+/* Enter continuous read mode, with the status appended to the data. */
+int ad7124_cont_read_start(struct ad7124_dev *dev, uint16_t scan_mask);
+
+/* Read one result in continuous read mode. */
+int ad7124_cont_read_sample(struct ad7124_dev *dev, uint32_t *data,
+			    uint8_t *status);
+
+/* Read one result and add it to the scan of the active channels. */
+int ad7124_cont_read_scan(struct ad7124_dev *dev, uint32_t *scan);
+
+/* Exit continuous read mode. */
+int ad7124_cont_read_stop(struct ad7124_dev *dev);
+
 /* Computes the CRC checksum for a data buffer. */
 uint8_t ad7124_compute_crc8(uint8_t* p_buf,
 			    uint8_t buf_size);
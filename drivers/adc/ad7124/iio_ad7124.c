@@ -691,6 +691,57 @@ static int32_t iio_ad7124_read_samples(void *dev, int32_t *buff,
 	return nb_samples;
 }
 
+/**
+ * @brief Enable the channels of the buffer and enter continuous read mode.
+ * @param [in] dev - Device descriptor.
+ * @param [in] mask - Active channels mask.
+ * @return 0 in case of success, error code otherwise.
+ */
+static int32_t iio_ad7124_trig_pre_enable(void *dev, uint32_t mask)
+{
+	int32_t ret;
+
+	ret = iio_ad7124_update_active_channels(dev, mask);
+	if (ret != 0)
+		return ret;
+
+	return ad7124_cont_read_start(dev, mask);
+}
+
+/**
+ * @brief Exit continuous read mode and disable the channels.
+ * @param [in] dev - Device descriptor.
+ * @return 0 in case of success, error code otherwise.
+ */
+static int32_t iio_ad7124_trig_post_disable(void *dev)
+{
+	int32_t ret;
+
+	ret = ad7124_cont_read_stop(dev);
+	if (ret != 0)
+		return ret;
+
+	return iio_ad7124_close_channels(dev);
+}
+
+/**
+ * @brief Read the result signaled by the DOUT/RDY falling edge and push a scan
+ *        once all the active channels were converted.
+ * @param [in] dev_data - IIO device data.
+ * @return 0 in case of success, error code otherwise.
+ */
+static int32_t iio_ad7124_trigger_handler(struct iio_device_data *dev_data)
+{
+	uint32_t scan[AD7124_MAX_CHANNELS];
+	int ret;
+
+	ret = ad7124_cont_read_scan(dev_data->dev, scan);
+	if (ret <= 0)
+		return ret;
+
+	return iio_buffer_push_scan(dev_data->buffer, scan);
+}
+
 struct iio_device iio_ad7124_device = {
 	.num_ch = NO_OS_ARRAY_SIZE(ad7124_channels),
 	.channels = ad7124_channels,
@@ -704,3 +755,16 @@ struct iio_device iio_ad7124_device = {
 	.debug_reg_write = (int32_t (*)())ad7124_write_register2
 };
 
+/* Same device, captured in continuous read mode from the DOUT/RDY trigger */
+struct iio_device iio_ad7124_trig_device = {
+	.num_ch = NO_OS_ARRAY_SIZE(ad7124_channels),
+	.channels = ad7124_channels,
+	.attributes = NULL,
+	.debug_attributes = NULL,
+	.buffer_attributes = NULL,
+	.pre_enable = iio_ad7124_trig_pre_enable,
+	.post_disable = iio_ad7124_trig_post_disable,
+	.trigger_handler = iio_ad7124_trigger_handler,
+	.debug_reg_read = (int32_t (*)())ad7124_read_register2,
+	.debug_reg_write = (int32_t (*)())ad7124_write_register2
+};
@@ -37,5 +37,7 @@
 #include "iio.h"
 
 extern struct iio_device iio_ad7124_device;
+extern struct iio_device iio_ad7124_trig_device;
+extern struct iio_trigger ad7124_iio_trig_desc;
 
 #endif /** IIO_AD7124_H */
@@ -40,6 +40,7 @@
 #include "no_os_error.h"
 #include "no_os_util.h"
 #include "no_os_crc.h"
+#include "no_os_unpack.h"
 #include "no_os_alloc.h"
 
 #ifdef XILINX_PLATFORM
@@ -525,60 +526,6 @@ int32_t ad7606_reg_write_mask(struct ad7606_dev *dev,
 	return ad7606_reg_write(dev, addr, reg_data);
 }
 
-/* Internal function to copy the content of a buffer in 18-bit chunks to a 32-bit buffer by
- * extending the chunks to 32-bit size. */
-static int32_t cpy18b32b(uint8_t *psrc, uint32_t srcsz, uint32_t *pdst)
-{
-	unsigned int i, j;
-
-	if (srcsz % 9)
-		return -EINVAL;
-
-	for (i = 0; i < srcsz; i += 9) {
-		j = 4 * (i / 9);
-		pdst[j + 0] = ((uint32_t)(psrc[i + 0] & 0xff) << 10) | ((
-					uint32_t)psrc[i + 1] << 2)
-			      | ((uint32_t)psrc[i + 2] >> 6);
-		pdst[j + 1] = ((uint32_t)(psrc[i + 2] & 0x3f) << 12) | ((
-					uint32_t)psrc[i + 3] << 4)
-			      | ((uint32_t)psrc[i + 4] >> 4);
-		pdst[j + 2] = ((uint32_t)(psrc[i + 4] & 0x0f) << 14) | ((
-					uint32_t)psrc[i + 5] << 6)
-			      | ((uint32_t)psrc[i + 6] >> 2);
-		pdst[j + 3] = ((uint32_t)(psrc[i + 6] & 0x03) << 16) | ((
-					uint32_t)psrc[i + 7] << 8)
-			      | ((uint32_t)psrc[i + 8] >> 0);
-	}
-	return 0;
-}
-
-/* Internal function to copy the content of a buffer in 26-bit chunks to a 32-bit buffer by
- * extending the chunks to 32-bit size. */
-static int32_t cpy26b32b(uint8_t *psrc, uint32_t srcsz, uint32_t *pdst)
-{
-	unsigned int i, j;
-
-	if (srcsz % 13)
-		return -EINVAL;
-
-	for (i = 0; i < srcsz; i += 13) {
-		j = 4 * (i / 13);
-		pdst[j + 0] = ((uint32_t)(psrc[i + 0] & 0xff) << 18) | ((
-					uint32_t)psrc[i + 1] << 10)
-			      | ((uint32_t)psrc[i + 2] << 2) | ((uint32_t)psrc[i + 3] >> 6);
-		pdst[j + 1] = ((uint32_t)(psrc[i + 3] & 0x3f) << 20) | ((
-					uint32_t)psrc[i + 4] << 12)
-			      | ((uint32_t)psrc[i + 5] << 4) | ((uint32_t)psrc[i + 6] >> 4);
-		pdst[j + 2] = ((uint32_t)(psrc[i + 6] & 0x0f) << 22) | ((
-					uint32_t)psrc[i + 7] << 14)
-			      | ((uint32_t)psrc[i + 8] << 6) | ((uint32_t)psrc[i + 9] >> 2);
-		pdst[j + 3] = ((uint32_t)(psrc[i + 9] & 0x03) << 24) | ((
-					uint32_t)psrc[i + 10] << 16)
-			      | ((uint32_t)psrc[i + 11] << 8) | ((uint32_t)psrc[i + 12] >> 0);
-	}
-	return 0;
-}
-
 /***************************************************************************//**
  * @brief Toggle the CONVST pin to start a conversion.
  *
@@ -637,8 +584,9 @@ int32_t ad7606_convst(struct ad7606_dev *dev)
 *******************************************************************************/
 int32_t ad7606_spi_data_read(struct ad7606_dev *dev, uint32_t *data)
 {
+	struct no_os_unpack_fmt fmt = {0};
 	uint32_t sz;
-	int32_t ret, i;
+	int32_t ret;
 	uint16_t crc, icrc;
 	uint8_t bits = ad7606_chip_info_tbl[dev->device_id].bits;
 	uint8_t sbits = dev->config.status_header ? 8 : 0;
@@ -674,33 +622,14 @@ int32_t ad7606_spi_data_read(struct ad7606_dev *dev, uint32_t *data)
 			return -EBADMSG;
 	}
 
-	switch (bits) {
-	case 18:
-		if (dev->config.status_header)
-			ret = cpy26b32b(dev->data, sz, data);
-		else
-			ret = cpy18b32b(dev->data, sz, data);
-		if (ret < 0)
-			return ret;
-		break;
-	case 16:
-		for (i = 0; i < nchannels; i++) {
-			if (dev->config.status_header) {
-				data[i] = (uint32_t)dev->data[i * 3] << 16;
-				data[i] |= (uint32_t)dev->data[i * 3 + 1] << 8;
-				data[i] |= (uint32_t)dev->data[i * 3 + 2];
-			} else {
-				data[i] = (uint32_t)dev->data[i * 2] << 8;
-				data[i] |= (uint32_t)dev->data[i * 2 + 1];
-			}
-		}
-		break;
-	default:
-		ret = -ENOTSUP;
-		break;
-	};
+	if (bits != 16 && bits != 18)
+		return -ENOTSUP;
 
-	return ret;
+	/* Raw samples, with the status byte in the lowest 8 bits if enabled. */
+	fmt.word_bits = bits + sbits;
+	fmt.data_bits = bits + sbits;
+
+	return no_os_unpack_s32(&fmt, dev->data, nchannels, (int32_t *)data);
 }
 
 /***************************************************************************//**
@@ -799,7 +728,7 @@ static int32_t ad7606_read_raw_data_parallel(struct ad7606_dev *dev,
 		return ret;
 
 	if (axi->dcache_invalidate_range)
-		axi->dcache_invalidate_range(transfer.dest_addr, samples * sizeof(uint32_t));
+		axi->dcache_invalidate_range(transfer.dest_addr, transfer.size);
 
 	return 0;
 #endif
@@ -818,10 +747,24 @@ static int32_t ad7606_spi_engine_capture_pre_enable(struct ad7606_dev *dev)
 	const uint8_t bits = ad7606_chip_info_tbl[dev->device_id].bits;
 	struct ad7606_axi_dev *axi = &dev->axi_dev;
 
+	int32_t ret;
+
 	dev->spi_desc->mode = NO_OS_SPI_MODE_2;
 	spi_engine_set_speed(dev->spi_desc, dev->spi_desc->max_speed_hz);
 	spi_engine_set_transfer_width(dev->spi_desc, bits);
 
+	/*
+	 * The offload DMA is set up once and reused by every buffer refill,
+	 * spi_engine_remove() releases it.
+	 */
+	if (!axi->offload_initialized) {
+		ret = spi_engine_offload_init(dev->spi_desc, &axi->offload_init_param);
+		if (ret)
+			return ret;
+
+		axi->offload_initialized = true;
+	}
+
 	return no_os_pwm_enable(axi->trigger_pwm_desc);
 #endif
 }
@@ -867,9 +810,8 @@ static int32_t ad7606_read_raw_data_spi_engine(struct ad7606_dev *dev,
 		CS_HIGH,
 	};
 
-	ret = spi_engine_offload_init(dev->spi_desc, &axi->offload_init_param);
-	if (ret)
-		return ret;
+	if (!axi->offload_initialized)
+		return -EINVAL;
 
 	msg.commands_data = commands_data;
 	msg.commands = spi_eng_msg_cmds;
@@ -1001,7 +943,8 @@ int32_t ad7606_read_samples(struct ad7606_dev *dev, uint32_t * data,
 {
 #ifdef XILINX_PLATFORM
 	struct ad7606_axi_dev *axi = &dev->axi_dev;
-	uint32_t nchannels, i, sample_size;
+#endif
+	uint32_t nchannels, i;
 	int32_t ret;
 
 	if (dev->reg_mode) {
@@ -1013,22 +956,23 @@ int32_t ad7606_read_samples(struct ad7606_dev *dev, uint32_t * data,
 		dev->reg_mode = false;
 	}
 
+#ifdef XILINX_PLATFORM
 	if (axi->initialized) {
 		if (dev->parallel_interface)
 			return ad7606_read_raw_data_parallel(dev, data, samples);
 		return ad7606_read_raw_data_spi_engine(dev, data, samples);
 	}
+#endif
 
 	nchannels = ad7606_chip_info_tbl[dev->device_id].num_channels;
-	sample_size = nchannels * sizeof(uint32_t);
 
-	for (i = 0; i < samples; i++) {
+	/* samples counts single channel results, one conversion fills nchannels */
+	for (i = 0; i < samples; i += nchannels) {
 		ret = ad7606_read_one_sample(dev, data);
 		if (ret)
 			return ret;
-		data += sample_size;
+		data += nchannels;
 	}
-#endif
 
 	return 0;
 }
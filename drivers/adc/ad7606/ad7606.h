@@ -287,6 +287,8 @@ struct ad7606_axi_dev {
 	struct no_os_pwm_desc *trigger_pwm_desc;
 	/* SPI Engine offload parameters */
 	struct spi_engine_offload_init_param offload_init_param;
+	/* Set to 'true' once the SPI Engine offload DMA has been set up */
+	bool offload_initialized;
 	/* AXI DMA controller for parallel sample capture */
 	struct axi_dmac *dmac;
 	/* AXI Core */
@@ -313,6 +313,35 @@ static int32_t iio_ad7606_post_disable(void *dev)
 	return 0;
 }
 
+/**
+ * @brief	Keep only the active channels of the captured scans.
+ * @param	src - Scans holding a result of every channel
+ * @param	dst - Packed scans, may be the same as src
+ * @param	nb_scans - Number of scans
+ * @param	num_chan - Number of channels of the device
+ * @param	mask - Active channels mask
+ */
+static void iio_ad7606_pack_scans(const uint32_t *src, uint32_t *dst,
+				  uint32_t nb_scans, uint32_t num_chan,
+				  uint32_t mask)
+{
+	uint8_t idx[MAX_CHANNELS];
+	uint32_t nb_active = 0;
+	uint32_t i, j;
+
+	for (j = 0; j < num_chan; j++)
+		if (mask & NO_OS_BIT(j))
+			idx[nb_active++] = j;
+
+	/* Scans already have the buffer layout */
+	if (nb_active == num_chan && src == dst)
+		return;
+
+	for (i = 0; i < nb_scans; i++, src += num_chan)
+		for (j = 0; j < nb_active; j++)
+			*dst++ = src[idx[j]];
+}
+
 /**
  * @brief	Read buffer data corresponding to AD7606 IIO device
  * @param	iio_dev_data - Pointer to IIO device data structure
@@ -324,33 +353,20 @@ static int32_t iio_ad7606_submit_buffer(struct iio_device_data *iio_dev_data)
 	struct ad7606_dev *dev = iio_dev->ad7606_dev;
 	struct iio_buffer *buffer = iio_dev_data->buffer;
 	uint32_t num_chan = ad7606_get_channels_number(dev);
-	uint32_t *push_data, *data;
-	uint32_t total_samples;
 	void *buff;
-	uint32_t i, j, k;
 	int32_t ret;
 
 	ret = iio_buffer_get_block(buffer, &buff);
 	if (ret)
 		return ret;
 
-	total_samples = num_chan * buffer->samples;
-
-	data = buff;
-	ret = ad7606_read_samples(dev, buff, total_samples);
+	/* The whole block is captured at once, with every channel enabled */
+	ret = ad7606_read_samples(dev, buff, num_chan * buffer->samples);
 	if (ret)
 		return ret;
 
-	push_data = buff;
-	for (k = 0, i = 0; i < total_samples; i += num_chan) {
-		uint32_t active_mask = buffer->active_mask;
-
-		for (j = 0; j < num_chan; j++) {
-			if ((NO_OS_BIT(j) & active_mask) == 0)
-				continue;
-			push_data[k++] = data[i + j];
-		}
-	}
+	iio_ad7606_pack_scans(buff, buff, buffer->samples, num_chan,
+			      buffer->active_mask);
 
 	return iio_buffer_block_done(buffer);
 }
@@ -174,7 +174,8 @@ int32_t adc_submit_samples(struct iio_device_data *dev_data)
 
 
 /**
- * @brief Handles trigger: reads one data-set and writes it to the buffer.
+ * @brief Handles trigger: reads one data-set for each pending trigger event
+ * and writes it to the buffer.
  *
  * @param dev_data  - The iio device data structure.
  *
@@ -189,34 +190,41 @@ int32_t adc_demo_trigger_handler(struct iio_device_data *dev_data)
 	uint16_t buff[TOTAL_ADC_CHANNELS];
 	static uint32_t i = 0;
 	uint16_t *ch_buf_ptr;
+	uint32_t n = 0;
+	int32_t ret;
 
 	if (!dev_data)
 		return -EINVAL;
 
 	desc = (struct adc_demo_desc *)dev_data->dev;
 
-	if (desc->ext_buff == NULL) {
-		int offset_per_ch = NO_OS_ARRAY_SIZE(sine_lut) / TOTAL_ADC_CHANNELS;
-		while (get_next_ch_idx(desc->active_ch, ch, &ch))
-			buff[k++] = sine_lut[(i + ch * offset_per_ch) % NO_OS_ARRAY_SIZE(sine_lut)];
-		if (i == NO_OS_ARRAY_SIZE(sine_lut))
-			i = 0;
-		else
-			i++;
-
-		return iio_buffer_push_scan(dev_data->buffer, buff);
-	}
+	do {
+		if (desc->ext_buff == NULL) {
+			int offset_per_ch = NO_OS_ARRAY_SIZE(sine_lut) / TOTAL_ADC_CHANNELS;
+			while (get_next_ch_idx(desc->active_ch, ch, &ch))
+				buff[k++] = sine_lut[(i + ch * offset_per_ch) % NO_OS_ARRAY_SIZE(sine_lut)];
+			if (i == NO_OS_ARRAY_SIZE(sine_lut))
+				i = 0;
+			else
+				i++;
+		} else {
+			while (get_next_ch_idx(desc->active_ch, ch, &ch)) {
+				ch_buf_ptr = (uint16_t*)desc->ext_buff + (ch * desc->ext_buff_len);
+				buff[k++] = ch_buf_ptr[i];
+			}
+			if (i == (desc->ext_buff_len - 1))
+				i = 0;
+			else
+				i++;
+		}
+		k = 0;
 
-	while (get_next_ch_idx(desc->active_ch, ch, &ch)) {
-		ch_buf_ptr = (uint16_t*)desc->ext_buff + (ch * desc->ext_buff_len);
-		buff[k++] = ch_buf_ptr[i];
-	}
-	if (i == (desc->ext_buff_len - 1))
-		i = 0;
-	else
-		i++;
+		ret = iio_buffer_push_scan(dev_data->buffer, buff);
+		if (ret)
+			return ret;
+	} while (++n < dev_data->events_pending);
 
-	return iio_buffer_push_scan(dev_data->buffer, buff);
+	return 0;
 }
 
 #define ADC_DEMO_ATTR(_name, _priv) {\
@@ -54,6 +54,7 @@ struct iio_trigger adc_iio_sw_trig_desc = {
 #ifndef LINUX_PLATFORM
 struct iio_trigger adc_iio_timer_trig_desc = {
 	.is_synchronous = true,
+	.is_deferred = true,
 	.enable = iio_trig_enable,
 	.disable = iio_trig_disable,
 };
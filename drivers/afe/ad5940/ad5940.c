@@ -195,6 +195,7 @@ int ad5940_remove(struct ad5940_dev *dev)
 	no_os_gpio_remove(dev->reset_gpio);
 	no_os_spi_remove(dev->spi);
 	dev->spi = NULL;
+	no_os_free(dev->fifo_buf);
 	no_os_free(dev);
 
 	return 0;
@@ -232,16 +233,16 @@ int ad5940_SEQGenInsert(struct ad5940_dev *dev, uint32_t CmdWord)
 static int AD5940_SEQGenSearchReg(struct ad5940_dev *dev, uint32_t RegAddr,
 				  uint32_t *pIndex)
 {
-	uint32_t i;
+	uint16_t slot;
 
-	RegAddr = (RegAddr >> 2) & 0xff;
-	for (i = 0; i < dev->SeqGenDB.RegCount; i++) {
-		if (RegAddr == dev->SeqGenDB.pRegInfo[i].RegAddr) {
-			*pIndex = i;
-			return 0;
-		}
-	}
-	return -EINVAL;
+	slot = dev->SeqGenDB.RegSlot[(RegAddr >> 2) & 0xff];
+	if (slot == AD5940_SEQGEN_NO_SLOT)
+		return -EINVAL;
+
+	/* pRegInfo grows downwards, the latest register is at index 0 */
+	*pIndex = dev->SeqGenDB.RegCount - 1 - slot;
+
+	return 0;
 }
 
 static int AD5940_SEQGenGetRegDefault(struct ad5940_dev *dev, uint32_t RegAddr,
@@ -262,6 +263,7 @@ static int AD5940_SEQRegInfoInsert(struct ad5940_dev *dev, uint16_t RegAddr,
 		dev->SeqGenDB.pRegInfo --; /* Move back */
 		dev->SeqGenDB.pRegInfo[0].RegAddr = (RegAddr >> 2) & 0xff;
 		dev->SeqGenDB.pRegInfo[0].RegValue = RegData & 0x00fffff;
+		dev->SeqGenDB.RegSlot[(RegAddr >> 2) & 0xff] = dev->SeqGenDB.RegCount;
 		dev->SeqGenDB.RegCount ++;
 	} else { /* There is no more buffer  */
 		dev->SeqGenDB.LastError = -ENOMEM;
@@ -325,11 +327,13 @@ int ad5940_SEQGenInit(struct ad5940_dev *dev, uint32_t *pBuffer,
 		return -EINVAL;
 	dev->SeqGenDB.BufferSize = BufferSize;
 	dev->SeqGenDB.pSeqBuff = pBuffer;
-	dev->SeqGenDB.pRegInfo = (SEQGenRegInfo_Type*)pBuffer + BufferSize -
-				 1; /* Point to the last element in buffer */
+	/* Register info grows downwards from the end of the buffer, each insert
+	 * moves the pointer back before storing, so start one past the end */
+	dev->SeqGenDB.pRegInfo = (SEQGenRegInfo_Type*)pBuffer + BufferSize;
 	dev->SeqGenDB.SeqLen = 0;
 
 	dev->SeqGenDB.RegCount = 0;
+	memset(dev->SeqGenDB.RegSlot, 0xFF, sizeof(dev->SeqGenDB.RegSlot));
 	dev->SeqGenDB.LastError = 0;
 	dev->SeqGenDB.EngineStart = false;
 
@@ -363,6 +367,164 @@ int ad5940_SEQGenCtrl(struct ad5940_dev *dev, bool enable)
 	return 0;
 }
 
+/**
+ * @brief Allocate a compiled sequence cache.
+ * @param cache - The cache descriptor.
+ * @param EntryCount - Number of sequences the cache can hold.
+ * @param MaxSeqLen - Maximum number of commands of a cached sequence.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+int ad5940_seq_cache_init(struct ad5940_seq_cache **cache, uint32_t EntryCount,
+			  uint32_t MaxSeqLen)
+{
+	struct ad5940_seq_cache *c;
+	uint32_t i;
+
+	if (!cache || !EntryCount || !MaxSeqLen)
+		return -EINVAL;
+
+	c = no_os_calloc(1, sizeof(*c));
+	if (!c)
+		return -ENOMEM;
+
+	c->pEntry = no_os_calloc(EntryCount, sizeof(*c->pEntry));
+	if (!c->pEntry)
+		goto error;
+
+	for (i = 0; i < EntryCount; i++) {
+		c->pEntry[i].pSeqCmd = no_os_calloc(MaxSeqLen, sizeof(uint32_t));
+		if (!c->pEntry[i].pSeqCmd)
+			goto error;
+	}
+	c->EntryCount = EntryCount;
+	c->MaxSeqLen = MaxSeqLen;
+
+	*cache = c;
+
+	return 0;
+error:
+	if (c->pEntry)
+		for (i = 0; i < EntryCount; i++)
+			no_os_free(c->pEntry[i].pSeqCmd);
+	no_os_free(c->pEntry);
+	no_os_free(c);
+
+	return -ENOMEM;
+}
+
+/**
+ * @brief Free the resources allocated by ad5940_seq_cache_init().
+ * @param cache - The cache descriptor.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+int ad5940_seq_cache_remove(struct ad5940_seq_cache *cache)
+{
+	uint32_t i;
+
+	if (!cache)
+		return -EINVAL;
+
+	for (i = 0; i < cache->EntryCount; i++)
+		no_os_free(cache->pEntry[i].pSeqCmd);
+	no_os_free(cache->pEntry);
+	no_os_free(cache);
+
+	return 0;
+}
+
+/**
+ * @brief Accumulate configuration data into a sequence cache key (FNV-1a).
+ * @param Key - Key computed so far, 0 to start a new key.
+ * @param pData - Configuration data.
+ * @param Len - Size of the data in bytes.
+ * @return The updated key.
+ */
+uint32_t ad5940_seq_cache_key(uint32_t Key, const void *pData, uint32_t Len)
+{
+	const uint8_t *p = pData;
+
+	if (!Key)
+		Key = 2166136261u;
+
+	while (Len--) {
+		Key ^= *p++;
+		Key *= 16777619u;
+	}
+
+	return Key;
+}
+
+/**
+ * @brief Look up a compiled sequence.
+ * @param cache - The cache descriptor.
+ * @param Key - Configuration key of the sequence.
+ * @param ppSeqCmd - Set to the cached commands. Valid until the entry is
+ * 		     evicted by ad5940_seq_cache_put().
+ * @param pSeqLen - Set to the number of cached commands.
+ * @return 0 in case of success, -ENOENT if the sequence is not cached.
+ */
+int ad5940_seq_cache_get(struct ad5940_seq_cache *cache, uint32_t Key,
+			 const uint32_t **ppSeqCmd, uint32_t *pSeqLen)
+{
+	struct ad5940_seq_cache_entry *e;
+	uint32_t i;
+
+	if (!cache || !ppSeqCmd || !pSeqLen)
+		return -EINVAL;
+
+	for (i = 0; i < cache->EntryCount; i++) {
+		e = &cache->pEntry[i];
+		if (e->SeqLen && e->Key == Key) {
+			e->LastUse = ++cache->Tick;
+			*ppSeqCmd = e->pSeqCmd;
+			*pSeqLen = e->SeqLen;
+			cache->Hits++;
+			return 0;
+		}
+	}
+	cache->Misses++;
+
+	return -ENOENT;
+}
+
+/**
+ * @brief Store a compiled sequence, evicting the least recently used one if
+ * the cache is full.
+ * @param cache - The cache descriptor.
+ * @param Key - Configuration key of the sequence.
+ * @param pSeqCmd - Sequence commands.
+ * @param SeqLen - Number of commands.
+ * @return 0 in case of success, -E2BIG if the sequence does not fit an entry.
+ */
+int ad5940_seq_cache_put(struct ad5940_seq_cache *cache, uint32_t Key,
+			 const uint32_t *pSeqCmd, uint32_t SeqLen)
+{
+	struct ad5940_seq_cache_entry *e = NULL;
+	uint32_t i;
+
+	if (!cache || !pSeqCmd || !SeqLen)
+		return -EINVAL;
+
+	if (SeqLen > cache->MaxSeqLen)
+		return -E2BIG;
+
+	for (i = 0; i < cache->EntryCount; i++) {
+		if (cache->pEntry[i].Key == Key || !cache->pEntry[i].SeqLen) {
+			e = &cache->pEntry[i];
+			break;
+		}
+		if (!e || cache->pEntry[i].LastUse < e->LastUse)
+			e = &cache->pEntry[i];
+	}
+
+	memcpy(e->pSeqCmd, pSeqCmd, SeqLen * sizeof(*pSeqCmd));
+	e->Key = Key;
+	e->SeqLen = SeqLen;
+	e->LastUse = ++cache->Tick;
+
+	return 0;
+}
+
 /**
  * @} Sequencer_Generator_Functions
  */
@@ -645,30 +807,26 @@ static int AD5940_SPIReadReg(struct no_os_spi_desc *spi, uint16_t RegAddr,
 	return 0;
 }
 
-static int AD5940_FIFORd_Fast(struct no_os_spi_desc *spi, uint32_t *pBuffer,
+static int AD5940_FIFORd_Fast(struct ad5940_dev *dev, uint32_t *pBuffer,
 			      uint32_t uiReadCount)
 {
 	int ret;
-	static uint32_t iobuf_alloc_sz = 0;
 	uint32_t iobuf_sz = 7 + uiReadCount * sizeof(uiReadCount);
-	static uint8_t *iobuf;
-	uint8_t *buf;
+	uint8_t *iobuf;
 	uint32_t i = 0;
 	uint32_t s = 0;
 
-	if (!iobuf_alloc_sz) {
+	/* The bounce buffer only grows, so a steady stream never allocates */
+	if (dev->fifo_buf_size < iobuf_sz) {
 		iobuf = no_os_malloc(iobuf_sz);
 		if (!iobuf)
 			return -ENOMEM;
-	}
 
-	if (iobuf_alloc_sz < iobuf_sz) {
-		buf = realloc(iobuf, iobuf_sz);
-		if (!buf)
-			return -ENOMEM;
-
-		iobuf = buf;
+		no_os_free(dev->fifo_buf);
+		dev->fifo_buf = iobuf;
+		dev->fifo_buf_size = iobuf_sz;
 	}
+	iobuf = dev->fifo_buf;
 
 	// zero-out everything, needed for bytes 1 through 6 (dummy bytes).
 	memset(iobuf, 0, iobuf_sz);
@@ -677,7 +835,7 @@ static int AD5940_FIFORd_Fast(struct no_os_spi_desc *spi, uint32_t *pBuffer,
 	// set the MOSI output during last two samples to 0x44444444 for each.
 	memset(&iobuf[iobuf_sz - 8], 0x44, 8);
 
-	ret = no_os_spi_write_and_read(spi, iobuf, iobuf_sz);
+	ret = no_os_spi_write_and_read(dev->spi, iobuf, iobuf_sz);
 	if (ret)
 		return ret;
 
@@ -698,7 +856,7 @@ static int AD5940_FIFORd_Fast(struct no_os_spi_desc *spi, uint32_t *pBuffer,
 int ad5940_FIFORd(struct ad5940_dev *dev, uint32_t *pBuffer,
 		  uint32_t uiReadCount)
 {
-	int ret;
+	int ret = 0;
 	if (!dev)
 		return -EINVAL;
 
@@ -715,7 +873,7 @@ int ad5940_FIFORd(struct ad5940_dev *dev, uint32_t *pBuffer,
 		if (ret)
 			return ret;
 
-		ret = AD5940_FIFORd_Fast(dev->spi, pBuffer, uiReadCount);
+		ret = AD5940_FIFORd_Fast(dev, pBuffer, uiReadCount);
 	}
 
 	return ret;
@@ -3941,6 +3941,11 @@ typedef struct {
 	uint32_t RegValue : 24; /* Reg data is limited to 24bit by sequencer  */
 } SEQGenRegInfo_Type;
 
+/* Number of registers the sequencer can address */
+#define AD5940_SEQGEN_NB_REGS	256
+/* Marks a register which is not tracked yet in SeqGen.RegSlot */
+#define AD5940_SEQGEN_NO_SLOT	0xFFFF
+
 /**
  * Sequencer generator data base.
  */
@@ -3953,6 +3958,31 @@ struct SeqGen {
 	SEQGenRegInfo_Type *pRegInfo;
 	uint32_t RegCount;
 	int LastError;
+	/* Insertion order of each tracked register, indexed by its 8bit address */
+	uint16_t RegSlot[AD5940_SEQGEN_NB_REGS];
+};
+
+/**
+ * Compiled sequence cache entry.
+ */
+struct ad5940_seq_cache_entry {
+	uint32_t Key;       /* Configuration key, see ad5940_seq_cache_key() */
+	uint32_t *pSeqCmd;  /* Copy of the sequence commands */
+	uint32_t SeqLen;    /* Number of commands, 0 if the entry is free */
+	uint32_t LastUse;   /* Used to evict the least recently used entry */
+};
+
+/**
+ * Compiled sequence cache. Stores generated sequences so they can be written
+ * to SRAM again without running the sequence generator.
+ */
+struct ad5940_seq_cache {
+	struct ad5940_seq_cache_entry *pEntry;
+	uint32_t EntryCount;
+	uint32_t MaxSeqLen;  /* Maximum number of commands of an entry */
+	uint32_t Tick;
+	uint32_t Hits;
+	uint32_t Misses;
 };
 
 /**
@@ -3972,6 +4002,9 @@ struct ad5940_dev {
 	struct no_os_gpio_desc *reset_gpio;
 	struct no_os_gpio_desc *gp0_gpio;
 	struct SeqGen SeqGenDB;
+	/* Bounce buffer of the fast FIFO read */
+	uint8_t *fifo_buf;
+	uint32_t fifo_buf_size;
 };
 
 /**
@@ -4131,6 +4164,15 @@ int ad5940_SEQGenInsert(struct ad5940_dev *dev,
 			uint32_t CmdWord); /* Manually insert a sequence command */
 int ad5940_SEQGenFetchSeq(struct ad5940_dev *dev, const uint32_t **ppSeqCmd,
 			  uint32_t *pSeqCount);  /* Fetch generated sequence and start a new sequence */
+/* Compiled sequence cache */
+int ad5940_seq_cache_init(struct ad5940_seq_cache **cache, uint32_t EntryCount,
+			  uint32_t MaxSeqLen);
+int ad5940_seq_cache_remove(struct ad5940_seq_cache *cache);
+uint32_t ad5940_seq_cache_key(uint32_t Key, const void *pData, uint32_t Len);
+int ad5940_seq_cache_get(struct ad5940_seq_cache *cache, uint32_t Key,
+			 const uint32_t **ppSeqCmd, uint32_t *pSeqLen);
+int ad5940_seq_cache_put(struct ad5940_seq_cache *cache, uint32_t Key,
+			 const uint32_t *pSeqCmd, uint32_t SeqLen);
 int ad5940_ClksCalculate(struct ad5940_dev *dev, ClksCalInfo_Type *pFilterInfo,
 			 uint32_t *pClocks);  /* @todo add notch filter calculation. Calculate how much clocks to reach n points of data */
 void ad5940_SweepNext(struct ad5940_dev *dev, SoftSweepCfg_Type *pSweepCfg,
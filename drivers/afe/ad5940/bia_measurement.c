@@ -181,6 +181,120 @@ int AppBiaCtrl(struct ad5940_dev *dev, int32_t BcmCtrl, void *pPara)
 	return ret;
 }
 
+/* Restart the frequency sweep and return the first excitation frequency */
+static float AppBiaSweepReset(struct ad5940_dev *dev)
+{
+	if (AppBiaCfg.SweepCfg.SweepEn == true) {
+		AppBiaCfg.FreqofData = AppBiaCfg.SweepCfg.SweepStart;
+		AppBiaCfg.SweepCurrFreq = AppBiaCfg.SweepCfg.SweepStart;
+		ad5940_SweepNext(dev, &AppBiaCfg.SweepCfg, &AppBiaCfg.SweepNextFreq);
+		return AppBiaCfg.SweepCurrFreq;
+	}
+
+	AppBiaCfg.FreqofData = AppBiaCfg.SinFreq;
+
+	return AppBiaCfg.SinFreq;
+}
+
+/* Key of the sequence SeqId in the compiled sequence cache */
+static uint32_t AppBiaSeqKey(uint32_t SeqId)
+{
+	struct {
+		uint32_t SeqStartAddr;
+		uint32_t ExcitBufGain;
+		uint32_t HsDacGain;
+		uint32_t HsDacUpdateRate;
+		uint32_t CtiaSel;
+		uint32_t HstiaRtiaSel;
+		uint32_t ADCPgaGain;
+		uint32_t DftNum;
+		uint32_t DftSrc;
+		uint32_t SeqId;
+		float SinFreq;
+		float DacVoltPP;
+		float SysClkFreq;
+		float AdcClkFreq;
+		uint8_t ADCSinc3Osr;
+		uint8_t ADCSinc2Osr;
+		bool HanWinEn;
+		bool bImpedanceReadMode;
+	} cfg;
+
+	/* Clear the padding, the key covers the whole structure */
+	memset(&cfg, 0, sizeof(cfg));
+	cfg.SeqStartAddr = AppBiaCfg.SeqStartAddr;
+	cfg.ExcitBufGain = AppBiaCfg.ExcitBufGain;
+	cfg.HsDacGain = AppBiaCfg.HsDacGain;
+	cfg.HsDacUpdateRate = AppBiaCfg.HsDacUpdateRate;
+	cfg.CtiaSel = AppBiaCfg.CtiaSel;
+	cfg.HstiaRtiaSel = AppBiaCfg.HstiaRtiaSel;
+	cfg.ADCPgaGain = AppBiaCfg.ADCPgaGain;
+	cfg.DftNum = AppBiaCfg.DftNum;
+	cfg.DftSrc = AppBiaCfg.DftSrc;
+	cfg.SeqId = SeqId;
+	cfg.SinFreq = AppBiaCfg.SweepCfg.SweepEn ? AppBiaCfg.SweepCfg.SweepStart :
+		      AppBiaCfg.SinFreq;
+	cfg.DacVoltPP = AppBiaCfg.DacVoltPP;
+	cfg.SysClkFreq = AppBiaCfg.SysClkFreq;
+	cfg.AdcClkFreq = AppBiaCfg.AdcClkFreq;
+	cfg.ADCSinc3Osr = AppBiaCfg.ADCSinc3Osr;
+	cfg.ADCSinc2Osr = AppBiaCfg.ADCSinc2Osr;
+	cfg.HanWinEn = AppBiaCfg.HanWinEn;
+	cfg.bImpedanceReadMode = AppBiaCfg.bImpedanceReadMode;
+
+	return ad5940_seq_cache_key(0, &cfg, sizeof(cfg));
+}
+
+/* Keep a copy of a generated sequence. The cache is only an optimization, a
+ * sequence which does not fit is generated again next time. */
+static void AppBiaSeqCachePut(uint32_t SeqId, const uint32_t *pSeqCmd,
+			      uint32_t SeqLen)
+{
+	if (AppBiaCfg.SeqCache)
+		ad5940_seq_cache_put(AppBiaCfg.SeqCache, AppBiaSeqKey(SeqId), pSeqCmd,
+				     SeqLen);
+}
+
+/* Write the init and measurement sequences of the current configuration from
+ * the cache to SRAM. Returns -ENOENT if they have to be generated. */
+static int AppBiaSeqCacheLoad(struct ad5940_dev *dev)
+{
+	int ret;
+	const uint32_t *pInitCmd, *pMeasureCmd;
+	uint32_t InitLen, MeasureLen;
+
+	if (!AppBiaCfg.SeqCache)
+		return -ENOENT;
+
+	ret = ad5940_seq_cache_get(AppBiaCfg.SeqCache, AppBiaSeqKey(SEQID_1),
+				   &pInitCmd, &InitLen);
+	if (ret)
+		return ret;
+	ret = ad5940_seq_cache_get(AppBiaCfg.SeqCache, AppBiaSeqKey(SEQID_0),
+				   &pMeasureCmd, &MeasureLen);
+	if (ret)
+		return ret;
+
+	AppBiaSweepReset(dev);
+
+	AppBiaCfg.InitSeqInfo.SeqId = SEQID_1;
+	AppBiaCfg.InitSeqInfo.SeqRamAddr = AppBiaCfg.SeqStartAddr;
+	AppBiaCfg.InitSeqInfo.pSeqCmd = pInitCmd;
+	AppBiaCfg.InitSeqInfo.SeqLen = InitLen;
+	ret = ad5940_SEQCmdWrite(dev, AppBiaCfg.InitSeqInfo.SeqRamAddr, pInitCmd,
+				 InitLen);
+	if (ret < 0)
+		return ret;
+
+	AppBiaCfg.MeasureSeqInfo.SeqId = SEQID_0;
+	AppBiaCfg.MeasureSeqInfo.SeqRamAddr = AppBiaCfg.SeqStartAddr + InitLen;
+	AppBiaCfg.MeasureSeqInfo.pSeqCmd = pMeasureCmd;
+	AppBiaCfg.MeasureSeqInfo.SeqLen = MeasureLen;
+
+	return ad5940_SEQCmdWrite(dev, AppBiaCfg.MeasureSeqInfo.SeqRamAddr,
+				  pMeasureCmd, MeasureLen);
+}
+
 /* Generate init sequence */
 static int AppBiaSeqCfgGen(struct ad5940_dev *dev)
 {
@@ -237,15 +351,7 @@ static int AppBiaSeqCfgGen(struct ad5940_dev *dev)
 	hs_loop.WgCfg.WgType = WGTYPE_SIN;
 	hs_loop.WgCfg.GainCalEn = false;
 	hs_loop.WgCfg.OffsetCalEn = false;
-	if (AppBiaCfg.SweepCfg.SweepEn == true) {
-		AppBiaCfg.FreqofData = AppBiaCfg.SweepCfg.SweepStart;
-		AppBiaCfg.SweepCurrFreq = AppBiaCfg.SweepCfg.SweepStart;
-		ad5940_SweepNext(dev, &AppBiaCfg.SweepCfg, &AppBiaCfg.SweepNextFreq);
-		sin_freq = AppBiaCfg.SweepCurrFreq;
-	} else {
-		sin_freq = AppBiaCfg.SinFreq;
-		AppBiaCfg.FreqofData = sin_freq;
-	}
+	sin_freq = AppBiaSweepReset(dev);
 	hs_loop.WgCfg.SinCfg.SinFreqWord = ad5940_WGFreqWordCal(sin_freq,
 					   AppBiaCfg.SysClkFreq);
 	hs_loop.WgCfg.SinCfg.SinAmplitudeWord = (uint32_t)(AppBiaCfg.DacVoltPP / 800.0f
@@ -338,6 +444,9 @@ static int AppBiaSeqCfgGen(struct ad5940_dev *dev)
 	if (ret < 0)
 		return ret;
 
+	/* The measurement sequence reuses the buffer, copy it now */
+	AppBiaSeqCachePut(SEQID_1, pSeqCmd, SeqLen);
+
 	AppBiaCfg.InitSeqInfo.SeqId = SEQID_1;
 	AppBiaCfg.InitSeqInfo.SeqRamAddr = AppBiaCfg.SeqStartAddr;
 	AppBiaCfg.InitSeqInfo.pSeqCmd = pSeqCmd;
@@ -474,6 +583,8 @@ static int AppBiaSeqMeasureGen(struct ad5940_dev *dev, bool bImpedanceMode)
 	if (ret < 0)
 		return ret;
 
+	AppBiaSeqCachePut(SEQID_0, pSeqCmd, SeqLen);
+
 	AppBiaCfg.MeasureSeqInfo.SeqId = SEQID_0;
 	AppBiaCfg.MeasureSeqInfo.SeqRamAddr = AppBiaCfg.InitSeqInfo.SeqRamAddr +
 					      AppBiaCfg.InitSeqInfo.SeqLen;
@@ -596,18 +707,23 @@ int AppBiaInit(struct ad5940_dev *dev, uint32_t *pBuffer, uint32_t BufferSize)
 			return -EINVAL;
 		if (BufferSize == 0)
 			return -EINVAL;
-		ret = ad5940_SEQGenInit(dev, pBuffer, BufferSize);
-		if (ret < 0)
-			return ret;
 
-		/* Generate initialize sequence */
-		ret = AppBiaSeqCfgGen(
-			      dev); /* Application initialization sequence using either MCU or sequencer */
-		if (ret < 0)
-			return ret;
+		/* Going back to a known configuration only reloads SRAM */
+		ret = AppBiaSeqCacheLoad(dev);
+		if (ret == -ENOENT) {
+			ret = ad5940_SEQGenInit(dev, pBuffer, BufferSize);
+			if (ret < 0)
+				return ret;
 
-		/* Generate measurement sequence */
-		ret = AppBiaSeqMeasureGen(dev, AppBiaCfg.bImpedanceReadMode);
+			/* Generate initialize sequence */
+			ret = AppBiaSeqCfgGen(
+				      dev); /* Application initialization sequence using either MCU or sequencer */
+			if (ret < 0)
+				return ret;
+
+			/* Generate measurement sequence */
+			ret = AppBiaSeqMeasureGen(dev, AppBiaCfg.bImpedanceReadMode);
+		}
 		if (ret < 0)
 			return ret;
 	}
@@ -665,7 +781,11 @@ static int AppEITRegModify(struct ad5940_dev *dev, int32_t * const pData,
 		return ad5940_WUPTCtrl(dev, false);
 	}
 	if (AppBiaCfg.SweepCfg.SweepEn) { /* Need to set new frequency and set power mode */
-		return ad5940_WGFreqCtrlS(dev, AppBiaCfg.SweepNextFreq, AppBiaCfg.SysClkFreq);
+		/* The data just read was measured at the current frequency */
+		AppBiaCfg.FreqofData = AppBiaCfg.SweepCurrFreq;
+		AppBiaCfg.SweepCurrFreq = AppBiaCfg.SweepNextFreq;
+		ad5940_SweepNext(dev, &AppBiaCfg.SweepCfg, &AppBiaCfg.SweepNextFreq);
+		return ad5940_WGFreqCtrlS(dev, AppBiaCfg.SweepCurrFreq, AppBiaCfg.SysClkFreq);
 	}
 	return 0;
 }
@@ -729,6 +849,7 @@ int AppBiaISR(struct ad5940_dev *dev, void *pBuff, uint32_t *pCount)
 	int ret;
 	uint32_t BuffCount;
 	uint32_t FifoCnt;
+	uint32_t DataWords;
 	if (!pBuff || !pCount)
 		return -EINVAL;
 	BuffCount = *pCount;
@@ -749,10 +870,12 @@ int AppBiaISR(struct ad5940_dev *dev, void *pBuff, uint32_t *pCount)
 		ret = ad5940_FIFOGetCnt(dev, &FifoCnt); //(AD5940_FIFOGetCnt()/4)*4;
 		if (ret < 0)
 			return ret;
-		if (FifoCnt > BuffCount) {
-			///@todo buffer is limited.
-			FifoCnt = AppBiaCfg.FifoThresh;
-		}
+		if (FifoCnt > BuffCount)
+			FifoCnt = BuffCount;
+		/* Only read complete measurements, a partial one stays in the FIFO
+		 * until the sequencer writes the rest of it */
+		DataWords = AppBiaCfg.bImpedanceReadMode ? 4 : 2;
+		FifoCnt -= FifoCnt % DataWords;
 		// Read FifoCnt of fifo contents and store to pBuff
 		ret = ad5940_FIFORd(dev, (uint32_t *)pBuff, FifoCnt);
 		if (ret < 0)
@@ -53,6 +53,7 @@ typedef struct {
 	uint32_t MaxSeqLen;       /* Limit the maximum sequence.   */
 	uint32_t SeqStartAddrCal; /* Measurment sequence start address in SRAM of AD5940 */
 	uint32_t MaxSeqLenCal;
+	struct ad5940_seq_cache *SeqCache; /* Optional. Compiled sequences, two entries per configuration */
 	/* Application related parameters */
 	//bool bBioElecBoard;     /* The code is same for BioElec board and AD5941Sens1 board. No changes are needed */
 	bool bParamsChanged;       /* Indicate to generate sequence again. It's auto cleared by AppBiaInit */
@@ -67,7 +67,7 @@ static int ad5940_iio_read_chan_raw(void *device, char *buf, uint32_t len,
 	float fMagVal;
 	uint32_t timeout = 100;
 	uint8_t gpio;
-	uint32_t count = 0;
+	uint32_t count = NO_OS_ARRAY_SIZE(iiodev->AppBuff);
 
 	AppBiaGetCfg(&pBiaCfg);
 	if (pBiaCfg->bParamsChanged)
@@ -231,6 +231,116 @@ int ad5940_iio_set_attr(void *device, char *buf, uint32_t len,
 	return 0;
 }
 
+static int32_t ad5940_iio_pre_enable(void *device, uint32_t mask)
+{
+	struct ad5940_iio_dev *iiodev = (struct ad5940_iio_dev *)device;
+	AppBiaCfg_Type *pBiaCfg;
+	uint32_t words, batch;
+	int ret;
+
+	AppBiaGetCfg(&pBiaCfg);
+
+	/* The bia channel is only read through its raw attribute */
+	if (mask & NO_OS_BIT(0))
+		return -EINVAL;
+
+	/* The current is only measured in impedance mode */
+	if (!pBiaCfg->bImpedanceReadMode &&
+	    (mask & (NO_OS_BIT(AD5940_IIO_SCAN_I_REAL) |
+		     NO_OS_BIT(AD5940_IIO_SCAN_I_IMAG))))
+		return -EINVAL;
+
+	if (pBiaCfg->bParamsChanged) {
+		ret = AppBiaInit(iiodev->ad5940, iiodev->AppBuff,
+				 NO_OS_ARRAY_SIZE(iiodev->AppBuff));
+		if (ret < 0)
+			return ret;
+	}
+
+	ret = ad5940_WakeUp(iiodev->ad5940, 10);
+	if (ret < 0)
+		return ret;
+	if (ret > 10)
+		return -EIO;
+
+	/* Interrupt once per batch of measurements, the sweep moves to the next
+	 * frequency on every interrupt */
+	words = pBiaCfg->bImpedanceReadMode ? 4 : 2;
+	batch = pBiaCfg->SweepCfg.SweepEn ? 1 : iiodev->fifo_batch;
+	ret = ad5940_FIFOThrshSet(iiodev->ad5940, words * batch);
+	if (ret < 0)
+		return ret;
+
+	return AppBiaCtrl(iiodev->ad5940, BIACTRL_START, 0);
+}
+
+static int32_t ad5940_iio_post_disable(void *device)
+{
+	struct ad5940_iio_dev *iiodev = (struct ad5940_iio_dev *)device;
+	AppBiaCfg_Type *pBiaCfg;
+	int ret;
+
+	AppBiaGetCfg(&pBiaCfg);
+
+	ret = AppBiaCtrl(iiodev->ad5940, BIACTRL_STOPNOW, 0);
+	if (ret < 0)
+		return ret;
+
+	/* Drop the measurements left in the FIFO and go back to one measurement
+	 * per interrupt for raw reads */
+	ret = ad5940_FIFOCtrlS(iiodev->ad5940, FIFOSRC_DFT, false);
+	if (ret < 0)
+		return ret;
+	ret = ad5940_FIFOCtrlS(iiodev->ad5940, FIFOSRC_DFT, true);
+	if (ret < 0)
+		return ret;
+	ret = ad5940_FIFOThrshSet(iiodev->ad5940, pBiaCfg->FifoThresh);
+	if (ret < 0)
+		return ret;
+
+	return ad5940_INTCClrFlag(iiodev->ad5940, AFEINTSRC_DATAFIFOTHRESH);
+}
+
+/**
+ * @brief Drain the DFT data FIFO in one burst and push one scan per
+ * measurement. Called on the FIFO threshold interrupt.
+ * @param dev_data - The iio device data structure.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+static int32_t ad5940_iio_trigger_handler(struct iio_device_data *dev_data)
+{
+	struct ad5940_iio_dev *iiodev = (struct ad5940_iio_dev *)dev_data->dev;
+	uint32_t count = NO_OS_ARRAY_SIZE(iiodev->AppBuff);
+	uint32_t scan[AD5940_IIO_NUM_CHAN - 1];
+	AppBiaCfg_Type *pBiaCfg;
+	uint32_t words, i, ch, k;
+	int ret;
+
+	AppBiaGetCfg(&pBiaCfg);
+
+	ret = AppBiaISR(iiodev->ad5940, iiodev->AppBuff, &count);
+	if (ret < 0)
+		return ret;
+
+	signExtend18To32(iiodev->AppBuff, count);
+
+	/* V real, V imag and, in impedance mode, I real, I imag */
+	words = pBiaCfg->bImpedanceReadMode ? 4 : 2;
+	for (i = 0; i < count; i += words) {
+		k = 0;
+		for (ch = 0; ch < words; ch++)
+			if (dev_data->buffer->active_mask &
+			    NO_OS_BIT(AD5940_IIO_SCAN_V_REAL + ch))
+				scan[k++] = iiodev->AppBuff[i + ch];
+
+		ret = iio_buffer_push_scan(dev_data->buffer, scan);
+		if (ret < 0)
+			return ret;
+	}
+
+	return 0;
+}
+
 struct iio_attribute ad5940_iio_global_attr[] = {
 	{
 		.name = "impedance_mode",
@@ -269,8 +379,9 @@ static struct iio_device ad5940_iio_device = {
 	.attributes = ad5940_iio_global_attr,
 	.debug_attributes = NULL,
 	.buffer_attributes = NULL,
-	.pre_enable = NULL,
-	.post_disable = NULL,
+	.pre_enable = ad5940_iio_pre_enable,
+	.post_disable = ad5940_iio_post_disable,
+	.trigger_handler = ad5940_iio_trigger_handler,
 	.read_dev = NULL,
 	.debug_reg_read = (int32_t (*)())_ad5940_read_register2,
 	.debug_reg_write = (int32_t (*)())_ad5940_write_register2
@@ -284,6 +395,21 @@ static struct iio_attribute ad5940_channel_attributes[] = {
 	END_ATTRIBUTES_ARRAY
 };
 
+static struct scan_type ad5940_iio_scan_type = {
+	.sign = 's',
+	.realbits = 18,
+	.storagebits = 32,
+	.shift = 0,
+	.is_big_endian = false,
+};
+
+static const char * const ad5940_iio_scan_names[] = {
+	[AD5940_IIO_SCAN_V_REAL] = "v_real",
+	[AD5940_IIO_SCAN_V_IMAG] = "v_imag",
+	[AD5940_IIO_SCAN_I_REAL] = "i_real",
+	[AD5940_IIO_SCAN_I_IMAG] = "i_imag",
+};
+
 int32_t ad5940_iio_init(struct ad5940_iio_dev **iio_dev,
 			struct ad5940_iio_init_param *init_param)
 {
@@ -295,17 +421,24 @@ int32_t ad5940_iio_init(struct ad5940_iio_dev **iio_dev,
 	if (!iio_dev || !init_param)
 		return -EINVAL;
 
+	/* A batch of impedance measurements must fit AppBuff */
+	if (init_param->fifo_batch > NO_OS_ARRAY_SIZE(desc->AppBuff) / 4)
+		return -EINVAL;
+
 	desc = (struct ad5940_iio_dev *)no_os_calloc(1, sizeof(*desc));
 	if (!desc)
 		return -ENOMEM;
 
 	desc->iio = &ad5940_iio_device;
+	desc->fifo_batch = init_param->fifo_batch ? init_param->fifo_batch : 1;
 
-	desc->iio->channels = (struct iio_channel *)no_os_calloc(1,
+	desc->iio->channels = (struct iio_channel *)no_os_calloc(AD5940_IIO_NUM_CHAN,
 			      sizeof(struct iio_channel));
-	if (!desc->iio->channels)
+	if (!desc->iio->channels) {
+		ret = -ENOMEM;
 		goto error_1;
-	desc->iio->num_ch = 1;
+	}
+	desc->iio->num_ch = AD5940_IIO_NUM_CHAN;
 
 	ch = 0;
 	desc->iio->channels[ch].name = "bia";
@@ -313,12 +446,31 @@ int32_t ad5940_iio_init(struct ad5940_iio_dev **iio_dev,
 	desc->iio->channels[ch].indexed = true;
 	desc->iio->channels[ch].attributes = ad5940_channel_attributes;
 
+	/* DFT results, pushed to the buffer on FIFO threshold interrupts */
+	for (ch = AD5940_IIO_SCAN_V_REAL; ch < AD5940_IIO_NUM_CHAN; ch++) {
+		desc->iio->channels[ch].name = ad5940_iio_scan_names[ch];
+		desc->iio->channels[ch].ch_type = IIO_VOLTAGE;
+		desc->iio->channels[ch].channel = ch;
+		desc->iio->channels[ch].scan_index = ch - AD5940_IIO_SCAN_V_REAL;
+		desc->iio->channels[ch].scan_type = &ad5940_iio_scan_type;
+		desc->iio->channels[ch].indexed = true;
+	}
+
+	if (init_param->seq_cache_entries) {
+		ret = ad5940_seq_cache_init(&desc->seq_cache,
+					    init_param->seq_cache_entries,
+					    NO_OS_ARRAY_SIZE(desc->AppBuff));
+		if (ret)
+			goto error_2;
+	}
+
 	ret = ad5940_init(&desc->ad5940, init_param->ad5940_init);
 	if (ret)
-		goto error_2;
+		goto error_3;
 
 	AppBiaGetCfg(&pBiaCfg);
 	pBiaCfg->bParamsChanged = true;
+	pBiaCfg->SeqCache = desc->seq_cache;
 
 	pBiaCfg->SeqStartAddr = 0;
 	pBiaCfg->MaxSeqLen = 512; /** @todo add checker in function */
@@ -342,11 +494,17 @@ int32_t ad5940_iio_init(struct ad5940_iio_dev **iio_dev,
 
 	ret = AppBiaInit(desc->ad5940, desc->AppBuff, 512);
 	if (ret < 0)
-		goto error_2;
+		goto error_4;
 
 	*iio_dev = desc;
 
 	return 0;
+error_4:
+	pBiaCfg->SeqCache = NULL;
+	ad5940_remove(desc->ad5940);
+error_3:
+	if (desc->seq_cache)
+		ad5940_seq_cache_remove(desc->seq_cache);
 error_2:
 	no_os_free(desc->iio->channels);
 error_1:
@@ -358,11 +516,18 @@ error_1:
 int32_t ad5940_iio_remove(struct ad5940_iio_dev *desc)
 {
 	int32_t ret;
+	AppBiaCfg_Type *pBiaCfg;
 
 	ret = ad5940_remove(desc->ad5940);
 	if (ret != 0)
 		return ret;
 
+	if (desc->seq_cache) {
+		AppBiaGetCfg(&pBiaCfg);
+		pBiaCfg->SeqCache = NULL;
+		ad5940_seq_cache_remove(desc->seq_cache);
+	}
+
 	no_os_free(desc->iio->channels);
 	no_os_free(desc);
 
@@ -44,18 +44,37 @@ enum ad5940_iio_attr {
 	AD5940_IIO_GPIO1_TOGGLE,
 };
 
+/* Buffer channels, following the raw "bia" channel at index 0 */
+enum ad5940_iio_scan_chan {
+	AD5940_IIO_SCAN_V_REAL = 1,
+	AD5940_IIO_SCAN_V_IMAG,
+	AD5940_IIO_SCAN_I_REAL,
+	AD5940_IIO_SCAN_I_IMAG,
+	AD5940_IIO_NUM_CHAN,
+};
+
 struct ad5940_iio_dev {
 	struct ad5940_dev *ad5940;
 	struct iio_device *iio;
 	bool magnitude_mode;
 	bool gpio1;
+	/* Measurements per FIFO threshold interrupt while buffering */
+	uint32_t fifo_batch;
+	struct ad5940_seq_cache *seq_cache;
 	uint32_t AppBuff[512];
 };
 
 struct ad5940_iio_init_param {
 	struct ad5940_init_param *ad5940_init;
+	/* Measurements read per FIFO interrupt while buffering, 0 means 1. Only
+	 * used without frequency sweep, which changes frequency on every read */
+	uint32_t fifo_batch;
+	/* Number of compiled sequences kept, 0 disables the sequence cache */
+	uint32_t seq_cache_entries;
 };
 
+extern struct iio_trigger ad5940_iio_trig_desc;
+
 int32_t ad5940_iio_init(struct ad5940_iio_dev **iio_dev,
 			struct ad5940_iio_init_param *init_param);
 int32_t ad5940_iio_remove(struct ad5940_iio_dev *desc);
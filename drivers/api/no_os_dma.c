@@ -33,6 +33,7 @@
 #include <inttypes.h>
 #include "no_os_dma.h"
 #include <stdlib.h>
+#include <string.h>
 #include "no_os_error.h"
 #include "no_os_mutex.h"
 #include "no_os_irq.h"
@@ -64,6 +65,11 @@ static void default_sg_callback(void *context)
 		return;
 	}
 
+#ifdef NO_OS_BUS_STATS
+	no_os_bus_stats_add(&data->channel->stats, data->channel->stats_start,
+			    data->channel->stats_locked, old_xfer->length, 0);
+#endif
+
 	no_os_list_read_first(data->channel->sg_list, (void **)&next_xfer);
 	no_os_list_get_size(data->channel->sg_list, &list_size);
 	if (old_xfer->xfer_complete_cb)
@@ -363,7 +369,13 @@ int no_os_dma_xfer_start(struct no_os_dma_desc *desc, struct no_os_dma_ch *ch)
 	if (!desc->platform_ops->dma_xfer_start)
 		return -ENOSYS;
 
+#ifdef NO_OS_BUS_STATS
+	ch->stats_start = no_os_bus_stats_now();
+#endif
 	no_os_mutex_lock(ch->mutex);
+#ifdef NO_OS_BUS_STATS
+	ch->stats_locked = no_os_bus_stats_now();
+#endif
 
 	if (desc->irq_ctrl)
 		no_os_irq_enable(desc->irq_ctrl, ch->irq_num);
@@ -447,3 +459,28 @@ bool no_os_dma_in_progress(struct no_os_dma_desc *desc, struct no_os_dma_ch *ch)
 
 	return ret;
 }
+
+#ifdef NO_OS_BUS_STATS
+/**
+ * @brief Get the transfer statistics of a DMA channel. Transfers are only
+ * accounted by the default scatter gather interrupt handler.
+ * @param ch - Reference to the DMA channel.
+ * @param stats - Copy of the statistics.
+ * @param clear - Reset the statistics after copying them.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+int no_os_dma_get_stats(struct no_os_dma_ch *ch, struct no_os_bus_stats *stats,
+			bool clear)
+{
+	if (!ch || !stats)
+		return -EINVAL;
+
+	no_os_mutex_lock(ch->mutex);
+	*stats = ch->stats;
+	if (clear)
+		memset(&ch->stats, 0, sizeof(ch->stats));
+	no_os_mutex_unlock(ch->mutex);
+
+	return 0;
+}
+#endif
@@ -34,6 +34,7 @@
 #include <inttypes.h>
 #include "no_os_i2c.h"
 #include <stdlib.h>
+#include <string.h>
 #include "no_os_error.h"
 #include "no_os_mutex.h"
 #include "no_os_alloc.h"
@@ -161,6 +162,7 @@ int32_t no_os_i2c_write(struct no_os_i2c_desc *desc,
 			uint8_t bytes_number,
 			uint8_t stop_bit)
 {
+	uint32_t start, locked;
 	int32_t ret;
 
 	if (!desc || !desc->platform_ops)
@@ -169,9 +171,12 @@ int32_t no_os_i2c_write(struct no_os_i2c_desc *desc,
 	if (!desc->platform_ops->i2c_ops_write)
 		return -ENOSYS;
 
+	NO_OS_BUS_STATS_STAMP(start);
 	no_os_mutex_lock(desc->bus->mutex);
+	NO_OS_BUS_STATS_STAMP(locked);
 	ret = desc->platform_ops->i2c_ops_write(desc, data, bytes_number,
 						stop_bit);
+	NO_OS_BUS_STATS_ADD(&desc->bus->stats, start, locked, bytes_number, ret);
 	no_os_mutex_unlock(desc->bus->mutex);
 
 	return ret;
@@ -192,6 +197,7 @@ int32_t no_os_i2c_read(struct no_os_i2c_desc *desc,
 		       uint8_t bytes_number,
 		       uint8_t stop_bit)
 {
+	uint32_t start, locked;
 	int32_t ret;
 
 	if (!desc || !desc->platform_ops)
@@ -200,10 +206,43 @@ int32_t no_os_i2c_read(struct no_os_i2c_desc *desc,
 	if (!desc->platform_ops->i2c_ops_read)
 		return -ENOSYS;
 
+	NO_OS_BUS_STATS_STAMP(start);
 	no_os_mutex_lock(desc->bus->mutex);
+	NO_OS_BUS_STATS_STAMP(locked);
 	ret = desc->platform_ops->i2c_ops_read(desc, data, bytes_number,
 					       stop_bit);
+	NO_OS_BUS_STATS_ADD(&desc->bus->stats, start, locked, bytes_number, ret);
 	no_os_mutex_unlock(desc->bus->mutex);
 
 	return ret;
 }
+
+#ifdef NO_OS_BUS_STATS
+/**
+ * @brief Get the transfer statistics of an I2C bus.
+ * @param bus_number - I2C bus number.
+ * @param stats - Copy of the statistics.
+ * @param clear - Reset the statistics after copying them.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+int32_t no_os_i2cbus_get_stats(uint32_t bus_number,
+			       struct no_os_bus_stats *stats, bool clear)
+{
+	struct no_os_i2cbus_desc *bus;
+
+	if (bus_number > I2C_MAX_BUS_NUMBER || !stats)
+		return -EINVAL;
+
+	bus = i2c_table[bus_number];
+	if (!bus)
+		return -ENODEV;
+
+	no_os_mutex_lock(bus->mutex);
+	*stats = bus->stats;
+	if (clear)
+		memset(&bus->stats, 0, sizeof(bus->stats));
+	no_os_mutex_unlock(bus->mutex);
+
+	return 0;
+}
+#endif
@@ -34,6 +34,7 @@
 #include <inttypes.h>
 #include "no_os_spi.h"
 #include <stdlib.h>
+#include <string.h>
 #include "no_os_error.h"
 #include "no_os_mutex.h"
 #include "no_os_alloc.h"
@@ -160,6 +161,7 @@ int32_t no_os_spi_write_and_read(struct no_os_spi_desc *desc,
 				 uint8_t *data,
 				 uint16_t bytes_number)
 {
+	uint32_t start, locked;
 	int32_t ret;
 
 	if (!desc || !desc->platform_ops)
@@ -168,13 +170,72 @@ int32_t no_os_spi_write_and_read(struct no_os_spi_desc *desc,
 	if (!desc->platform_ops->write_and_read)
 		return -ENOSYS;
 
+	NO_OS_BUS_STATS_STAMP(start);
 	no_os_mutex_lock(desc->bus->mutex);
+	NO_OS_BUS_STATS_STAMP(locked);
 	ret =  desc->platform_ops->write_and_read(desc, data, bytes_number);
+	NO_OS_BUS_STATS_ADD(&desc->bus->stats, start, locked, bytes_number, ret);
 	no_os_mutex_unlock(desc->bus->mutex);
 
 	return ret;
 }
 
+#ifdef NO_OS_BUS_STATS
+/**
+ * @brief Account a transfer done by a platform op which handles the bus lock
+ * itself. The lock is only taken to update the counters.
+ * @param desc - The SPI descriptor.
+ * @param msgs - Array of messages.
+ * @param len - Number of messages in the array.
+ * @param start - Timestamp taken before the transfer.
+ * @param ret - Transfer result.
+ */
+static void no_os_spi_stats_add(struct no_os_spi_desc *desc,
+				struct no_os_spi_msg *msgs, uint32_t len,
+				uint32_t start, int32_t ret)
+{
+	uint32_t bytes = 0;
+	uint32_t i;
+
+	for (i = 0; i < len; i++)
+		bytes += msgs[i].bytes_number;
+
+	no_os_mutex_lock(desc->bus->mutex);
+	no_os_bus_stats_add(&desc->bus->stats, start, start, bytes, ret);
+	no_os_mutex_unlock(desc->bus->mutex);
+}
+
+/**
+ * @brief Get the transfer statistics of a SPI bus.
+ * @param bus_number - SPI bus number.
+ * @param stats - Copy of the statistics.
+ * @param clear - Reset the statistics after copying them.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+int32_t no_os_spibus_get_stats(uint32_t bus_number,
+			       struct no_os_bus_stats *stats, bool clear)
+{
+	struct no_os_spibus_desc *bus;
+
+	if (bus_number > SPI_MAX_BUS_NUMBER || !stats)
+		return -EINVAL;
+
+	bus = spi_table[bus_number];
+	if (!bus)
+		return -ENODEV;
+
+	no_os_mutex_lock(bus->mutex);
+	*stats = bus->stats;
+	if (clear)
+		memset(&bus->stats, 0, sizeof(bus->stats));
+	no_os_mutex_unlock(bus->mutex);
+
+	return 0;
+}
+#else
+#define no_os_spi_stats_add(desc, msgs, len, start, ret)	((void)(start))
+#endif
+
 /**
  * @brief  Iterate over head list and send all spi messages
  * @param desc - The SPI descriptor.
@@ -187,13 +248,19 @@ int32_t no_os_spi_transfer(struct no_os_spi_desc *desc,
 			   uint32_t len)
 {
 	int32_t  ret = 0;
+	uint32_t start;
 	uint32_t i;
 
 	if (!desc || !desc->platform_ops)
 		return -EINVAL;
 
-	if (desc->platform_ops->transfer)
-		return desc->platform_ops->transfer(desc, msgs, len);
+	if (desc->platform_ops->transfer) {
+		NO_OS_BUS_STATS_STAMP(start);
+		ret = desc->platform_ops->transfer(desc, msgs, len);
+		no_os_spi_stats_add(desc, msgs, len, start, ret);
+
+		return ret;
+	}
 
 	no_os_mutex_lock(desc->bus->mutex);
 
@@ -225,13 +292,20 @@ int32_t no_os_spi_transfer_dma(struct no_os_spi_desc *desc,
 			       struct no_os_spi_msg *msgs,
 			       uint32_t len)
 {
+	uint32_t start;
+	int32_t ret;
+
 	if (!desc || !desc->platform_ops || !msgs || !len)
 		return -EINVAL;
 
-	if (desc->platform_ops->transfer_dma)
-		return desc->platform_ops->transfer_dma(desc, msgs, len);
+	if (!desc->platform_ops->transfer_dma)
+		return -ENOSYS;
 
-	return -ENOSYS;
+	NO_OS_BUS_STATS_STAMP(start);
+	ret = desc->platform_ops->transfer_dma(desc, msgs, len);
+	no_os_spi_stats_add(desc, msgs, len, start, ret);
+
+	return ret;
 }
 
 /**
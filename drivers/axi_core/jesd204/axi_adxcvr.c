@@ -556,7 +556,7 @@ static void adxcvr_get_info(struct adxcvr *xcvr)
 int32_t adxcvr_init(struct adxcvr **ad_xcvr,
 		    const struct adxcvr_init *init)
 {
-	struct no_os_clk_init_param clk_out_init;
+	struct no_os_clk_init_param clk_out_init = {0};
 	uint32_t synth_conf, xcvr_type;
 	struct adxcvr *xcvr;
 	int32_t ret;
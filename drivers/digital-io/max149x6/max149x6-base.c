@@ -37,6 +37,11 @@
 #include "max149x6-base.h"
 #include "no_os_util.h"
 #include "no_os_alloc.h"
+#include "no_os_crc.h"
+
+#define MAX149X6_CRC5_POLY	0x15
+
+NO_OS_DECLARE_CRC_ENGINE(max149x6_crc5, 5, MAX149X6_CRC5_POLY);
 
 /**
  * @brief Compute the CRC5 value for an array of bytes when writing to MAX149X6
@@ -45,42 +50,30 @@
  */
 static uint8_t max149x6_crc(uint8_t *data, bool encode)
 {
+	uint8_t frame[2] = {data[0], data[1]};
 	uint8_t crc5_start = 0x1f;
-	uint8_t crc5_poly = 0x15;
-	uint8_t crc5_result = crc5_start;
-	uint8_t extra_byte = 0x00;
-	uint8_t data_bit;
-	uint8_t result_bit;
+	uint8_t crc5_result;
 	int i;
 
 	/*
 	 * This is a custom implementation of a CRC5 algorithm, detailed here:
 	 * https://www.analog.com/en/app-notes/how-to-program-the-max14906-quadchannel-industrial-digital-output-digital-input.html
+	 *
+	 * When decoding, the 2 msb of the first byte are not covered. Clearing
+	 * them and starting from 0x10, which becomes 0x1f after 2 zero bits,
+	 * gives the same result on whole bytes.
 	 */
-
-	for (i = (encode) ? 0 : 2; i < 8; i++) {
-		data_bit = (data[0] >> (7 - i)) & 0x01;
-		result_bit = (crc5_result & 0x10) >> 4;
-		if (data_bit ^ result_bit)
-			crc5_result = crc5_poly ^ ((crc5_result << 1) & 0x1f);
-		else
-			crc5_result = (crc5_result << 1) & 0x1f;
+	if (!encode) {
+		frame[0] &= 0x3f;
+		crc5_start = 0x10;
 	}
 
-	for (i = 0; i < 8; i++) {
-		data_bit = (data[1] >> (7 - i)) & 0x01;
-		result_bit = (crc5_result & 0x10) >> 4;
-		if (data_bit ^ result_bit)
-			crc5_result = crc5_poly ^ ((crc5_result << 1) & 0x1f);
-		else
-			crc5_result = (crc5_result << 1) & 0x1f;
-	}
+	crc5_result = no_os_crc_compute(&max149x6_crc5, frame, 2, crc5_start);
 
+	/* 3 trailing zero bits */
 	for (i = 0; i < 3; i++) {
-		data_bit = (extra_byte >> (7 - i)) & 0x01;
-		result_bit = (crc5_result & 0x10) >> 4;
-		if (data_bit ^ result_bit)
-			crc5_result = crc5_poly ^ ((crc5_result << 1) & 0x1f);
+		if (crc5_result & 0x10)
+			crc5_result = MAX149X6_CRC5_POLY ^ ((crc5_result << 1) & 0x1f);
 		else
 			crc5_result = (crc5_result << 1) & 0x1f;
 	}
@@ -1916,7 +1916,7 @@ static int ad9545_aux_tdcs_setup(struct ad9545_dev *dev)
 static int ad9545_aux_dpll_setup(struct ad9545_dev *dev)
 {
 	struct ad9545_aux_dpll_clk *clk;
-	struct no_os_clk_init_param init;
+	struct no_os_clk_init_param init = {0};
 	uint16_t regval;
 	int ret;
 	uint8_t val, i;
@@ -461,6 +461,10 @@ int32_t hmc7044_clk_set_rate(struct hmc7044_dev *dev, uint32_t chan_num,
 	div = hmc7044_calc_out_div(rate, dev->pll2_freq);
 	chan->divider = div;
 
+	/* The channel may be changed without going through no_os_clk. */
+	if (dev->clk_desc)
+		no_os_clk_invalidate(dev->clk_desc[chan->num]);
+
 	ret = hmc7044_write(dev, HMC7044_REG_CH_OUT_CRTL_1(chan->num),
 			    HMC7044_DIV_LSB(div));
 	if (ret < 0)
@@ -1462,7 +1466,7 @@ int32_t hmc7044_init(struct hmc7044_dev **device,
 	int32_t ret;
 	unsigned int i;
 	struct no_os_clk_desc **clocks = NULL;
-	struct no_os_clk_init_param clk_init;
+	struct no_os_clk_init_param clk_init = {0};
 	const char *names[HMC7044_NUM_CHAN] = {
 		"clock_0", "clock_1", "clock_2", "clock_3", "clock_4",
 		"clock_5", "clock_6", "clock_7", "clock_8", "clock_9",
@@ -1490,6 +1494,8 @@ int32_t hmc7044_init(struct hmc7044_dev **device,
 			clk_init.hw_ch_num = i;
 			clk_init.platform_ops = &hmc7044_clk_ops;
 			clk_init.dev_desc = dev;
+			/* hmc7044_clk_set_rate() drops the cached rate */
+			clk_init.flags = NO_OS_CLK_F_CACHE_RATE;
 
 			ret = no_os_clk_init(&clocks[i], &clk_init);
 			if (ret)
@@ -1686,6 +1692,75 @@ int32_t hmc7044_set_rate(struct no_os_clk_desc *desc,
 				    rate);
 }
 
+/**
+ * @brief Set the rates of several channels. All the dividers are computed
+ * first, then written in a single SPI transfer.
+ *
+ * @param descs - The CLK descriptors, all of the same device.
+ * @param rates - The desired rates.
+ * @param nb - Number of clocks.
+ *
+ * @return 0 in case of success, negative error code otherwise.
+ */
+static int hmc7044_set_rates(struct no_os_clk_desc **descs,
+			     const uint64_t *rates, uint32_t nb)
+{
+	struct no_os_spi_msg msgs[2 * HMC7044_NUM_CHAN] = {0};
+	struct hmc7044_chan_spec *chans[HMC7044_NUM_CHAN];
+	uint8_t buf[2 * HMC7044_NUM_CHAN][3];
+	uint32_t div[HMC7044_NUM_CHAN];
+	struct hmc7044_dev *dev;
+	uint16_t cmd, reg;
+	uint32_t i, j;
+	int ret;
+
+	if (!nb || nb > HMC7044_NUM_CHAN)
+		return -EINVAL;
+
+	dev = descs[0]->dev_desc;
+
+	for (i = 0; i < nb; i++) {
+		chans[i] = NULL;
+		for (j = 0; j < dev->num_channels; j++) {
+			if (dev->channels[j].num == descs[i]->hw_ch_num) {
+				chans[i] = &dev->channels[j];
+				break;
+			}
+		}
+		if (!chans[i])
+			return -EINVAL;
+
+		div[i] = hmc7044_calc_out_div(rates[i], dev->pll2_freq);
+	}
+
+	for (i = 0; i < 2 * nb; i++) {
+		if (i % 2)
+			reg = HMC7044_REG_CH_OUT_CRTL_2(chans[i / 2]->num);
+		else
+			reg = HMC7044_REG_CH_OUT_CRTL_1(chans[i / 2]->num);
+
+		cmd = HMC7044_WRITE | HMC7044_CNT(1) | HMC7044_ADDR(reg);
+		buf[i][0] = cmd >> 8;
+		buf[i][1] = cmd & 0xFF;
+		buf[i][2] = (i % 2) ? HMC7044_DIV_MSB(div[i / 2]) :
+			    HMC7044_DIV_LSB(div[i / 2]);
+
+		msgs[i].tx_buff = buf[i];
+		msgs[i].rx_buff = buf[i];
+		msgs[i].bytes_number = NO_OS_ARRAY_SIZE(buf[i]);
+		msgs[i].cs_change = 1;
+	}
+
+	ret = no_os_spi_transfer(dev->spi_desc, msgs, 2 * nb);
+	if (ret)
+		return ret;
+
+	for (i = 0; i < nb; i++)
+		chans[i]->divider = div[i];
+
+	return 0;
+}
+
 /**
  * @brief hmc7044 clock ops
  */
@@ -1694,4 +1769,5 @@ const struct no_os_clk_platform_ops hmc7044_clk_ops = {
 	.clk_enable = &hmc7044_clk_enable,
 	.clk_round_rate = &hmc7044_round_rate,
 	.clk_set_rate = &hmc7044_set_rate,
+	.clk_set_rates = &hmc7044_set_rates,
 };
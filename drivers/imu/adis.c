@@ -67,6 +67,8 @@
 #define ADIS_ZACCL_IDX_32_BIT_BURST	22
 #define ADIS_TEMP_IDX_32_BIT_BURST	26
 #define ADIS_CNT_IDX_32_BIT_BURST	28
+#define ADIS_REGMAP_WORD_SIZE		2  /* in bytes */
+#define ADIS_REGMAP_NB_WORDS		ADIS_PAGE_SIZE /* two register pages */
 
 static const uint32_t adis_3db_freqs[] = {
 	720, /* Filter disabled, full BW (~720Hz) */
@@ -78,6 +80,184 @@ static const uint32_t adis_3db_freqs[] = {
 	10,
 };
 
+/*
+ * Configuration fields kept in the register cache. Any other register, and any
+ * register sharing a word with a command, status or data field, is volatile.
+ */
+static const size_t adis_cached_fields[] = {
+	offsetof(struct adis_data_field_map_def, xg_bias),
+	offsetof(struct adis_data_field_map_def, yg_bias),
+	offsetof(struct adis_data_field_map_def, zg_bias),
+	offsetof(struct adis_data_field_map_def, xa_bias),
+	offsetof(struct adis_data_field_map_def, ya_bias),
+	offsetof(struct adis_data_field_map_def, za_bias),
+	offsetof(struct adis_data_field_map_def, xg_scale),
+	offsetof(struct adis_data_field_map_def, yg_scale),
+	offsetof(struct adis_data_field_map_def, zg_scale),
+	offsetof(struct adis_data_field_map_def, xa_scale),
+	offsetof(struct adis_data_field_map_def, ya_scale),
+	offsetof(struct adis_data_field_map_def, za_scale),
+	offsetof(struct adis_data_field_map_def, fifo_en),
+	offsetof(struct adis_data_field_map_def, fifo_overflow),
+	offsetof(struct adis_data_field_map_def, fifo_wm_int_en),
+	offsetof(struct adis_data_field_map_def, fifo_wm_int_pol),
+	offsetof(struct adis_data_field_map_def, fifo_wm_lvl),
+	offsetof(struct adis_data_field_map_def, filt_size_var_b),
+	offsetof(struct adis_data_field_map_def, dr_selection),
+	offsetof(struct adis_data_field_map_def, dr_polarity),
+	offsetof(struct adis_data_field_map_def, dr_enable),
+	offsetof(struct adis_data_field_map_def, sync_selection),
+	offsetof(struct adis_data_field_map_def, sync_polarity),
+	offsetof(struct adis_data_field_map_def, sync_mode),
+	offsetof(struct adis_data_field_map_def, alarm_selection),
+	offsetof(struct adis_data_field_map_def, alarm_polarity),
+	offsetof(struct adis_data_field_map_def, alarm_enable),
+	offsetof(struct adis_data_field_map_def, sens_bw),
+	offsetof(struct adis_data_field_map_def, pt_of_perc_algnmt),
+	offsetof(struct adis_data_field_map_def, linear_accl_comp),
+	offsetof(struct adis_data_field_map_def, burst_sel),
+	offsetof(struct adis_data_field_map_def, burst32),
+	offsetof(struct adis_data_field_map_def, timestamp32),
+	offsetof(struct adis_data_field_map_def, sync_4khz),
+	offsetof(struct adis_data_field_map_def, accl_fir_enable),
+	offsetof(struct adis_data_field_map_def, gyro_fir_enable),
+	offsetof(struct adis_data_field_map_def, up_scale),
+	offsetof(struct adis_data_field_map_def, dec_rate),
+	offsetof(struct adis_data_field_map_def, bias_corr_tbc),
+	offsetof(struct adis_data_field_map_def, bias_corr_en_xg),
+	offsetof(struct adis_data_field_map_def, bias_corr_en_yg),
+	offsetof(struct adis_data_field_map_def, bias_corr_en_zg),
+	offsetof(struct adis_data_field_map_def, bias_corr_en_xa),
+	offsetof(struct adis_data_field_map_def, bias_corr_en_ya),
+	offsetof(struct adis_data_field_map_def, bias_corr_en_za),
+	offsetof(struct adis_data_field_map_def, usr_scr_1),
+	offsetof(struct adis_data_field_map_def, usr_scr_2),
+	offsetof(struct adis_data_field_map_def, usr_scr_3),
+	offsetof(struct adis_data_field_map_def, usr_scr_4),
+};
+
+static int adis_write_reg_nocache(struct adis_dev *adis, uint32_t reg,
+				  uint32_t val, uint32_t size);
+
+/**
+ * @brief Register cache read callback, reads one 16-bit word.
+ * @param ctx  - The adis device.
+ * @param word - Word index, the register address divided by two.
+ * @param val  - The value read back from the device.
+ * @return 0 in case of success, error code otherwise.
+ */
+static int adis_regmap_read(void *ctx, uint32_t word, uint32_t *val)
+{
+	return adis_read_reg(ctx, word * ADIS_REGMAP_WORD_SIZE, val,
+			     ADIS_2_BYTES_SIZE);
+}
+
+/**
+ * @brief Register cache write callback, writes one 16-bit word.
+ * @param ctx  - The adis device.
+ * @param word - Word index, the register address divided by two.
+ * @param val  - The value to write to device.
+ * @return 0 in case of success, error code otherwise.
+ */
+static int adis_regmap_write(void *ctx, uint32_t word, uint32_t val)
+{
+	return adis_write_reg_nocache(ctx, word * ADIS_REGMAP_WORD_SIZE, val,
+				      ADIS_2_BYTES_SIZE);
+}
+
+/**
+ * @brief Register cache volatile callback.
+ * @param ctx  - The adis device.
+ * @param word - Word index, the register address divided by two.
+ * @return true if the word does not hold only configuration fields.
+ */
+static bool adis_regmap_volatile(void *ctx, uint32_t word)
+{
+	struct adis_dev *adis = ctx;
+	const uint8_t *field_map = (const uint8_t *)adis->info->field_map;
+	const struct adis_field *field;
+	uint32_t addr = word * ADIS_REGMAP_WORD_SIZE;
+	uint32_t i;
+
+	for (i = 0; i < NO_OS_ARRAY_SIZE(adis_cached_fields); i++) {
+		field = (const struct adis_field *)(field_map + adis_cached_fields[i]);
+		if (!field->field_mask)
+			continue;
+		if (addr >= field->reg_addr &&
+		    addr < field->reg_addr + field->reg_size)
+			return false;
+	}
+
+	return true;
+}
+
+static const struct no_os_regmap_bus adis_regmap_bus = {
+	.reg_read = adis_regmap_read,
+	.reg_write = adis_regmap_write,
+};
+
+/**
+ * @brief Drop the whole register cache, after the device changed its
+ *        registers on its own, for example after a reset.
+ * @param adis - The adis device.
+ */
+static void adis_regmap_invalidate_all(struct adis_dev *adis)
+{
+	if (adis->regmap)
+		no_os_regmap_cache_invalidate(adis->regmap, 0,
+					      ADIS_REGMAP_NB_WORDS - 1);
+}
+
+/**
+ * @brief Check if a register is held in the register cache.
+ * @param adis - The adis device.
+ * @param reg  - The address of the lower of the two registers.
+ * @param size - Size of the register.
+ * @return true if all words of the register are cached.
+ */
+static bool adis_reg_is_cached(struct adis_dev *adis, uint32_t reg,
+			       uint8_t size)
+{
+	uint32_t word = reg / ADIS_REGMAP_WORD_SIZE;
+	uint32_t i;
+
+	if (!adis->regmap || reg % ADIS_REGMAP_WORD_SIZE)
+		return false;
+
+	for (i = 0; i < size / ADIS_REGMAP_WORD_SIZE; i++)
+		if (no_os_regmap_is_volatile(adis->regmap, word + i))
+			return false;
+
+	return true;
+}
+
+/**
+ * @brief Read a register through the register cache.
+ * @param adis - The adis device.
+ * @param reg  - The address of the lower of the two registers.
+ * @param val  - The register value.
+ * @param size - Size of the register.
+ * @return 0 in case of success, error code otherwise.
+ */
+static int adis_read_reg_cached(struct adis_dev *adis, uint32_t reg,
+				uint32_t *val, uint8_t size)
+{
+	uint32_t words[2] = { 0 };
+	int ret;
+
+	if (!adis_reg_is_cached(adis, reg, size))
+		return adis_read_reg(adis, reg, val, size);
+
+	ret = no_os_regmap_bulk_read(adis->regmap, reg / ADIS_REGMAP_WORD_SIZE,
+				     words, size / ADIS_REGMAP_WORD_SIZE);
+	if (ret)
+		return ret;
+
+	*val = words[0] | (words[1] << 16);
+
+	return 0;
+}
+
 /**
  * @brief Initialize adis device.
  * @param adis - The adis device.
@@ -123,6 +303,20 @@ int adis_init(struct adis_dev **adis, const struct adis_init_param *ip)
 	dev->int_clk = ip->info->int_clk;
 	dev->is_locked = false;
 
+	if (ip->reg_cache) {
+		struct no_os_regmap_init_param regmap_ip = {
+			.bus = &adis_regmap_bus,
+			.ctx = dev,
+			.nb_regs = ADIS_REGMAP_NB_WORDS,
+			.cache_type = NO_OS_REGMAP_CACHE_WRITE_THROUGH,
+			.volatile_reg = adis_regmap_volatile,
+		};
+
+		ret = no_os_regmap_init(&dev->regmap, &regmap_ip);
+		if (ret)
+			goto error;
+	}
+
 	ret = adis_initial_startup(dev);
 	if (ret)
 		goto error;
@@ -136,6 +330,8 @@ int adis_init(struct adis_dev **adis, const struct adis_init_param *ip)
 	return ret;
 
 error:
+	if (dev->regmap)
+		no_os_regmap_remove(dev->regmap);
 	no_os_gpio_remove(dev->gpio_reset);
 	no_os_spi_remove(dev->spi_desc);
 error_spi:
@@ -155,6 +351,8 @@ void adis_remove(struct adis_dev *adis)
 		no_os_gpio_remove(adis->gpio_reset);
 	if (adis->spi_desc)
 		no_os_spi_remove(adis->spi_desc);
+	if (adis->regmap)
+		no_os_regmap_remove(adis->regmap);
 
 	no_os_free(adis);
 }
@@ -175,6 +373,7 @@ int adis_initial_startup(struct adis_dev *adis)
 		if (ret)
 			return ret;
 		no_os_mdelay(timeouts->reset_ms);
+		adis_regmap_invalidate_all(adis);
 	} else {
 		ret = adis_cmd_sw_res(adis);
 		if (ret)
@@ -283,15 +482,15 @@ int adis_read_reg(struct adis_dev *adis,  uint32_t reg, uint32_t *val,
 }
 
 /**
- * @brief Write N bytes to register.
+ * @brief Write N bytes to register, without updating the register cache.
  * @param adis - The adis device.
  * @param reg  - The address of the lower of the two registers.
  * @param val  - The value to write to device (up to 4 bytes).
  * @param size - The size of the val buffer.
  * @return 0 in case of success, error code otherwise.
  */
-int adis_write_reg(struct adis_dev *adis, uint32_t reg, uint32_t val,
-		   uint32_t size)
+static int adis_write_reg_nocache(struct adis_dev *adis, uint32_t reg,
+				  uint32_t val, uint32_t size)
 {
 	/* If custom implementation is available, use it. */
 	if (adis->info->write_reg)
@@ -382,6 +581,32 @@ int adis_write_reg(struct adis_dev *adis, uint32_t reg, uint32_t val,
 	return 0;
 }
 
+/**
+ * @brief Write N bytes to register. The cached copy of the written registers
+ *        is dropped, so the next read gets the value from the device.
+ * @param adis - The adis device.
+ * @param reg  - The address of the lower of the two registers.
+ * @param val  - The value to write to device (up to 4 bytes).
+ * @param size - The size of the val buffer.
+ * @return 0 in case of success, error code otherwise.
+ */
+int adis_write_reg(struct adis_dev *adis, uint32_t reg, uint32_t val,
+		   uint32_t size)
+{
+	int ret;
+
+	ret = adis_write_reg_nocache(adis, reg, val, size);
+	if (ret)
+		return ret;
+
+	if (adis->regmap && size)
+		no_os_regmap_cache_invalidate(adis->regmap,
+					      reg / ADIS_REGMAP_WORD_SIZE,
+					      (reg + size - 1) / ADIS_REGMAP_WORD_SIZE);
+
+	return 0;
+}
+
 /**
  * @brief Read field to uint32 value.
  * @param adis      - The adis device.
@@ -394,7 +619,7 @@ int adis_read_field_u32(struct adis_dev *adis, struct adis_field field,
 {
 	int ret;
 	uint32_t reg_val;
-	ret = adis_read_reg(adis, field.reg_addr, &reg_val, field.reg_size);
+	ret = adis_read_reg_cached(adis, field.reg_addr, &reg_val, field.reg_size);
 	if (ret)
 		return ret;
 
@@ -416,7 +641,7 @@ int adis_read_field_s32(struct adis_dev *adis, struct adis_field field,
 	int ret;
 	uint32_t reg_val;
 
-	ret = adis_read_reg(adis, field.reg_addr, &reg_val, field.reg_size);
+	ret = adis_read_reg_cached(adis, field.reg_addr, &reg_val, field.reg_size);
 	if (ret)
 		return ret;
 
@@ -458,6 +683,25 @@ int adis_update_bits_base(struct adis_dev *adis, uint32_t reg,
 {
 	int ret;
 	uint32_t __val;
+	uint32_t i;
+
+	/*
+	 * Cached registers are updated one 16-bit word at a time, so words
+	 * which already hold the requested value are not written.
+	 */
+	if (adis_reg_is_cached(adis, reg, size)) {
+		__val = no_os_field_prep(mask, val);
+		for (i = 0; i < size / ADIS_REGMAP_WORD_SIZE; i++) {
+			ret = no_os_regmap_update_bits(adis->regmap,
+						       reg / ADIS_REGMAP_WORD_SIZE + i,
+						       (mask >> (16 * i)) & 0xFFFF,
+						       (__val >> (16 * i)) & 0xFFFF);
+			if (ret)
+				return ret;
+		}
+
+		return 0;
+	}
 
 	ret = adis_read_reg(adis, reg, &__val, size);
 	if (ret)
@@ -470,6 +714,10 @@ int adis_update_bits_base(struct adis_dev *adis, uint32_t reg,
 
 /**
  * @brief Check if the checksum for burst data is correct.
+ *
+ * The bytes are summed four at a time, in two 16-bit lanes of a 32-bit word;
+ * the remaining bytes are summed one at a time. Since the buffer size is at
+ * most 255 bytes, the lanes cannot overflow.
  * @param buffer - The received burst data buffer.
  * @param size   - The size of the buffer.
  * @param idx    - The start index in the buffer to check the checksum.
@@ -477,11 +725,20 @@ int adis_update_bits_base(struct adis_dev *adis, uint32_t reg,
  */
 bool adis_validate_checksum(uint8_t *buffer, uint8_t size, uint8_t idx)
 {
-	uint8_t i;
-	uint16_t checksum = no_os_get_unaligned_be16(&buffer[size -
-				 ADIS_CHECKSUM_SIZE]);
+	uint8_t end = size - ADIS_CHECKSUM_SIZE;
+	uint16_t checksum = no_os_get_unaligned_be16(&buffer[end]);
+	uint32_t lanes = 0;
+	uint32_t word;
+	uint8_t i = idx;
+
+	for (; i + 4 <= end; i += 4) {
+		memcpy(&word, &buffer[i], sizeof(word));
+		lanes += (word & 0x00FF00FF) + ((word >> 8) & 0x00FF00FF);
+	}
+
+	checksum -= (lanes & 0xFFFF) + (lanes >> 16);
 
-	for (i = idx; i < size - ADIS_CHECKSUM_SIZE; i++)
+	for (; i < end; i++)
 		checksum -= buffer[i];
 
 	return checksum == 0;
@@ -3571,7 +3828,16 @@ int adis_write_bias_corr_en_za(struct adis_dev *adis, uint32_t bias_corr_en_za)
 int adis_cmd_bias_corr_update(struct adis_dev *adis)
 {
 	struct adis_field field = adis->info->field_map->bias_corr_update;
-	return adis_write_reg(adis, field.reg_addr, field.field_mask, field.reg_size);
+	int ret;
+
+	ret = adis_write_reg(adis, field.reg_addr, field.field_mask, field.reg_size);
+	if (ret)
+		return ret;
+
+	/* The device updates the bias registers on its own */
+	adis_regmap_invalidate_all(adis);
+
+	return 0;
 }
 
 /**
@@ -3589,6 +3855,7 @@ int adis_cmd_fact_calib_restore(struct adis_dev *adis)
 		return ret;
 
 	no_os_mdelay(adis->info->timeouts->fact_calib_restore_ms);
+	adis_regmap_invalidate_all(adis);
 
 	return 0;
 }
@@ -3678,6 +3945,7 @@ int adis_cmd_sw_res(struct adis_dev *adis)
 		return ret;
 
 	no_os_mdelay(adis->info->timeouts->sw_reset_ms);
+	adis_regmap_invalidate_all(adis);
 
 	adis->is_locked = false;
 
@@ -4074,6 +4342,79 @@ int adis_read_burst_data(struct adis_dev *adis, struct adis_burst_data *data,
 	return 0;
 }
 
+/**
+ * @brief Read multiple burst data frames from FIFO in a single transfer.
+ * @param adis       - The adis device.
+ * @param data       - Array of burst read data structures to be populated.
+ * @param nb_samples - Input: number of FIFO entries to be popped, at most
+ *		       ADIS_FIFO_BURST_MAX_FRAMES.
+ *		       Output: number of valid samples stored in data.
+ * @param burst32    - True if 32-bit data is requested for accel
+ *		       and gyro (or delta angle and delta velocity)
+ *		       measurements, false if 16-bit data is requested.
+ * @param burst_sel  - 0 if accel and gyro data is requested, 1
+ *		       if delta angle and delta velocity is requested.
+ * @param crc_check  - If true CRC will be checked, if false check will be skipped.
+ *		       Frames with invalid checksum are dropped.
+ * @return 0 in case of success, error code otherwise.
+ * -EAGAIN in case the request has to be sent again due to data being unavailable
+ * at the time of the request.
+ */
+int adis_read_burst_data_fifo(struct adis_dev *adis,
+			      struct adis_burst_data *data, uint16_t *nb_samples,
+			      bool burst32, uint8_t burst_sel, bool crc_check)
+{
+	if (!data || !nb_samples || !*nb_samples
+	    || *nb_samples > ADIS_FIFO_BURST_MAX_FRAMES)
+		return -EINVAL;
+
+	/* Device does not support FIFO burst readings */
+	if (!(adis->info->flags & ADIS_HAS_FIFO) || !adis->info->read_burst_data_fifo)
+		return -EINVAL;
+
+	/* Device does not support delta data readings with burst method */
+	if (!(adis->info->flags & ADIS_HAS_BURST_DELTA_DATA) && burst_sel)
+		return -EINVAL;
+
+	/* Device does not support burst32 readings with burst method */
+	if (!(adis->info->flags & ADIS_HAS_BURST32) && burst32)
+		return -EINVAL;
+
+	return adis->info->read_burst_data_fifo(adis, data, nb_samples, burst32,
+						burst_sel, crc_check);
+}
+
+/**
+ * @brief Pack burst data sample-sets into scan layout.
+ *
+ * The word map is computed once for a given scan configuration and holds, for
+ * each 16-bit scan word, the index of the burst data word to be copied
+ * (see ADIS_BURST_DATA_WORD) or ADIS_BURST_SCAN_PAD for zero padding.
+ * @param data       - Array of burst data sample-sets.
+ * @param nb_samples - Number of sample-sets to be packed.
+ * @param word_map   - Burst data word index for each scan word.
+ * @param nb_words   - Number of 16-bit words in one scan.
+ * @param scans      - Output buffer, of nb_samples * nb_words 16-bit words.
+ */
+void adis_burst_data_pack(const struct adis_burst_data *data,
+			  uint16_t nb_samples, const uint8_t *word_map,
+			  uint8_t nb_words, uint16_t *scans)
+{
+	uint16_t words[ADIS_BURST_DATA_WORDS + 1];
+	uint16_t i;
+	uint8_t j;
+
+	/* Last entry is used for padding. */
+	words[ADIS_BURST_SCAN_PAD] = 0;
+
+	for (i = 0; i < nb_samples; i++) {
+		memcpy(words, &data[i], sizeof(data[i]));
+		for (j = 0; j < nb_words; j++)
+			scans[j] = words[word_map[j]];
+		scans += nb_words;
+	}
+}
+
 /**
  * @brief Update external clock frequency.
  * @param adis     - The adis device.
@@ -42,9 +42,11 @@
 
 #include "no_os_spi.h"
 #include "no_os_util.h"
+#include "no_os_regmap.h"
 #include <errno.h>
 #include <stdlib.h>
 #include <stdbool.h>
+#include <stddef.h>
 
 #define ADIS_4_BYTES_SIZE	4
 #define ADIS_2_BYTES_SIZE	2
@@ -56,6 +58,9 @@
 #define ADIS_SYNC_OUTPUT	3
 #define ADIS_SYNC_PULSE		5
 
+/* Maximum number of FIFO burst frames read in a single SPI transfer. */
+#define ADIS_FIFO_BURST_MAX_FRAMES	8
+
 /**
  * @brief Supported device ids
  */
@@ -252,6 +257,14 @@ struct adis_burst_data {
 	uint16_t z_accel_msb;
 };
 
+/* Number of 16-bit words in struct adis_burst_data. */
+#define ADIS_BURST_DATA_WORDS	(sizeof(struct adis_burst_data) / sizeof(uint16_t))
+/* Index of a 16-bit word in struct adis_burst_data. */
+#define ADIS_BURST_DATA_WORD(field) \
+	(offsetof(struct adis_burst_data, field) / sizeof(uint16_t))
+/* Word map entry used for scan padding. */
+#define ADIS_BURST_SCAN_PAD	ADIS_BURST_DATA_WORDS
+
 /** @struct adis_dev
  *  @brief ADIS device descriptor structure
  */
@@ -286,6 +299,8 @@ struct adis_dev {
 	uint8_t				burst_sel;
 	/** Device is locked, only data readings are allowed, no configuration allowed. */
 	bool				is_locked;
+	/** Cache of the configuration registers, in 16-bit words. Optional. */
+	struct no_os_regmap		*regmap;
 };
 
 /** @struct adis_init_param
@@ -308,6 +323,10 @@ struct adis_init_param {
 	uint32_t			sync_mode;
 	/** Device id, specified by the user  */
 	enum adis_device_id		dev_id;
+	/** Set to cache the configuration registers, so that configuration
+	 *  reads and unchanged field writes do not access the device.
+	 */
+	bool				reg_cache;
 };
 
 /*! Initialize adis device. */
@@ -892,6 +911,16 @@ int adis_write_fir_coef(struct adis_dev *adis, uint8_t coef_idx, uint32_t coef);
 int adis_read_burst_data(struct adis_dev *adis, struct adis_burst_data *data,
 			 bool burst32, uint8_t burst_sel, bool fifo_pop, bool crc_check);
 
+/*! Read multiple burst data frames from FIFO in a single transfer. */
+int adis_read_burst_data_fifo(struct adis_dev *adis,
+			      struct adis_burst_data *data, uint16_t *nb_samples,
+			      bool burst32, uint8_t burst_sel, bool crc_check);
+
+/*! Pack burst data sample-sets into scan layout. */
+void adis_burst_data_pack(const struct adis_burst_data *data,
+			  uint16_t nb_samples, const uint8_t *word_map,
+			  uint8_t nb_words, uint16_t *scans);
+
 /*! Update external clock frequency. */
 int adis_update_ext_clk_freq(struct adis_dev *adis, uint32_t clk_freq);
 
@@ -41,6 +41,8 @@
 #define ADIS1657X_MSG_SIZE_32_BIT_BURST_FIFO	34 /* in bytes */
 #define ADIS1657X_READ_BURST_DATA_NO_POP	0x00
 #define ADIS1657X_CHECKSUM_BUF_IDX_FIFO		2
+/* From data-sheet, minimum time between consecutive burst reads */
+#define ADIS1657X_BURST_STALL_US		10
 
 static const struct adis_data_field_map_def adis1657x_def = {
 	.x_gyro 		 = {.reg_addr = 0x04, .reg_size = 0x04, .field_mask = 0xFFFFFFFF},
@@ -239,28 +241,19 @@ static int adis1657x_get_scale(struct adis_dev *adis,
 }
 
 /**
- * @brief Read burst data.
+ * @brief Update the burst configuration if different from the requested one.
  * @param adis      - The adis device.
- * @param data      - The burst read data structure to be populated.
- * @param burst32   - True if 32-bit data is requested for accel
- *		      and gyro (or delta angle and delta velocity)
- *		      measurements, false if 16-bit data is requested.
+ * @param burst32   - True if 32-bit burst data is requested.
  * @param burst_sel - 0 if accel and gyro data is requested, 1
  *		      if delta angle and delta velocity is requested.
- * @param fifo_pop  - In case FIFO is present, will pop the fifo if
- * 		      true. Unused if FIFO is not present.
- * @param crc_check - If true CRC will be checked, if false check will be skipped.
  * @return 0 in case of success, error code otherwise.
- * -EAGAIN in case the request has to be sent again due to data being unavailable
- * at the time of the request.
+ * -EAGAIN in case the configuration has been updated and the data will be
+ * available only after the next data ready impulse.
  */
-int adis1657x_read_burst_data(struct adis_dev *adis,
-			      struct adis_burst_data *data,
-			      bool burst32, uint8_t burst_sel, bool fifo_pop, bool crc_check)
+static int adis1657x_update_burst_config(struct adis_dev *adis, bool burst32,
+		uint8_t burst_sel)
 {
 	int ret = 0;
-	uint8_t msg_size = ADIS1657X_MSG_SIZE_16_BIT_BURST_FIFO;
-	uint8_t idx;
 
 	if (adis->info->flags & ADIS_HAS_BURST32) {
 		if (adis->burst32 != burst32) {
@@ -277,47 +270,38 @@ int adis1657x_read_burst_data(struct adis_dev *adis,
 		}
 	}
 
-	/* If burst32 or burst select has changed, wait for the next reading
-	   request to actually read the data, because the according data will be available
-	   only after the next data ready impulse. */
-	if (ret == -EAGAIN)
-		return ret;
-
-	if (burst32)
-		msg_size = ADIS1657X_MSG_SIZE_32_BIT_BURST_FIFO;
-
-	uint8_t buffer[msg_size + ADIS_READ_BURST_DATA_CMD_SIZE];
-
-	if (!fifo_pop)
-		buffer[0] = ADIS1657X_READ_BURST_DATA_NO_POP;
-	else
-		buffer[0] = ADIS_READ_BURST_DATA_CMD_MSB;
-
-	buffer[1] = ADIS_READ_BURST_DATA_CMD_LSB;
+	return ret;
+}
 
-	ret = no_os_spi_write_and_read(adis->spi_desc, buffer,
-				       msg_size + ADIS_READ_BURST_DATA_CMD_SIZE);
-	if (ret)
-		return ret;
+/**
+ * @brief Check if a burst frame holds no data (FIFO was empty).
+ * @param buffer   - The received burst frame, including the command bytes.
+ * @param msg_size - The size of the burst message, excluding the command bytes.
+ * @return true if the frame is empty, false otherwise.
+ */
+static bool adis1657x_burst_frame_empty(uint8_t *buffer, uint8_t msg_size)
+{
+	uint8_t idx;
 
 	for (idx = ADIS_READ_BURST_DATA_CMD_SIZE; idx < msg_size; idx++)
 		if (buffer[idx] != 0)
-			break;
-
-	if (idx == msg_size)
-		return -EAGAIN;
-
-	if (crc_check) {
-		/* Diag data not calculated in the checksum for this device. */
-		if (!adis_validate_checksum(&buffer[ADIS_READ_BURST_DATA_CMD_SIZE], msg_size,
-					    ADIS1657X_CHECKSUM_BUF_IDX_FIFO)) {
-			adis->diag_flags.checksum_err = true;
-			return -EINVAL;
-		}
-	}
+			return false;
 
-	adis->diag_flags.checksum_err = false;
+	return true;
+}
 
+/**
+ * @brief Unpack a received burst frame into the burst data structure.
+ * @param adis    - The adis device.
+ * @param buffer  - The received burst frame, including the command bytes.
+ * @param data    - The burst read data structure to be populated.
+ * @param burst32 - True if the frame contains 32-bit data.
+ */
+static void adis1657x_unpack_burst_frame(struct adis_dev *adis,
+		uint8_t *buffer,
+		struct adis_burst_data *data,
+		bool burst32)
+{
 	uint8_t axis_data_size = 12;
 	if (burst32)
 		axis_data_size = 24;
@@ -362,10 +346,158 @@ int adis1657x_read_burst_data(struct adis_dev *adis,
 	data->data_cntr_msb = 0;
 	/* Update diagnosis flags at each reading */
 	adis_update_diag_flags(adis, buffer[ADIS_READ_BURST_DATA_CMD_SIZE]);
+}
+
+/**
+ * @brief Read burst data.
+ * @param adis      - The adis device.
+ * @param data      - The burst read data structure to be populated.
+ * @param burst32   - True if 32-bit data is requested for accel
+ *		      and gyro (or delta angle and delta velocity)
+ *		      measurements, false if 16-bit data is requested.
+ * @param burst_sel - 0 if accel and gyro data is requested, 1
+ *		      if delta angle and delta velocity is requested.
+ * @param fifo_pop  - In case FIFO is present, will pop the fifo if
+ * 		      true. Unused if FIFO is not present.
+ * @param crc_check - If true CRC will be checked, if false check will be skipped.
+ * @return 0 in case of success, error code otherwise.
+ * -EAGAIN in case the request has to be sent again due to data being unavailable
+ * at the time of the request.
+ */
+int adis1657x_read_burst_data(struct adis_dev *adis,
+			      struct adis_burst_data *data,
+			      bool burst32, uint8_t burst_sel, bool fifo_pop, bool crc_check)
+{
+	int ret;
+	uint8_t msg_size = ADIS1657X_MSG_SIZE_16_BIT_BURST_FIFO;
+
+	/* If burst32 or burst select has changed, wait for the next reading
+	   request to actually read the data, because the according data will be available
+	   only after the next data ready impulse. */
+	ret = adis1657x_update_burst_config(adis, burst32, burst_sel);
+	if (ret)
+		return ret;
+
+	if (burst32)
+		msg_size = ADIS1657X_MSG_SIZE_32_BIT_BURST_FIFO;
+
+	uint8_t buffer[msg_size + ADIS_READ_BURST_DATA_CMD_SIZE];
+
+	if (!fifo_pop)
+		buffer[0] = ADIS1657X_READ_BURST_DATA_NO_POP;
+	else
+		buffer[0] = ADIS_READ_BURST_DATA_CMD_MSB;
+
+	buffer[1] = ADIS_READ_BURST_DATA_CMD_LSB;
+
+	ret = no_os_spi_write_and_read(adis->spi_desc, buffer,
+				       msg_size + ADIS_READ_BURST_DATA_CMD_SIZE);
+	if (ret)
+		return ret;
+
+	if (adis1657x_burst_frame_empty(buffer, msg_size))
+		return -EAGAIN;
+
+	if (crc_check) {
+		/* Diag data not calculated in the checksum for this device. */
+		if (!adis_validate_checksum(&buffer[ADIS_READ_BURST_DATA_CMD_SIZE], msg_size,
+					    ADIS1657X_CHECKSUM_BUF_IDX_FIFO)) {
+			adis->diag_flags.checksum_err = true;
+			return -EINVAL;
+		}
+	}
+
+	adis->diag_flags.checksum_err = false;
+
+	adis1657x_unpack_burst_frame(adis, buffer, data, burst32);
 
 	return 0;
 }
 
+/**
+ * @brief Read multiple burst data frames from FIFO in a single transfer.
+ *
+ * Each frame pops one FIFO entry. All frames are chained in a single message
+ * array, with the minimum stall time between consecutive burst reads encoded
+ * as CS change delay, so the FIFO is drained without per-frame software delays.
+ * @param adis       - The adis device.
+ * @param data       - Array of burst read data structures to be populated.
+ * @param nb_samples - Input: number of FIFO entries to be popped.
+ *		       Output: number of valid samples stored in data.
+ * @param burst32    - True if 32-bit data is requested for accel
+ *		       and gyro (or delta angle and delta velocity)
+ *		       measurements, false if 16-bit data is requested.
+ * @param burst_sel  - 0 if accel and gyro data is requested, 1
+ *		       if delta angle and delta velocity is requested.
+ * @param crc_check  - If true CRC will be checked, if false check will be skipped.
+ * @return 0 in case of success, error code otherwise.
+ * -EAGAIN in case the request has to be sent again due to data being unavailable
+ * at the time of the request.
+ */
+int adis1657x_read_burst_data_fifo(struct adis_dev *adis,
+				   struct adis_burst_data *data, uint16_t *nb_samples,
+				   bool burst32, uint8_t burst_sel, bool crc_check)
+{
+	uint8_t frames[ADIS_FIFO_BURST_MAX_FRAMES][ADIS1657X_MSG_SIZE_32_BIT_BURST_FIFO
+			+ ADIS_READ_BURST_DATA_CMD_SIZE];
+	struct no_os_spi_msg msgs[ADIS_FIFO_BURST_MAX_FRAMES];
+	uint8_t msg_size = ADIS1657X_MSG_SIZE_16_BIT_BURST_FIFO;
+	uint16_t nb_valid = 0;
+	uint16_t i;
+	int ret;
+
+	ret = adis1657x_update_burst_config(adis, burst32, burst_sel);
+	if (ret)
+		return ret;
+
+	if (burst32)
+		msg_size = ADIS1657X_MSG_SIZE_32_BIT_BURST_FIFO;
+
+	for (i = 0; i < *nb_samples; i++) {
+		memset(frames[i], 0, msg_size + ADIS_READ_BURST_DATA_CMD_SIZE);
+		frames[i][0] = ADIS_READ_BURST_DATA_CMD_MSB;
+		frames[i][1] = ADIS_READ_BURST_DATA_CMD_LSB;
+
+		msgs[i] = (struct no_os_spi_msg) {
+			.tx_buff = frames[i],
+			.rx_buff = frames[i],
+			.bytes_number = msg_size + ADIS_READ_BURST_DATA_CMD_SIZE,
+			.cs_change = 1,
+			.cs_change_delay = ADIS1657X_BURST_STALL_US,
+		};
+	}
+
+	ret = no_os_spi_transfer_dma(adis->spi_desc, msgs, *nb_samples);
+	if (ret == -ENOSYS)
+		ret = no_os_spi_transfer(adis->spi_desc, msgs, *nb_samples);
+	if (ret)
+		return ret;
+
+	adis->diag_flags.checksum_err = false;
+
+	for (i = 0; i < *nb_samples; i++) {
+		if (adis1657x_burst_frame_empty(frames[i], msg_size))
+			continue;
+
+		if (crc_check) {
+			/* Diag data not calculated in the checksum for this device. */
+			if (!adis_validate_checksum(&frames[i][ADIS_READ_BURST_DATA_CMD_SIZE],
+						    msg_size, ADIS1657X_CHECKSUM_BUF_IDX_FIFO)) {
+				/* Drop the frame, the data counter will account for it. */
+				adis->diag_flags.checksum_err = true;
+				continue;
+			}
+		}
+
+		adis1657x_unpack_burst_frame(adis, frames[i], &data[nb_valid], burst32);
+		nb_valid++;
+	}
+
+	*nb_samples = nb_valid;
+
+	return nb_valid ? 0 : -EAGAIN;
+}
+
 const struct adis_chip_info adis1657x_chip_info = {
 	.field_map		= &adis1657x_def,
 	.sync_clk_freq_limits	= adis1657x_sync_clk_freq_limits,
@@ -383,4 +515,5 @@ const struct adis_chip_info adis1657x_chip_info = {
 	.flags			= ADIS_HAS_BURST32 | ADIS_HAS_BURST_DELTA_DATA | ADIS_HAS_FIFO,
 	.get_scale		= &adis1657x_get_scale,
 	.read_burst_data	= &adis1657x_read_burst_data,
+	.read_burst_data_fifo	= &adis1657x_read_burst_data_fifo,
 };
@@ -1388,6 +1388,80 @@ int adis_iio_write_debug_attrs(void *dev, char *buf, uint32_t len,
 	}
 }
 
+/**
+ * @brief Compute the burst data to scan layout word map for the given mask.
+ * @param iio_adis - The iio adis structure.
+ * @param mask     - The active channels mask.
+ */
+static void adis_iio_update_scan_map(struct adis_iio_dev *iio_adis,
+				     uint32_t mask)
+{
+	/* Burst data word holding the upper 16 bits of each channel. */
+	static const uint8_t chan_msb_word[ADIS_NUM_CHAN] = {
+		[ADIS_GYRO_X] = ADIS_BURST_DATA_WORD(x_gyro_msb),
+		[ADIS_GYRO_Y] = ADIS_BURST_DATA_WORD(y_gyro_msb),
+		[ADIS_GYRO_Z] = ADIS_BURST_DATA_WORD(z_gyro_msb),
+		[ADIS_ACCEL_X] = ADIS_BURST_DATA_WORD(x_accel_msb),
+		[ADIS_ACCEL_Y] = ADIS_BURST_DATA_WORD(y_accel_msb),
+		[ADIS_ACCEL_Z] = ADIS_BURST_DATA_WORD(z_accel_msb),
+		[ADIS_TEMP] = ADIS_BURST_DATA_WORD(temp_msb),
+		[ADIS_DELTA_ANGL_X] = ADIS_BURST_DATA_WORD(x_gyro_msb),
+		[ADIS_DELTA_ANGL_Y] = ADIS_BURST_DATA_WORD(y_gyro_msb),
+		[ADIS_DELTA_ANGL_Z] = ADIS_BURST_DATA_WORD(z_gyro_msb),
+		[ADIS_DELTA_VEL_X] = ADIS_BURST_DATA_WORD(x_accel_msb),
+		[ADIS_DELTA_VEL_Y] = ADIS_BURST_DATA_WORD(y_accel_msb),
+		[ADIS_DELTA_VEL_Z] = ADIS_BURST_DATA_WORD(z_accel_msb),
+	};
+	uint8_t *map = iio_adis->scan_map;
+	uint8_t i = 0;
+	uint8_t chan;
+	bool temp32;
+	bool valid;
+
+	for (chan = 0; chan < ADIS_NUM_CHAN; chan++) {
+		if (!(mask & NO_OS_BIT(chan)))
+			continue;
+
+		if (chan == ADIS_TEMP) {
+			temp32 = iio_adis->iio_dev->channels[chan].scan_type->storagebits == 32;
+			if (temp32)
+				map[i++] = ADIS_BURST_DATA_WORD(temp_msb);
+
+			map[i++] = ADIS_BURST_DATA_WORD(temp_lsb);
+			/*
+			 * The temperature channel has 16-bit storage size.
+			 * We need to perform the padding to have the buffer
+			 * elements naturally aligned in case there are any
+			 * 32-bit storage size channels enabled which have a
+			 * scan index higher than the temperature channel scan
+			 * index.
+			 */
+			if (mask & NO_OS_GENMASK(ADIS_DELTA_VEL_Z, ADIS_DELTA_ANGL_X)
+			    && !temp32)
+				map[i++] = ADIS_BURST_SCAN_PAD;
+			continue;
+		}
+
+		/* Gyro and accel data are sent for burst_sel 0, delta data for 1. */
+		if (chan < ADIS_TEMP)
+			valid = !iio_adis->burst_sel;
+		else
+			valid = iio_adis->burst_sel;
+
+		if (valid) {
+			/* upper 16 */
+			map[i++] = chan_msb_word[chan];
+			/* lower 16 */
+			map[i++] = chan_msb_word[chan] - 1;
+		} else {
+			map[i++] = ADIS_BURST_SCAN_PAD;
+			map[i++] = ADIS_BURST_SCAN_PAD;
+		}
+	}
+
+	iio_adis->scan_words = i;
+}
+
 /**
  * @brief API to be called before trigger is enabled.
  * @param dev  - The iio device structure.
@@ -1430,6 +1504,8 @@ int adis_iio_pre_enable(void* dev, uint32_t mask)
 	iio_adis->samples_lost = 0;
 	iio_adis->data_cntr = 0;
 
+	adis_iio_update_scan_map(iio_adis, mask);
+
 	if (iio_adis->has_fifo) {
 		/* Set FIFO overflow behavior to overwrite old data when FIFO is full. */
 		ret = adis_cmd_fifo_flush(adis);
@@ -1476,26 +1552,74 @@ int adis_iio_post_disable(void* dev, uint32_t mask)
 }
 
 /**
- * @brief API to be called to get one single sample-set based on the given mask.
+ * @brief Update the data counter and the number of lost samples based on the
+ *        data counter of the given burst data sample-set.
+ * @param iio_adis - The iio adis structure.
+ * @param buffer   - IIO buffer accounting the lost samples.
+ * @param data     - Burst data sample-set.
+ * @return true if the sample-set holds new data, false otherwise.
+ */
+static bool adis_iio_update_data_cntr(struct adis_iio_dev *iio_adis,
+				      struct iio_buffer *buffer,
+				      struct adis_burst_data *data)
+{
+	uint32_t dropped = buffer->stats.scans_dropped;
+	uint32_t lost = 0;
+	uint32_t res1;
+	uint32_t res2;
+
+	uint32_t current_data_cntr = data->data_cntr_lsb | data->data_cntr_msb << 16;
+
+	if (iio_adis->sync_mode != ADIS_SYNC_SCALED) {
+		/* The 16-bit data counter increments once per sample */
+		if (iio_buffer_check_counter(buffer, current_data_cntr, 16))
+			return false;
+
+		iio_adis->samples_lost += buffer->stats.scans_dropped - dropped;
+
+		return true;
+	}
+
+	/* In scaled sync mode the data counter counts 49 us periods */
+	if (iio_adis->data_cntr) {
+		if (current_data_cntr == iio_adis->data_cntr)
+			/* No new data, nothing else to do */
+			return false;
+
+		if (current_data_cntr > iio_adis->data_cntr) {
+			res1 = (current_data_cntr - iio_adis->data_cntr) * 49;
+			res2 = NO_OS_DIV_ROUND_CLOSEST(1000000, iio_adis->sampling_frequency);
+
+			if (res1 > res2) {
+				lost = res1 / res2;
+				if (res1 % res2 < res2 / 2)
+					lost--;
+			}
+		}
+	}
+
+	iio_buffer_drop_scans(buffer, lost);
+	iio_adis->samples_lost += lost;
+	iio_adis->data_cntr = current_data_cntr;
+
+	return true;
+}
+
+/**
+ * @brief API to be called to get one single sample-set based on the active
+ *        channels scan map.
  * @param iio_adis - The iio adis structure.
- * @param mask     - The active channels mask.
  * @param buffer   - IIO buffer to push the sample set to.
+ * @param pop      - If true, the FIFO will be popped.
  * @return 0 in case of success, error code otherwise.
  */
 static int adis_iio_trigger_push_single_sample(struct adis_iio_dev *iio_adis,
-		uint32_t mask, struct iio_buffer *buffer, bool pop)
+		struct iio_buffer *buffer, bool pop)
 {
-	struct adis_dev *adis;
-	int ret;
 	struct adis_burst_data data;
-	uint8_t i = 0;
-	uint32_t res1;
-	uint32_t res2;
-	uint8_t chan;
-
-	adis = iio_adis->adis_dev;
+	int ret;
 
-	ret = adis_read_burst_data(adis, &data, iio_adis->burst_size,
+	ret = adis_read_burst_data(iio_adis->adis_dev, &data, iio_adis->burst_size,
 				   iio_adis->burst_sel, pop, false);
 
 	/* If ret ==  EAGAIN then no data is available to read (will happen
@@ -1506,197 +1630,67 @@ static int adis_iio_trigger_push_single_sample(struct adis_iio_dev *iio_adis,
 	if (ret)
 		return ret;
 
-	uint32_t current_data_cntr = data.data_cntr_lsb | data.data_cntr_msb << 16;
+	if (!adis_iio_update_data_cntr(iio_adis, buffer, &data))
+		return 0;
 
-	if (iio_adis->data_cntr) {
-		if (current_data_cntr > iio_adis->data_cntr) {
-			if (iio_adis->sync_mode != ADIS_SYNC_SCALED)
-				iio_adis->samples_lost += current_data_cntr - iio_adis->data_cntr - 1;
-			else {
-				res1 = (current_data_cntr - iio_adis->data_cntr) * 49;
-				res2 = NO_OS_DIV_ROUND_CLOSEST(1000000, iio_adis->sampling_frequency);
-
-				if (res1 > res2) {
-					iio_adis->samples_lost += res1 / res2;
-					if (res1 % res2 < res2 / 2)
-						iio_adis->samples_lost--;
-				}
-			}
+	adis_burst_data_pack(&data, 1, iio_adis->scan_map, iio_adis->scan_words,
+			     iio_adis->data);
 
-		} else if (current_data_cntr == iio_adis->data_cntr) {
-			/* No new data, nothing else to do */
-			return 0;
-		}
+	return iio_buffer_push_scan(buffer, &iio_adis->data[0]);
+}
 
-		else { /* data counter overflowed occurred */
-			if (iio_adis->sync_mode != ADIS_SYNC_SCALED)
-				iio_adis->samples_lost += NO_OS_U16_MAX - iio_adis->data_cntr +
-							  current_data_cntr;
-		}
-	}
+/**
+ * @brief API to be called to drain the given number of FIFO entries using
+ *        chained burst reads, ADIS_FIFO_BURST_MAX_FRAMES entries per transfer.
+ *        The new sample-sets of each transfer are packed in bulk.
+ * @param iio_adis - The iio adis structure.
+ * @param buffer   - IIO buffer to push the sample sets to.
+ * @param nb_pops  - Number of FIFO entries to be popped.
+ * @return 0 in case of success, error code otherwise.
+ */
+static int adis_iio_trigger_push_fifo_samples(struct adis_iio_dev *iio_adis,
+		struct iio_buffer *buffer, uint32_t nb_pops)
+{
+	struct adis_burst_data data[ADIS_FIFO_BURST_MAX_FRAMES];
+	uint16_t scans[ADIS_FIFO_BURST_MAX_FRAMES * NO_OS_ARRAY_SIZE(iio_adis->data)];
+	uint16_t nb_samples;
+	uint16_t nb_new;
+	uint16_t j;
+	int ret;
 
-	iio_adis->data_cntr = current_data_cntr;
+	while (nb_pops) {
+		nb_samples = no_os_min(nb_pops, ADIS_FIFO_BURST_MAX_FRAMES);
+		nb_pops -= nb_samples;
 
-	for (chan = 0; chan < ADIS_NUM_CHAN; chan++) {
-		if (mask & (1 << chan)) {
-			switch (chan) {
-			case ADIS_TEMP:
-
-				if (iio_adis->iio_dev->channels[chan].scan_type->storagebits == 32)
-					iio_adis->data[i++] = data.temp_msb;
-
-				iio_adis->data[i++] = data.temp_lsb;
-				/*
-				 * The temperature channel has 16-bit storage size.
-				 * We need to perform the padding to have the buffer
-				 * elements naturally aligned in case there are any
-				 * 32-bit storage size channels enabled which have a
-				 * scan index higher than the temperature channel scan
-				 * index.
-				 */
-				if (mask & NO_OS_GENMASK(ADIS_DELTA_VEL_Z, ADIS_DELTA_ANGL_X)
-				    && iio_adis->iio_dev->channels[chan].scan_type->storagebits == 16)
-					iio_adis->data[i++] = 0;
-				break;
-			case ADIS_GYRO_X:
-				if (iio_adis->burst_sel) {
-					iio_adis->data[i++] = 0;
-					iio_adis->data[i++] = 0;
-				} else {
-					/* upper 16 */
-					iio_adis->data[i++] = data.x_gyro_msb;
-					/* lower 16 */
-					iio_adis->data[i++] =  data.x_gyro_lsb;
-				}
-				break;
-			case ADIS_GYRO_Y:
-				if (iio_adis->burst_sel) {
-					iio_adis->data[i++] = 0;
-					iio_adis->data[i++] = 0;
-				} else {
-					/* upper 16 */
-					iio_adis->data[i++] = data.y_gyro_msb;
-					/* lower 16 */
-					iio_adis->data[i++] =  data.y_gyro_lsb;
-				}
-				break;
-			case ADIS_GYRO_Z:
-				if (iio_adis->burst_sel) {
-					iio_adis->data[i++] = 0;
-					iio_adis->data[i++] = 0;
-				} else {
-					/* upper 16 */
-					iio_adis->data[i++] = data.z_gyro_msb;
-					/* lower 16 */
-					iio_adis->data[i++] =  data.z_gyro_lsb;
-				}
-				break;
-			case ADIS_ACCEL_X:
-				if (iio_adis->burst_sel) {
-					iio_adis->data[i++] = 0;
-					iio_adis->data[i++] = 0;
-				} else {
-					/* upper 16 */
-					iio_adis->data[i++] = data.x_accel_msb;
-					/* lower 16 */
-					iio_adis->data[i++] =  data.x_accel_lsb;
-				}
-				break;
-			case ADIS_ACCEL_Y:
-				if (iio_adis->burst_sel) {
-					iio_adis->data[i++] = 0;
-					iio_adis->data[i++] = 0;
-				} else {
-					/* upper 16 */
-					iio_adis->data[i++] = data.y_accel_msb;
-					/* lower 16 */
-					iio_adis->data[i++] =  data.y_accel_lsb;
-				}
-				break;
-			case ADIS_ACCEL_Z:
-				if (iio_adis->burst_sel) {
-					iio_adis->data[i++] = 0;
-					iio_adis->data[i++] = 0;
-				} else {
-					/* upper 16 */
-					iio_adis->data[i++] = data.z_accel_msb;
-					/* lower 16 */
-					iio_adis->data[i++] =  data.z_accel_lsb;
-				}
-				break;
-			case ADIS_DELTA_ANGL_X:
-				if (!iio_adis->burst_sel) {
-					iio_adis->data[i++] = 0;
-					iio_adis->data[i++] = 0;
-				} else {
-					/* upper 16 */
-					iio_adis->data[i++] = data.x_gyro_msb;
-					/* lower 16 */
-					iio_adis->data[i++] =  data.x_gyro_lsb;
-				}
-				break;
-			case ADIS_DELTA_ANGL_Y:
-				if (!iio_adis->burst_sel) {
-					iio_adis->data[i++] = 0;
-					iio_adis->data[i++] = 0;
-				} else {
-					/* upper 16 */
-					iio_adis->data[i++] = data.y_gyro_msb;
-					/* lower 16 */
-					iio_adis->data[i++] =  data.y_gyro_lsb;
-				}
-				break;
-			case ADIS_DELTA_ANGL_Z:
-				if (!iio_adis->burst_sel) {
-					iio_adis->data[i++] = 0;
-					iio_adis->data[i++] = 0;
-				} else {
-					/* upper 16 */
-					iio_adis->data[i++] = data.z_gyro_msb;
-					/* lower 16 */
-					iio_adis->data[i++] =  data.z_gyro_lsb;
-				}
-				break;
-			case ADIS_DELTA_VEL_X:
-				if (!iio_adis->burst_sel) {
-					iio_adis->data[i++] = 0;
-					iio_adis->data[i++] = 0;
-				} else {
-					/* upper 16 */
-					iio_adis->data[i++] = data.x_accel_msb;
-					/* lower 16 */
-					iio_adis->data[i++] =  data.x_accel_lsb;
-				}
-				break;
-			case ADIS_DELTA_VEL_Y:
-				if (!iio_adis->burst_sel) {
-					iio_adis->data[i++] = 0;
-					iio_adis->data[i++] = 0;
-				} else {
-					/* upper 16 */
-					iio_adis->data[i++] = data.y_accel_msb;
-					/* lower 16 */
-					iio_adis->data[i++] =  data.y_accel_lsb;
-				}
-				break;
-			case ADIS_DELTA_VEL_Z:
-				if (!iio_adis->burst_sel) {
-					iio_adis->data[i++] = 0;
-					iio_adis->data[i++] = 0;
-				} else {
-					/* upper 16 */
-					iio_adis->data[i++] = data.z_accel_msb;
-					/* lower 16 */
-					iio_adis->data[i++] =  data.z_accel_lsb;
-				}
-				break;
-			default:
-				break;
+		/*
+		 * Unlike the single burst path, the checksum is checked here:
+		 * corrupted frames are dropped and reported by the data counter.
+		 */
+		ret = adis_read_burst_data_fifo(iio_adis->adis_dev, data, &nb_samples,
+						iio_adis->burst_size, iio_adis->burst_sel,
+						true);
+		if (ret && ret != -EAGAIN)
+			return ret;
+
+		if (!ret) {
+			nb_new = 0;
+			for (j = 0; j < nb_samples; j++)
+				if (adis_iio_update_data_cntr(iio_adis, buffer, &data[j]))
+					data[nb_new++] = data[j];
+
+			adis_burst_data_pack(data, nb_new, iio_adis->scan_map,
+					     iio_adis->scan_words, scans);
+
+			for (j = 0; j < nb_new; j++) {
+				ret = iio_buffer_push_scan(buffer,
+							   &scans[j * iio_adis->scan_words]);
+				if (ret)
+					return ret;
 			}
 		}
 	}
 
-	return iio_buffer_push_scan(buffer, &iio_adis->data[0]);
+	return 0;
 }
 
 /**
@@ -1717,7 +1711,7 @@ int adis_iio_trigger_handler(struct iio_device_data *dev_data)
 		return -EINVAL;
 
 	return adis_iio_trigger_push_single_sample(iio_adis,
-			dev_data->buffer->active_mask, dev_data->buffer, false);
+			dev_data->buffer, false);
 }
 
 /**
@@ -1756,26 +1750,34 @@ int adis_iio_trigger_handler_with_fifo(struct iio_device_data *dev_data)
 		fifo_cnt = dev_data->buffer->samples;
 
 	if (fifo_cnt > 2) {
-		/* Burst request */
-		ret = adis_iio_trigger_push_single_sample(iio_adis,
-				dev_data->buffer->active_mask, dev_data->buffer, true);
-		if (ret)
-			goto trig_enable;
-
-		/* From data-sheet, minimum time between reads */
-		no_os_udelay(10);
-
-		for (j = 0; j < fifo_cnt - 1; j++) {
+		if (adis->info->read_burst_data_fifo) {
+			/* Burst request and FIFO drain, chained in bulk transfers */
+			ret = adis_iio_trigger_push_fifo_samples(iio_adis,
+					dev_data->buffer, fifo_cnt);
+			if (ret)
+				goto trig_enable;
+		} else {
+			/* Burst request */
 			ret = adis_iio_trigger_push_single_sample(iio_adis,
-					dev_data->buffer->active_mask, dev_data->buffer, true);
+					dev_data->buffer, true);
 			if (ret)
 				goto trig_enable;
 
 			/* From data-sheet, minimum time between reads */
 			no_os_udelay(10);
+
+			for (j = 0; j < fifo_cnt - 1; j++) {
+				ret = adis_iio_trigger_push_single_sample(iio_adis,
+						dev_data->buffer, true);
+				if (ret)
+					goto trig_enable;
+
+				/* From data-sheet, minimum time between reads */
+				no_os_udelay(10);
+			}
 		}
 		ret = adis_iio_trigger_push_single_sample(iio_adis,
-				dev_data->buffer->active_mask, dev_data->buffer, false);
+				dev_data->buffer, false);
 		/* From data-sheet, minimum time between reads */
 		no_os_udelay(10);
 	}
@@ -214,7 +214,7 @@ struct adis_iio_dev {
 	struct iio_device *iio_dev;
 	/** Number of lost samples for the current buffer reading. */
 	uint16_t samples_lost;
-	/** Current data counter for the current buffer reading.*/
+	/** Data counter of the last sample-set, used in scaled sync mode. */
 	uint32_t data_cntr;
 	/** ADIS sampling frequency. */
 	uint32_t sampling_frequency;
@@ -226,6 +226,10 @@ struct adis_iio_dev {
 	uint32_t sync_mode;
 	/** Data buffer to store one sample-set. */
 	uint16_t data[26];
+	/** Burst data word index for each scan word, computed for active mask. */
+	uint8_t scan_map[26];
+	/** Number of 16-bit words in one scan. */
+	uint8_t scan_words;
 	/** True if iio device offers FIFO support for buffer reading. */
 	bool has_fifo;
 	/** Gyroscope measurement range value in text. */
@@ -366,6 +366,37 @@ int ade9000_set_egy_model(struct ade9000_dev *dev, enum ade9000_egy_model model,
 	return ade9000_write(dev, ADE9000_REG_RUN, 1);
 }
 
+/**
+ * @brief Read a register for the waveform buffer streaming.
+ * @param dev - The device structure.
+ * @param reg_addr - The register address.
+ * @param reg_data - The data read from the register.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+static int ade9000_wfb_reg_read(void *dev, uint16_t reg_addr,
+				uint32_t *reg_data)
+{
+	return ade9000_read(dev, reg_addr, reg_data);
+}
+
+/**
+ * @brief Write a register for the waveform buffer streaming.
+ * @param dev - The device structure.
+ * @param reg_addr - The register address.
+ * @param reg_data - The data to be written.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+static int ade9000_wfb_reg_write(void *dev, uint16_t reg_addr,
+				 uint32_t reg_data)
+{
+	return ade9000_write(dev, reg_addr, reg_data);
+}
+
+static const struct ade9xxx_wfb_ops ade9000_wfb_ops = {
+	.reg_read = ade9000_wfb_reg_read,
+	.reg_write = ade9000_wfb_reg_write,
+};
+
 /**
  * @brief Initialize the device.
  * @param device - The device structure.
@@ -391,6 +422,12 @@ int ade9000_init(struct ade9000_dev **device,
 	if (ret)
 		goto error_dev;
 
+	dev->wfb.dev = dev;
+	dev->wfb.ops = &ade9000_wfb_ops;
+	dev->wfb.spi_desc = dev->spi_desc;
+	dev->wfb.sinc4_rate = ADE9000_WFB_SINC4_RATE;
+	dev->wfb.rate = ADE9000_WFB_RATE;
+
 	ret = ade9000_update_bits(dev, ADE9000_REG_CONFIG1, ADE9000_SWRST,
 				  no_os_field_prep(ADE9000_SWRST, 1));
 	if (ret)
@@ -500,6 +537,8 @@ int ade9000_remove(struct ade9000_dev *dev)
 {
 	int ret;
 
+	no_os_free(dev->wfb.buf);
+
 	ret = no_os_spi_remove(dev->spi_desc);
 	if (ret)
 		return ret;
@@ -38,6 +38,7 @@
 #include <string.h>
 #include "no_os_util.h"
 #include "no_os_spi.h"
+#include "ade9xxx_wfb.h"
 
 /* SPI commands */
 #define ADE9000_SPI_READ		NO_OS_BIT(3)
@@ -826,7 +827,7 @@
 /* ADE9000_REG_WFB_CFG Bit Definition */
 #define ADE9000_WF_IN_EN		NO_OS_BIT(12)
 #define ADE9000_WF_SRC			NO_OS_GENMASK(9, 8)
-#define ADE9000_WF_MODE			NO_OS_BIT(7, 6)
+#define ADE9000_WF_MODE			NO_OS_GENMASK(7, 6)
 #define ADE9000_WF_CAP_SEL		NO_OS_BIT(5)
 #define ADE9000_WF_CAP_EN		NO_OS_BIT(4)
 #define ADE9000_BURST_CHAN		NO_OS_GENMASK(3, 0)
@@ -914,6 +915,11 @@
 /* Miscellaneous Definitions */
 #define ADE9000_CHIP_ID			0x63
 
+/* Waveform buffer fixed data rate of the sinc4 source and of the other
+ * sources, in Hz */
+#define ADE9000_WFB_SINC4_RATE		32000
+#define ADE9000_WFB_RATE		8000
+
 /*Configuration registers*/
 /*PGA@0x0000. Gain of all channels=1*/
 #define ADE9000_PGA_GAIN 		0x0000
@@ -1382,6 +1388,8 @@ struct ade9000_dev {
 	uint32_t			vrms_val;
 	/** Variable storing the temperature value in degrees */
 	int32_t				temp_deg;
+	/** Waveform buffer streaming */
+	struct ade9xxx_wfb		wfb;
 };
 
 /* Read device register. */
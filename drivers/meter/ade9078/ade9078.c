@@ -363,6 +363,37 @@ int ade9078_set_egy_model(struct ade9078_dev *dev, enum ade9078_egy_model model,
 	return ade9078_write(dev, ADE9078_REG_RUN, 1);
 }
 
+/**
+ * @brief Read a register for the waveform buffer streaming.
+ * @param dev - The device structure.
+ * @param reg_addr - The register address.
+ * @param reg_data - The data read from the register.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+static int ade9078_wfb_reg_read(void *dev, uint16_t reg_addr,
+				uint32_t *reg_data)
+{
+	return ade9078_read(dev, reg_addr, reg_data);
+}
+
+/**
+ * @brief Write a register for the waveform buffer streaming.
+ * @param dev - The device structure.
+ * @param reg_addr - The register address.
+ * @param reg_data - The data to be written.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+static int ade9078_wfb_reg_write(void *dev, uint16_t reg_addr,
+				 uint32_t reg_data)
+{
+	return ade9078_write(dev, reg_addr, reg_data);
+}
+
+static const struct ade9xxx_wfb_ops ade9078_wfb_ops = {
+	.reg_read = ade9078_wfb_reg_read,
+	.reg_write = ade9078_wfb_reg_write,
+};
+
 /**
  * @brief Initialize the device.
  * @param device - The device structure.
@@ -390,6 +421,12 @@ int ade9078_init(struct ade9078_dev **device,
 	if (ret)
 		goto error_dev;
 
+	dev->wfb.dev = dev;
+	dev->wfb.ops = &ade9078_wfb_ops;
+	dev->wfb.spi_desc = dev->spi_desc;
+	dev->wfb.sinc4_rate = ADE9078_WFB_SINC4_RATE;
+	dev->wfb.rate = ADE9078_WFB_RATE;
+
 	/* Set power mode */
 	dev->power_mode = init_param.power_mode;
 	if (!init_param.psm0_desc)
@@ -520,6 +557,8 @@ int ade9078_remove(struct ade9078_dev *dev)
 {
 	int ret;
 
+	no_os_free(dev->wfb.buf);
+
 	ret = no_os_spi_remove(dev->spi_desc);
 	if (ret)
 		return ret;
@@ -40,6 +40,7 @@
 #include "no_os_spi.h"
 #include "no_os_gpio.h"
 #include "no_os_print_log.h"
+#include "ade9xxx_wfb.h"
 
 /* SPI commands */
 #define ADE9078_SPI_READ		NO_OS_BIT(3)
@@ -581,7 +582,7 @@
 /* ADE9078_REG_WFB_CFG Bit Definition */
 #define ADE9078_WF_IN_EN		NO_OS_BIT(12)
 #define ADE9078_WF_SRC			NO_OS_GENMASK(9, 8)
-#define ADE9078_WF_MODE			NO_OS_BIT(7, 6)
+#define ADE9078_WF_MODE			NO_OS_GENMASK(7, 6)
 #define ADE9078_WF_CAP_SEL		NO_OS_BIT(5)
 #define ADE9078_WF_CAP_EN		NO_OS_BIT(4)
 #define ADE9078_BURST_CHAN		NO_OS_GENMASK(3, 0)
@@ -659,6 +660,11 @@
 #define ADE9078_PART_ID         	0
 #define ADE9078_RESET_RECOVER   	100
 
+/* Waveform buffer fixed data rate of the sinc4 source and of the other
+ * sources, in Hz */
+#define ADE9078_WFB_SINC4_RATE		16000
+#define ADE9078_WFB_RATE		4000
+
 /*Configuration registers*/
 /*PGA@0x0000. Gain of all channels=1*/
 #define ADE9078_PGA_GAIN 		0x0000
@@ -934,9 +940,9 @@ enum ade9078_zx_select_e {
     ready update rate) selection
  */
 enum ade9078_wf_src_e {
-	/* Sinc4 output at 32 kSPS */
+	/* Sinc4 output at 16 kSPS */
 	ADE9078_SRC_SINC4,
-	/* Sinc4 + IIR LPF output at 8 kSPS */
+	/* Sinc4 + IIR LPF output at 4 kSPS */
 	ADE9078_SRC_SINC4_IIR = 2,
 	/* Current and voltage channel waveform samples,
 	processed by the DSP (xI_PCF, xV_PCF) at 4 kSPS */
@@ -1172,6 +1178,8 @@ struct ade9078_dev {
 	uint32_t			vrms_val;
 	/* Variable for mode selection */
 	uint8_t             		power_mode;
+	/* Waveform buffer streaming */
+	struct ade9xxx_wfb		wfb;
 };
 
 /* Read device register. */
@@ -0,0 +1,101 @@
+/***************************************************************************//**
+ *   @file   iio_ade9078.c
+ *   @brief  Implementation of the ADE9078 IIO driver.
+********************************************************************************
+ * Copyright 2026(c) Analog Devices, Inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Analog Devices, Inc. nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ANALOG DEVICES, INC. “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL ANALOG DEVICES, INC. BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+#include <errno.h>
+#include "iio_ade9078.h"
+#include "ade9078.h"
+#include "no_os_alloc.h"
+
+/**
+ * @brief Initializes the ADE9078 IIO driver, which streams the waveform buffer
+ * through ade9xxx_wfb_iio_dev.
+ * @param iio_dev - The iio device structure.
+ * @param init_param - Parameters for the initialization of iio_dev
+ * @return 0 in case of success, errno errors otherwise
+ */
+int ade9078_iio_init(struct ade9078_iio_desc **iio_dev,
+		     struct ade9078_iio_desc_init_param *init_param)
+{
+	int ret;
+	struct ade9078_iio_desc *descriptor;
+
+	if (!init_param)
+		return -EINVAL;
+
+	descriptor = no_os_calloc(1, sizeof(*descriptor));
+	if (!descriptor)
+		return -ENOMEM;
+
+	ret = ade9078_init(&descriptor->ade9078_dev,
+			   init_param->ade9078_init_param);
+	if (ret)
+		goto free_desc;
+
+	ret = ade9078_setup(descriptor->ade9078_dev);
+	if (ret)
+		goto free_dev;
+
+	ret = ade9xxx_wfb_iio_setup(&descriptor->wfb_iio,
+				    &descriptor->ade9078_dev->wfb,
+				    &init_param->wfb_config);
+	if (ret)
+		goto free_dev;
+
+	descriptor->iio_dev = &ade9xxx_wfb_iio_dev;
+
+	*iio_dev = descriptor;
+
+	return 0;
+free_dev:
+	ade9078_remove(descriptor->ade9078_dev);
+free_desc:
+	no_os_free(descriptor);
+	return ret;
+}
+
+/**
+ * @brief Free resources allocated by the init function
+ * @param desc - The iio device structure.
+ * @return 0 in case of success, errno errors otherwise
+ */
+int ade9078_iio_remove(struct ade9078_iio_desc *desc)
+{
+	int ret;
+
+	ret = ade9078_remove(desc->ade9078_dev);
+	if (ret)
+		return ret;
+
+	no_os_free(desc);
+
+	return 0;
+}
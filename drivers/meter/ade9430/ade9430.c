@@ -267,6 +267,37 @@ int ade9430_set_egy_model(struct ade9430_dev *dev, enum ade9430_egy_model model,
 	return ade9430_write(dev, ADE9430_REG_RUN, 1);
 }
 
+/**
+ * @brief Read a register for the waveform buffer streaming.
+ * @param dev - The device structure.
+ * @param reg_addr - The register address.
+ * @param reg_data - The data read from the register.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+static int ade9430_wfb_reg_read(void *dev, uint16_t reg_addr,
+				uint32_t *reg_data)
+{
+	return ade9430_read(dev, reg_addr, reg_data);
+}
+
+/**
+ * @brief Write a register for the waveform buffer streaming.
+ * @param dev - The device structure.
+ * @param reg_addr - The register address.
+ * @param reg_data - The data to be written.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+static int ade9430_wfb_reg_write(void *dev, uint16_t reg_addr,
+				 uint32_t reg_data)
+{
+	return ade9430_write(dev, reg_addr, reg_data);
+}
+
+static const struct ade9xxx_wfb_ops ade9430_wfb_ops = {
+	.reg_read = ade9430_wfb_reg_read,
+	.reg_write = ade9430_wfb_reg_write,
+};
+
 /**
  * @brief Initialize the device.
  * @param device - The device structure.
@@ -290,6 +321,12 @@ int ade9430_init(struct ade9430_dev **device,
 	if (ret)
 		goto error_dev;
 
+	dev->wfb.dev = dev;
+	dev->wfb.ops = &ade9430_wfb_ops;
+	dev->wfb.spi_desc = dev->spi_desc;
+	dev->wfb.sinc4_rate = ADE9430_WFB_SINC4_RATE;
+	dev->wfb.rate = ADE9430_WFB_RATE;
+
 	ret = ade9430_update_bits(dev, ADE9430_REG_CONFIG1, ADE9430_SWRST,
 				  no_os_field_prep(ADE9430_SWRST, 1));
 	if (ret)
@@ -337,6 +374,8 @@ int ade9430_remove(struct ade9430_dev *dev)
 {
 	int ret;
 
+	no_os_free(dev->wfb.buf);
+
 	ret = no_os_spi_remove(dev->spi_desc);
 	if (ret)
 		return ret;
@@ -38,6 +38,7 @@
 #include <string.h>
 #include "no_os_util.h"
 #include "no_os_spi.h"
+#include "ade9xxx_wfb.h"
 
 /* SPI commands */
 #define ADE9430_SPI_READ		NO_OS_BIT(3)
@@ -753,7 +754,7 @@
 /* ADE9430_REG_WFB_CFG Bit Definition */
 #define ADE9430_WF_IN_EN		NO_OS_BIT(12)
 #define ADE9430_WF_SRC			NO_OS_GENMASK(9, 8)
-#define ADE9430_WF_MODE			NO_OS_BIT(7, 6)
+#define ADE9430_WF_MODE			NO_OS_GENMASK(7, 6)
 #define ADE9430_WF_CAP_SEL		NO_OS_BIT(5)
 #define ADE9430_WF_CAP_EN		NO_OS_BIT(4)
 #define ADE9430_BURST_CHAN		NO_OS_GENMASK(3, 0)
@@ -838,6 +839,11 @@
 #define ADE9430_V_RES_NV		13357ULL
 #define ADE9430_W_RES_UW		7203ULL
 
+/* Waveform buffer fixed data rate of the sinc4 source and of the other
+ * sources, in Hz */
+#define ADE9430_WFB_SINC4_RATE		32000
+#define ADE9430_WFB_RATE		8000
+
 /**
  * @enum ade9430_phase
  * @brief ADE9430 available phases.
@@ -884,6 +890,8 @@ struct ade9430_dev {
 	uint32_t			vrms_val;
 	/** Variable storing the temperature value in degrees */
 	int32_t				temp_deg;
+	/** Waveform buffer streaming */
+	struct ade9xxx_wfb		wfb;
 };
 
 /* Read device register. */
@@ -0,0 +1,102 @@
+/***************************************************************************//**
+ *   @file   iio_ade9430.c
+ *   @brief  Implementation of the ADE9430 IIO driver.
+********************************************************************************
+ * Copyright 2026(c) Analog Devices, Inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Analog Devices, Inc. nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ANALOG DEVICES, INC. “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL ANALOG DEVICES, INC. BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+#include <errno.h>
+#include "iio_ade9430.h"
+#include "ade9430.h"
+#include "no_os_alloc.h"
+
+/**
+ * @brief Initializes the ADE9430 IIO driver, which streams the waveform buffer
+ * through ade9xxx_wfb_iio_dev.
+ * @param iio_dev - The iio device structure.
+ * @param init_param - Parameters for the initialization of iio_dev
+ * @return 0 in case of success, errno errors otherwise
+ */
+int ade9430_iio_init(struct ade9430_iio_desc **iio_dev,
+		     struct ade9430_iio_desc_init_param *init_param)
+{
+	int ret;
+	struct ade9430_iio_desc *descriptor;
+
+	if (!init_param)
+		return -EINVAL;
+
+	descriptor = no_os_calloc(1, sizeof(*descriptor));
+	if (!descriptor)
+		return -ENOMEM;
+
+	ret = ade9430_init(&descriptor->ade9430_dev,
+			   init_param->ade9430_init_param);
+	if (ret)
+		goto free_desc;
+
+	/* start the DSP, which fills the waveform buffer */
+	ret = ade9430_write(descriptor->ade9430_dev, ADE9430_REG_RUN, 1);
+	if (ret)
+		goto free_dev;
+
+	ret = ade9xxx_wfb_iio_setup(&descriptor->wfb_iio,
+				    &descriptor->ade9430_dev->wfb,
+				    &init_param->wfb_config);
+	if (ret)
+		goto free_dev;
+
+	descriptor->iio_dev = &ade9xxx_wfb_iio_dev;
+
+	*iio_dev = descriptor;
+
+	return 0;
+free_dev:
+	ade9430_remove(descriptor->ade9430_dev);
+free_desc:
+	no_os_free(descriptor);
+	return ret;
+}
+
+/**
+ * @brief Free resources allocated by the init function
+ * @param desc - The iio device structure.
+ * @return 0 in case of success, errno errors otherwise
+ */
+int ade9430_iio_remove(struct ade9430_iio_desc *desc)
+{
+	int ret;
+
+	ret = ade9430_remove(desc->ade9430_dev);
+	if (ret)
+		return ret;
+
+	no_os_free(desc);
+
+	return 0;
+}
@@ -0,0 +1,57 @@
+/***************************************************************************//**
+ *   @file   iio_ade9430.h
+ *   @brief  Header file of the ADE9430 IIO driver.
+********************************************************************************
+ * Copyright 2026(c) Analog Devices, Inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Analog Devices, Inc. nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ANALOG DEVICES, INC. “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL ANALOG DEVICES, INC. BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+#ifndef IIO_ADE9430_H
+#define IIO_ADE9430_H
+
+#include "iio.h"
+#include "iio_ade9xxx_wfb.h"
+#include "ade9430.h"
+
+struct ade9430_iio_desc {
+	/* First, so that the IIO callbacks get it from the descriptor */
+	struct ade9xxx_wfb_iio_desc wfb_iio;
+	struct ade9430_dev *ade9430_dev;
+	struct iio_device *iio_dev;
+};
+
+struct ade9430_iio_desc_init_param {
+	struct ade9430_init_param ade9430_init_param;
+	/* Waveform buffer streaming configuration */
+	struct ade9xxx_wfb_config wfb_config;
+};
+
+int ade9430_iio_init(struct ade9430_iio_desc **,
+		     struct ade9430_iio_desc_init_param *);
+int ade9430_iio_remove(struct ade9430_iio_desc *);
+
+#endif
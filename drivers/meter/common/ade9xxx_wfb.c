@@ -0,0 +1,346 @@
+/***************************************************************************//**
+ *   @file   ade9xxx_wfb.c
+ *   @brief  Implementation of the ADE9000 family waveform buffer streaming.
+********************************************************************************
+ * Copyright 2026(c) Analog Devices, Inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Analog Devices, Inc. nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ANALOG DEVICES, INC. “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL ANALOG DEVICES, INC. BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+#include <errno.h>
+#include "ade9xxx_wfb.h"
+#include "no_os_alloc.h"
+
+/**
+ * @brief Update register bits of the part.
+ * @param wfb - The waveform buffer structure.
+ * @param reg_addr - The register address.
+ * @param mask - The mask of the bits to update.
+ * @param reg_data - The new value of the bits.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+static int ade9xxx_wfb_update_bits(struct ade9xxx_wfb *wfb, uint16_t reg_addr,
+				   uint32_t mask, uint32_t reg_data)
+{
+	int ret;
+	uint32_t data;
+
+	ret = wfb->ops->reg_read(wfb->dev, reg_addr, &data);
+	if (ret)
+		return ret;
+
+	data &= ~mask;
+	data |= reg_data & mask;
+
+	return wfb->ops->reg_write(wfb->dev, reg_addr, data);
+}
+
+/**
+ * @brief Most recent block of pages_per_irq pages whose last page is filled.
+ * @param wfb - The waveform buffer structure.
+ * @param stat - WFB_TRG_STAT register value.
+ * @return The block index.
+ */
+static uint8_t ade9xxx_wfb_last_block(struct ade9xxx_wfb *wfb, uint32_t stat)
+{
+	uint8_t nb_blocks = ADE9XXX_WFB_NB_PAGES / wfb->pages_per_irq;
+
+	return ((no_os_field_get(ADE9XXX_WFB_LAST_PAGE, stat) + 1) /
+		wfb->pages_per_irq + nb_blocks - 1) % nb_blocks;
+}
+
+/**
+ * @brief Start streaming the fixed data rate waveform buffer. The buffer is
+ * filled continuously with sets of 32-bit samples of all the channels and a
+ * PAGE_FULL interrupt is raised on IRQ0 each time pages_per_irq pages are
+ * filled, after which ade9xxx_wfb_read() reads them in a single burst.
+ * @param wfb - The waveform buffer structure.
+ * @param config - Streaming configuration.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+int ade9xxx_wfb_start(struct ade9xxx_wfb *wfb,
+		      const struct ade9xxx_wfb_config *config)
+{
+	int ret;
+	/* PAGE_FULL interrupt enable of each page */
+	uint32_t irqen = 0;
+	/* waveform buffer configuration */
+	uint32_t cfg;
+	/* page index */
+	uint8_t page;
+
+	if (!wfb || !wfb->ops)
+		return -ENODEV;
+	if (!config || !config->pages_per_irq ||
+	    config->pages_per_irq > ADE9XXX_WFB_NB_PAGES / 2 ||
+	    ADE9XXX_WFB_NB_PAGES % config->pages_per_irq)
+		return -EINVAL;
+	if (config->src != ADE9XXX_WFB_SRC_SINC4 &&
+	    config->src != ADE9XXX_WFB_SRC_SINC4_IIR &&
+	    config->src != ADE9XXX_WFB_SRC_DSP)
+		return -EINVAL;
+
+	ret = ade9xxx_wfb_stop(wfb);
+	if (ret)
+		return ret;
+
+	wfb->buf = no_os_calloc(1, 2 + config->pages_per_irq *
+				ADE9XXX_WFB_PAGE_WORDS * sizeof(uint32_t));
+	if (!wfb->buf)
+		return -ENOMEM;
+
+	/* interrupt on the last page of each block */
+	for (page = config->pages_per_irq - 1; page < ADE9XXX_WFB_NB_PAGES;
+	     page += config->pages_per_irq)
+		irqen |= NO_OS_BIT(page);
+
+	ret = wfb->ops->reg_write(wfb->dev, ADE9XXX_REG_WFB_PG_IRQEN, irqen);
+	if (ret)
+		goto error_stop;
+
+	/* no trigger event enabled, so the buffer is filled continuously */
+	ret = wfb->ops->reg_write(wfb->dev, ADE9XXX_REG_WFB_TRG_CFG, 0);
+	if (ret)
+		goto error_stop;
+
+	ret = wfb->ops->reg_write(wfb->dev, ADE9XXX_REG_STATUS0,
+				  ADE9XXX_PAGE_FULL);
+	if (ret)
+		goto error_stop;
+
+	ret = ade9xxx_wfb_update_bits(wfb, ADE9XXX_REG_MASK0, ADE9XXX_PAGE_FULL,
+				      ADE9XXX_PAGE_FULL);
+	if (ret)
+		goto error_stop;
+
+	cfg = ADE9XXX_WF_CAP_SEL |
+	      no_os_field_prep(ADE9XXX_WF_MODE, ADE9XXX_MODE_TRIG_EN_EVENTS) |
+	      no_os_field_prep(ADE9XXX_WF_SRC, config->src) |
+	      no_os_field_prep(ADE9XXX_WF_IN_EN, config->in_en) |
+	      no_os_field_prep(ADE9XXX_BURST_CHAN, ADE9XXX_BURST_ALL_CH);
+
+	ret = wfb->ops->reg_write(wfb->dev, ADE9XXX_REG_WFB_CFG, cfg);
+	if (ret)
+		goto error_stop;
+
+	wfb->src = config->src;
+	wfb->in_en = config->in_en;
+	wfb->pages_per_irq = config->pages_per_irq;
+	/* the first block filled is block 0 */
+	wfb->last_block = ADE9XXX_WFB_NB_PAGES / config->pages_per_irq - 1;
+	wfb->nb_unread = 0;
+
+	ret = wfb->ops->reg_write(wfb->dev, ADE9XXX_REG_WFB_CFG,
+				  cfg | ADE9XXX_WF_CAP_EN);
+	if (ret)
+		goto error_stop;
+
+	return 0;
+
+error_stop:
+	ade9xxx_wfb_stop(wfb);
+
+	return ret;
+}
+
+/**
+ * @brief Burst read the oldest filled block of waveform buffer pages not read
+ * yet, to be called on the PAGE_FULL interrupt and again while
+ * wfb->nb_unread is not 0. The burst goes through SPI DMA when the platform
+ * supports it. IN samples read 0 unless in_en is set in the streaming
+ * configuration.
+ *
+ * A set PAGE_FULL status bit tells that at least one block was filled since
+ * the previous check, so a last filled block equal to the one seen then means
+ * that the whole buffer was filled over. The blocks overwritten before being
+ * read are reported as lost, a whole buffer filled over being counted once.
+ * @param wfb - The waveform buffer structure.
+ * @param samples - Interleaved samples of the ADE9XXX_WFB_NB_CHANNELS
+ * 		channels, room for pages_per_irq * ADE9XXX_WFB_PAGE_SETS sets.
+ * @param nb_sets - Number of sample sets read, 0 if no block was filled.
+ * @param nb_lost - Number of sample sets overwritten before being read.
+ * 		Optional.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+int ade9xxx_wfb_read(struct ade9xxx_wfb *wfb, int32_t *samples,
+		     uint16_t *nb_sets, uint16_t *nb_lost)
+{
+	int ret;
+	/* number of blocks in the buffer */
+	uint8_t nb_blocks;
+	/* last filled block, block to be read and number of blocks lost */
+	uint8_t last, block, lost = 0;
+	/* STATUS0 and trigger status register values */
+	uint32_t status, stat, prev_stat;
+	/* sets of the block */
+	uint16_t sets;
+	/* first word of the block */
+	uint16_t addr;
+	/* sample set and channel index */
+	uint16_t i, ch;
+	/* sample in the burst, the channels being in the set layout order */
+	uint8_t *set;
+	/* burst read of the block */
+	struct no_os_spi_msg msg = {
+		.cs_change = 1,
+	};
+
+	if (!wfb || !wfb->ops)
+		return -ENODEV;
+	if (!samples || !nb_sets || !wfb->pages_per_irq)
+		return -EINVAL;
+
+	*nb_sets = 0;
+	if (nb_lost)
+		*nb_lost = 0;
+
+	nb_blocks = ADE9XXX_WFB_NB_PAGES / wfb->pages_per_irq;
+
+	ret = wfb->ops->reg_read(wfb->dev, ADE9XXX_REG_STATUS0, &status);
+	if (ret)
+		return ret;
+
+	if (status & ADE9XXX_PAGE_FULL) {
+		ret = wfb->ops->reg_read(wfb->dev, ADE9XXX_REG_WFB_TRG_STAT, &stat);
+		if (ret)
+			return ret;
+
+		/*
+		 * Clear PAGE_FULL until no block is filled around the clear, so
+		 * that the blocks filled before it are all seen here and any
+		 * later one raises PAGE_FULL again.
+		 */
+		do {
+			prev_stat = stat;
+
+			ret = wfb->ops->reg_write(wfb->dev, ADE9XXX_REG_STATUS0,
+						  ADE9XXX_PAGE_FULL);
+			if (ret)
+				return ret;
+
+			ret = wfb->ops->reg_read(wfb->dev, ADE9XXX_REG_WFB_TRG_STAT,
+						 &stat);
+			if (ret)
+				return ret;
+		} while (ade9xxx_wfb_last_block(wfb, stat) !=
+			 ade9xxx_wfb_last_block(wfb, prev_stat));
+
+		last = ade9xxx_wfb_last_block(wfb, stat);
+		/* the same last block again means the buffer was filled over */
+		wfb->nb_unread += (last + nb_blocks - wfb->last_block - 1) %
+				  nb_blocks + 1;
+		wfb->last_block = last;
+
+		/* the block after the last one is being filled over */
+		if (wfb->nb_unread > nb_blocks - 1) {
+			lost = wfb->nb_unread - (nb_blocks - 1);
+			wfb->nb_unread = nb_blocks - 1;
+		}
+	}
+
+	if (!wfb->nb_unread)
+		return 0;
+
+	block = (wfb->last_block + nb_blocks + 1 - wfb->nb_unread) % nb_blocks;
+	addr = ADE9XXX_WFB_ADDR + block * wfb->pages_per_irq *
+	       ADE9XXX_WFB_PAGE_WORDS;
+	no_os_put_unaligned_be16((addr << 4) | ADE9XXX_SPI_READ, wfb->buf);
+
+	msg.tx_buff = wfb->buf;
+	msg.rx_buff = wfb->buf;
+	msg.bytes_number = 2 + wfb->pages_per_irq * ADE9XXX_WFB_PAGE_WORDS *
+			   sizeof(uint32_t);
+	ret = no_os_spi_transfer_dma(wfb->spi_desc, &msg, 1);
+	if (ret == -ENOSYS)
+		ret = no_os_spi_write_and_read(wfb->spi_desc, wfb->buf,
+					       msg.bytes_number);
+	if (ret)
+		return ret;
+
+	sets = wfb->pages_per_irq * ADE9XXX_WFB_PAGE_SETS;
+	for (i = 0; i < sets; i++) {
+		set = &wfb->buf[2 + i * ADE9XXX_WFB_SET_WORDS * sizeof(uint32_t)];
+		for (ch = 0; ch < ADE9XXX_WFB_NB_CHANNELS;
+		     ch++, set += sizeof(uint32_t))
+			samples[i * ADE9XXX_WFB_NB_CHANNELS + ch] =
+				(int32_t)no_os_get_unaligned_be32(set);
+		if (!wfb->in_en)
+			samples[i * ADE9XXX_WFB_NB_CHANNELS + ADE9XXX_WFB_CH_IN] = 0;
+	}
+
+	wfb->nb_unread--;
+	*nb_sets = sets;
+	if (nb_lost)
+		*nb_lost = lost * sets;
+
+	return 0;
+}
+
+/**
+ * @brief Stop streaming the waveform buffer and release the burst buffer.
+ * @param wfb - The waveform buffer structure.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+int ade9xxx_wfb_stop(struct ade9xxx_wfb *wfb)
+{
+	int ret;
+
+	if (!wfb || !wfb->ops)
+		return -ENODEV;
+
+	no_os_free(wfb->buf);
+	wfb->buf = NULL;
+	wfb->pages_per_irq = 0;
+	wfb->nb_unread = 0;
+
+	ret = ade9xxx_wfb_update_bits(wfb, ADE9XXX_REG_WFB_CFG,
+				      ADE9XXX_WF_CAP_EN, 0);
+	if (ret)
+		return ret;
+
+	ret = ade9xxx_wfb_update_bits(wfb, ADE9XXX_REG_MASK0, ADE9XXX_PAGE_FULL,
+				      0);
+	if (ret)
+		return ret;
+
+	return wfb->ops->reg_write(wfb->dev, ADE9XXX_REG_WFB_PG_IRQEN, 0);
+}
+
+/**
+ * @brief Waveform buffer sample rate.
+ * @param wfb - The waveform buffer structure.
+ * @return The sample rate in Hz of the configured source.
+ */
+uint32_t ade9xxx_wfb_sample_rate(struct ade9xxx_wfb *wfb)
+{
+	if (!wfb)
+		return 0;
+
+	if (wfb->src == ADE9XXX_WFB_SRC_SINC4)
+		return wfb->sinc4_rate;
+
+	return wfb->rate;
+}
@@ -0,0 +1,168 @@
+/***************************************************************************//**
+ *   @file   ade9xxx_wfb.h
+ *   @brief  Header file of the ADE9000 family waveform buffer streaming.
+********************************************************************************
+ * Copyright 2026(c) Analog Devices, Inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Analog Devices, Inc. nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ANALOG DEVICES, INC. “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL ANALOG DEVICES, INC. BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+#ifndef __ADE9XXX_WFB_H__
+#define __ADE9XXX_WFB_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "no_os_util.h"
+#include "no_os_spi.h"
+
+/*
+ * Waveform buffer registers and bits, at the same addresses on the ADE9000,
+ * ADE9078 and ADE9430.
+ */
+#define ADE9XXX_SPI_READ		NO_OS_BIT(3)
+
+#define ADE9XXX_REG_STATUS0		0x0402
+#define ADE9XXX_REG_MASK0		0x0405
+#define ADE9XXX_REG_WFB_CFG		0x04A0
+#define ADE9XXX_REG_WFB_PG_IRQEN	0x04A1
+#define ADE9XXX_REG_WFB_TRG_CFG		0x04A2
+#define ADE9XXX_REG_WFB_TRG_STAT	0x04A3
+
+/* ADE9XXX_REG_STATUS0 and ADE9XXX_REG_MASK0 Bit Definition */
+#define ADE9XXX_PAGE_FULL		NO_OS_BIT(17)
+
+/* ADE9XXX_REG_WFB_CFG Bit Definition */
+#define ADE9XXX_WF_IN_EN		NO_OS_BIT(12)
+#define ADE9XXX_WF_SRC			NO_OS_GENMASK(9, 8)
+#define ADE9XXX_WF_MODE			NO_OS_GENMASK(7, 6)
+#define ADE9XXX_WF_CAP_SEL		NO_OS_BIT(5)
+#define ADE9XXX_WF_CAP_EN		NO_OS_BIT(4)
+#define ADE9XXX_BURST_CHAN		NO_OS_GENMASK(3, 0)
+
+/* ADE9XXX_REG_WFB_TRG_STAT Bit Definition */
+#define ADE9XXX_WFB_LAST_PAGE		NO_OS_GENMASK(15, 12)
+
+/* Continuous fill, stop only on enabled trigger events */
+#define ADE9XXX_MODE_TRIG_EN_EVENTS	1
+/* All the channels in each sample set */
+#define ADE9XXX_BURST_ALL_CH		0
+
+/* Waveform buffer memory: 16 pages of 128 32-bit words */
+#define ADE9XXX_WFB_ADDR		0x0800
+#define ADE9XXX_WFB_NB_PAGES		16
+#define ADE9XXX_WFB_PAGE_WORDS		128
+/*
+ * Fixed data rate sample set, read with BURST_CHAN = 0: the IA, VA, IB, VB,
+ * IC, VC and IN samples and an unused word. The IN word is written only
+ * when WF_IN_EN is set.
+ */
+#define ADE9XXX_WFB_SET_WORDS		8
+#define ADE9XXX_WFB_NB_CHANNELS		7
+#define ADE9XXX_WFB_CH_IN		6
+#define ADE9XXX_WFB_PAGE_SETS		(ADE9XXX_WFB_PAGE_WORDS / ADE9XXX_WFB_SET_WORDS)
+/* Largest block, in sample sets */
+#define ADE9XXX_WFB_MAX_SETS		(ADE9XXX_WFB_NB_PAGES / 2 * ADE9XXX_WFB_PAGE_SETS)
+
+/**
+ * @enum ade9xxx_wfb_src
+ * @brief Waveform buffer samples source, which also sets the data rate.
+ */
+enum ade9xxx_wfb_src {
+	/* Sinc4 output */
+	ADE9XXX_WFB_SRC_SINC4,
+	/* Sinc4 + IIR LPF output */
+	ADE9XXX_WFB_SRC_SINC4_IIR = 2,
+	/* Current and voltage samples processed by the DSP */
+	ADE9XXX_WFB_SRC_DSP
+};
+
+/**
+ * @struct ade9xxx_wfb_ops
+ * @brief Register access of the part owning the waveform buffer.
+ */
+struct ade9xxx_wfb_ops {
+	/** Read a register */
+	int (*reg_read)(void *dev, uint16_t reg_addr, uint32_t *reg_data);
+	/** Write a register */
+	int (*reg_write)(void *dev, uint16_t reg_addr, uint32_t reg_data);
+};
+
+/**
+ * @struct ade9xxx_wfb_config
+ * @brief Waveform buffer streaming configuration.
+ */
+struct ade9xxx_wfb_config {
+	/** Samples source, which also sets the data rate */
+	enum ade9xxx_wfb_src		src;
+	/** Store the neutral current samples */
+	bool				in_en;
+	/** Pages filled between two PAGE_FULL interrupts: 1, 2, 4 or 8 */
+	uint8_t				pages_per_irq;
+};
+
+/**
+ * @struct ade9xxx_wfb
+ * @brief Waveform buffer of a part, filled in by the part init function.
+ */
+struct ade9xxx_wfb {
+	/** Part device structure, passed to the ops */
+	void				*dev;
+	/** Part register access */
+	const struct ade9xxx_wfb_ops	*ops;
+	/** SPI descriptor of the part, for the burst reads */
+	struct no_os_spi_desc		*spi_desc;
+	/** Fixed data rate of the sinc4 source, in Hz */
+	uint32_t			sinc4_rate;
+	/** Fixed data rate of the other sources, in Hz */
+	uint32_t			rate;
+	/** Samples source */
+	enum ade9xxx_wfb_src		src;
+	/** Neutral current samples stored, while streaming */
+	bool				in_en;
+	/** Pages read on each PAGE_FULL interrupt, 0 when not streaming */
+	uint8_t				pages_per_irq;
+	/** Most recent block known to be filled */
+	uint8_t				last_block;
+	/** Filled blocks not read yet, oldest first, up to last_block */
+	uint8_t				nb_unread;
+	/** Burst read buffer, command and pages_per_irq pages */
+	uint8_t				*buf;
+};
+
+/* Start streaming the fixed data rate waveform buffer. */
+int ade9xxx_wfb_start(struct ade9xxx_wfb *wfb,
+		      const struct ade9xxx_wfb_config *config);
+
+/* Burst read the oldest filled block of waveform buffer pages. */
+int ade9xxx_wfb_read(struct ade9xxx_wfb *wfb, int32_t *samples,
+		     uint16_t *nb_sets, uint16_t *nb_lost);
+
+/* Stop streaming the waveform buffer. */
+int ade9xxx_wfb_stop(struct ade9xxx_wfb *wfb);
+
+/* Waveform buffer sample rate in Hz. */
+uint32_t ade9xxx_wfb_sample_rate(struct ade9xxx_wfb *wfb);
+
+#endif // __ADE9XXX_WFB_H__
@@ -0,0 +1,244 @@
+/***************************************************************************//**
+ *   @file   iio_ade9xxx_wfb.c
+ *   @brief  Implementation of the ADE9000 family waveform buffer IIO device.
+********************************************************************************
+ * Copyright 2026(c) Analog Devices, Inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Analog Devices, Inc. nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ANALOG DEVICES, INC. “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL ANALOG DEVICES, INC. BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+#include <errno.h>
+#include "iio_ade9xxx_wfb.h"
+#include "ade9xxx_wfb.h"
+#include "no_os_util.h"
+#include "iio.h"
+
+#define ADE9XXX_WFB_IIO_CHAN(_type, _index, _si) { \
+	.ch_type = _type, \
+	.indexed = true, \
+	.channel = _index, \
+	.attributes = ade9xxx_wfb_iio_attrs, \
+	.address = _si, \
+	.scan_index = _si, \
+	.scan_type = &ade9xxx_wfb_iio_scan_type, \
+}
+
+static int ade9xxx_wfb_iio_read_samp_freq(void *dev, char *buf, uint32_t len,
+		const struct iio_ch_info *channel,
+		intptr_t priv);
+static int ade9xxx_wfb_iio_reg_read(struct ade9xxx_wfb_iio_desc *dev,
+				    uint32_t reg, uint32_t *readval);
+static int ade9xxx_wfb_iio_reg_write(struct ade9xxx_wfb_iio_desc *dev,
+				     uint32_t reg, uint32_t writeval);
+static int32_t ade9xxx_wfb_iio_pre_enable(void *dev, uint32_t mask);
+static int32_t ade9xxx_wfb_iio_post_disable(void *dev);
+static int32_t ade9xxx_wfb_iio_trigger_handler(struct iio_device_data *dev_data);
+
+static struct scan_type ade9xxx_wfb_iio_scan_type = {
+	.sign = 's',
+	.realbits = 32,
+	.storagebits = 32,
+	.shift = 0,
+	.is_big_endian = false
+};
+
+static struct iio_attribute ade9xxx_wfb_iio_attrs[] = {
+	{
+		.name = "sampling_frequency",
+		.shared = IIO_SHARED_BY_ALL,
+		.show = ade9xxx_wfb_iio_read_samp_freq,
+		.store = NULL,
+	},
+	END_ATTRIBUTES_ARRAY
+};
+
+/* In the order of the waveform buffer sample sets */
+static struct iio_channel ade9xxx_wfb_iio_channels[] = {
+	ADE9XXX_WFB_IIO_CHAN(IIO_CURRENT, 0, 0),
+	ADE9XXX_WFB_IIO_CHAN(IIO_VOLTAGE, 0, 1),
+	ADE9XXX_WFB_IIO_CHAN(IIO_CURRENT, 1, 2),
+	ADE9XXX_WFB_IIO_CHAN(IIO_VOLTAGE, 1, 3),
+	ADE9XXX_WFB_IIO_CHAN(IIO_CURRENT, 2, 4),
+	ADE9XXX_WFB_IIO_CHAN(IIO_VOLTAGE, 2, 5),
+	ADE9XXX_WFB_IIO_CHAN(IIO_CURRENT, 3, 6),
+};
+
+struct iio_device ade9xxx_wfb_iio_dev = {
+	.num_ch = NO_OS_ARRAY_SIZE(ade9xxx_wfb_iio_channels),
+	.channels = ade9xxx_wfb_iio_channels,
+	.pre_enable = ade9xxx_wfb_iio_pre_enable,
+	.post_disable = ade9xxx_wfb_iio_post_disable,
+	.trigger_handler = ade9xxx_wfb_iio_trigger_handler,
+	.debug_reg_read = (int32_t (*)())ade9xxx_wfb_iio_reg_read,
+	.debug_reg_write = (int32_t (*)())ade9xxx_wfb_iio_reg_write,
+};
+
+/******************************************************************************/
+
+/**
+ * @brief Set up the waveform buffer IIO device of a part. The part IIO
+ * driver passes desc to the IIO callbacks of ade9xxx_wfb_iio_dev.
+ * @param desc - The waveform buffer IIO device structure.
+ * @param wfb - The waveform buffer of the initialized part.
+ * @param config - Streaming configuration, applied on buffer enable.
+ * @return 0 in case of success, errno errors otherwise
+ */
+int ade9xxx_wfb_iio_setup(struct ade9xxx_wfb_iio_desc *desc,
+			  struct ade9xxx_wfb *wfb,
+			  const struct ade9xxx_wfb_config *config)
+{
+	if (!desc || !wfb || !config)
+		return -EINVAL;
+
+	if (!config->pages_per_irq ||
+	    config->pages_per_irq > ADE9XXX_WFB_NB_PAGES / 2)
+		return -EINVAL;
+
+	desc->wfb = wfb;
+	desc->wfb_config = *config;
+	/* report the sample rate before the first buffer enable */
+	wfb->src = config->src;
+
+	return 0;
+}
+
+/**
+ * @brief Handles the read request for sampling_frequency attribute.
+ * @param dev     - The iio device structure.
+ * @param buf	  - Command buffer to be filled with requested data.
+ * @param len     - Length of the received command buffer in bytes.
+ * @param channel - Command channel info.
+ * @param priv    - Command attribute id.
+ * @return        - 0 in case of success, errno errors otherwise
+*/
+static int ade9xxx_wfb_iio_read_samp_freq(void *dev, char *buf, uint32_t len,
+		const struct iio_ch_info *channel,
+		intptr_t priv)
+{
+	struct ade9xxx_wfb_iio_desc *desc = dev;
+	int32_t val;
+
+	val = ade9xxx_wfb_sample_rate(desc->wfb);
+
+	return iio_format_value(buf, len, IIO_VAL_INT, 1, &val);
+}
+
+/**
+ * @brief Part IIO reg read wrapper
+ * @param dev - The iio device structure.
+ * @param reg - Register address
+ * @param readval - Register value
+ * @return 0 in case of success, errno errors otherwise
+ */
+static int ade9xxx_wfb_iio_reg_read(struct ade9xxx_wfb_iio_desc *dev,
+				    uint32_t reg, uint32_t *readval)
+{
+	return dev->wfb->ops->reg_read(dev->wfb->dev, (uint16_t)reg, readval);
+}
+
+/**
+ * @brief Part IIO reg write wrapper
+ * @param dev - The iio device structure.
+ * @param reg - Register address
+ * @param writeval - Register value
+ * @return 0 in case of success, errno errors otherwise
+ */
+static int ade9xxx_wfb_iio_reg_write(struct ade9xxx_wfb_iio_desc *dev,
+				     uint32_t reg, uint32_t writeval)
+{
+	return dev->wfb->ops->reg_write(dev->wfb->dev, (uint16_t)reg, writeval);
+}
+
+/**
+ * @brief Start streaming the waveform buffer.
+ * @param dev - The iio device structure.
+ * @param mask - Active IIO channels mask.
+ * @return 0 in case of success, errno errors otherwise
+ */
+static int32_t ade9xxx_wfb_iio_pre_enable(void *dev, uint32_t mask)
+{
+	struct ade9xxx_wfb_iio_desc *desc = dev;
+
+	/* IN samples are stored only when enabled in the configuration */
+	if (!desc->wfb_config.in_en && (mask & NO_OS_BIT(ADE9XXX_WFB_CH_IN)))
+		return -EINVAL;
+
+	desc->active_mask = mask;
+
+	return ade9xxx_wfb_start(desc->wfb, &desc->wfb_config);
+}
+
+/**
+ * @brief Stop streaming the waveform buffer.
+ * @param dev - The iio device structure.
+ * @return 0 in case of success, errno errors otherwise
+ */
+static int32_t ade9xxx_wfb_iio_post_disable(void *dev)
+{
+	struct ade9xxx_wfb_iio_desc *desc = dev;
+
+	return ade9xxx_wfb_stop(desc->wfb);
+}
+
+/**
+ * @brief Burst read the filled waveform buffer blocks, oldest first, and push
+ * the active channels of each sample set.
+ * @param dev_data - IIO device data.
+ * @return 0 in case of success, errno errors otherwise
+ */
+static int32_t ade9xxx_wfb_iio_trigger_handler(struct iio_device_data *dev_data)
+{
+	struct ade9xxx_wfb_iio_desc *desc = dev_data->dev;
+	int32_t scan[ADE9XXX_WFB_NB_CHANNELS];
+	int32_t *set;
+	uint16_t nb_sets, nb_lost;
+	uint16_t i;
+	uint8_t ch, n;
+	int ret;
+
+	do {
+		ret = ade9xxx_wfb_read(desc->wfb, desc->samples, &nb_sets,
+				       &nb_lost);
+		if (ret)
+			return ret;
+
+		iio_buffer_drop_scans(dev_data->buffer, nb_lost);
+
+		for (i = 0; i < nb_sets; i++) {
+			set = &desc->samples[i * ADE9XXX_WFB_NB_CHANNELS];
+			n = 0;
+			for (ch = 0; ch < ADE9XXX_WFB_NB_CHANNELS; ch++)
+				if (desc->active_mask & NO_OS_BIT(ch))
+					scan[n++] = set[ch];
+
+			ret = iio_buffer_push_scan(dev_data->buffer, scan);
+			if (ret)
+				return ret;
+		}
+	} while (desc->wfb->nb_unread);
+
+	return 0;
+}
@@ -0,0 +1,60 @@
+/***************************************************************************//**
+ *   @file   iio_ade9xxx_wfb.h
+ *   @brief  Header file of the ADE9000 family waveform buffer IIO device.
+********************************************************************************
+ * Copyright 2026(c) Analog Devices, Inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Analog Devices, Inc. nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ANALOG DEVICES, INC. “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL ANALOG DEVICES, INC. BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+#ifndef IIO_ADE9XXX_WFB_H
+#define IIO_ADE9XXX_WFB_H
+
+#include "iio.h"
+#include "ade9xxx_wfb.h"
+
+struct ade9xxx_wfb_iio_desc {
+	/* Waveform buffer of the part */
+	struct ade9xxx_wfb *wfb;
+	/* Waveform buffer streaming configuration */
+	struct ade9xxx_wfb_config wfb_config;
+	/* Active IIO channels mask */
+	uint32_t active_mask;
+	/* Sample sets of one waveform buffer block */
+	int32_t samples[ADE9XXX_WFB_MAX_SETS * ADE9XXX_WFB_NB_CHANNELS];
+};
+
+/* IIO device streaming the IA, VA, IB, VB, IC, VC and IN samples */
+extern struct iio_device ade9xxx_wfb_iio_dev;
+
+/* IRQ0 trigger, fired by the waveform buffer PAGE_FULL interrupt */
+extern struct iio_trigger ade9xxx_wfb_iio_trig_desc;
+
+int ade9xxx_wfb_iio_setup(struct ade9xxx_wfb_iio_desc *,
+			  struct ade9xxx_wfb *,
+			  const struct ade9xxx_wfb_config *);
+
+#endif
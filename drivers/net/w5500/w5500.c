@@ -38,6 +38,29 @@
 #include "no_os_alloc.h"
 #include "no_os_delay.h"
 
+/* Register accesses up to this length are copied into a single SPI message */
+#define W5500_SHORT_FRAME	8
+
+/* Socket interrupts used by the streaming mode */
+#define W5500_STREAM_IMR	(W5500_Sn_IR_SEND_OK | W5500_Sn_IR_TIMEOUT | \
+				 W5500_Sn_IR_RECV | W5500_Sn_IR_DISCON)
+
+/***************************************************************************//**
+ * @brief Fill the 3 byte address/control phase of a SPI frame
+ *
+ * @param hdr   - Header buffer, 3 bytes
+ * @param block - The block select bits
+ * @param addr  - The register or buffer address
+ * @param rwb   - W5500_RWB_READ or W5500_RWB_WRITE
+*******************************************************************************/
+static void w5500_frame_header(uint8_t *hdr, uint8_t block, uint16_t addr,
+			       uint8_t rwb)
+{
+	hdr[0] = W5500_BYTE_HIGH(addr);
+	hdr[1] = W5500_BYTE_LOW(addr);
+	hdr[2] = W5500_BSB(block) | rwb | W5500_OM_VDM;
+}
+
 /***************************************************************************//**
  * @brief Write data to a W5500 register
  *
@@ -52,22 +75,31 @@
 int w5500_reg_write(struct w5500_dev *dev, uint8_t block,
 		    uint16_t addr, const uint8_t *data, uint16_t len)
 {
-	uint8_t spi_tx[3 + len];
+	uint8_t spi_tx[3 + W5500_SHORT_FRAME];
+	struct no_os_spi_msg xfer[2] = {
+		{
+			.tx_buff = spi_tx,
+			.bytes_number = 3,
+			.cs_change = 1,
+		},
+	};
 
-	spi_tx[0] = W5500_BYTE_HIGH(addr);
-	spi_tx[1] = W5500_BYTE_LOW(addr);
-	spi_tx[2] = W5500_BSB(block) | W5500_RWB_WRITE | W5500_OM_VDM;
+	w5500_frame_header(spi_tx, block, addr, W5500_RWB_WRITE);
 
-	memcpy(&spi_tx[3], data, len);
+	/* Long payloads are sent in place, in the same CS frame as the header. */
+	if (len > W5500_SHORT_FRAME) {
+		xfer[0].cs_change = 0;
+		xfer[1].tx_buff = (uint8_t *)data;
+		xfer[1].bytes_number = len;
+		xfer[1].cs_change = 1;
 
-	struct no_os_spi_msg xfer = {
-		.tx_buff = spi_tx,
-		.rx_buff = NULL,
-		.bytes_number = 3 + len,
-		.cs_change = 1,
-	};
+		return no_os_spi_transfer(dev->spi, xfer, 2);
+	}
 
-	return no_os_spi_transfer(dev->spi, &xfer, 1);
+	memcpy(&spi_tx[3], data, len);
+	xfer[0].bytes_number += len;
+
+	return no_os_spi_transfer(dev->spi, xfer, 1);
 }
 
 /***************************************************************************//**
@@ -84,21 +116,32 @@ int w5500_reg_write(struct w5500_dev *dev, uint8_t block,
 int w5500_reg_read(struct w5500_dev *dev, uint8_t block,
 		   uint16_t addr, uint8_t *data, uint16_t len)
 {
-	uint8_t spi_buffer[3 + len];
+	uint8_t spi_buffer[3 + W5500_SHORT_FRAME];
+	struct no_os_spi_msg xfer[2] = {
+		{
+			.tx_buff = spi_buffer,
+			.bytes_number = 3,
+			.cs_change = 1,
+		},
+	};
 	int ret;
 
-	spi_buffer[0] = W5500_BYTE_HIGH(addr);
-	spi_buffer[1] = W5500_BYTE_LOW(addr);
-	spi_buffer[2] = W5500_BSB(block) | W5500_RWB_READ | W5500_OM_VDM;
+	w5500_frame_header(spi_buffer, block, addr, W5500_RWB_READ);
 
-	struct no_os_spi_msg xfer = {
-		.tx_buff = spi_buffer,
-		.rx_buff = spi_buffer,
-		.bytes_number = 3 + len,
-		.cs_change = 1,
-	};
+	/* Long payloads are received in place, without a bounce buffer. */
+	if (len > W5500_SHORT_FRAME) {
+		xfer[0].cs_change = 0;
+		xfer[1].rx_buff = data;
+		xfer[1].bytes_number = len;
+		xfer[1].cs_change = 1;
 
-	ret = no_os_spi_transfer(dev->spi, &xfer, 1);
+		return no_os_spi_transfer(dev->spi, xfer, 2);
+	}
+
+	xfer[0].rx_buff = spi_buffer;
+	xfer[0].bytes_number += len;
+
+	ret = no_os_spi_transfer(dev->spi, xfer, 1);
 	if (ret)
 		return ret;
 
@@ -394,6 +437,22 @@ int w5500_socket_clear_interrupt(struct w5500_dev *dev, uint8_t sock_id,
 	return w5500_socket_reg_write(dev, sock_id, W5500_Sn_IR, &flags, 1);
 }
 
+/***************************************************************************//**
+ * @brief Drop the streaming state of a socket
+ *
+ * @param dev     - Device descriptor
+ * @param sock_id - Socket number (0-7)
+*******************************************************************************/
+static void w5500_stream_reset(struct w5500_dev *dev, uint8_t sock_id)
+{
+	struct w5500_socket *sock = &dev->sockets[sock_id];
+
+	sock->stream_ready = false;
+	sock->sending = false;
+	sock->tx_free = 0;
+	sock->rx_avail = 0;
+}
+
 /***************************************************************************//**
  * @brief Initialize socket data structures
  *
@@ -431,6 +490,8 @@ int w5500_socket_init(struct w5500_dev *dev, uint8_t sock_id)
 	if (sock_id > W5500_MAX_SOCK_NUMBER)
 		return -EINVAL;
 
+	w5500_stream_reset(dev, sock_id);
+
 	ret = w5500_socket_reg_write(dev, sock_id, W5500_Sn_MR, &sock->protocol, 1);
 	if (ret)
 		return ret;
@@ -502,9 +563,20 @@ int w5500_socket_open(struct w5500_dev *dev, uint8_t sock_id, uint8_t protocol,
 *******************************************************************************/
 int w5500_socket_close(struct w5500_dev *dev, uint8_t sock_id)
 {
+	int ret;
+
 	if (sock_id > W5500_MAX_SOCK_NUMBER)
 		return -EINVAL;
 
+	w5500_stream_reset(dev, sock_id);
+
+	if (dev->simr & NO_OS_BIT(sock_id)) {
+		dev->simr &= ~NO_OS_BIT(sock_id);
+		ret = w5500_reg_write(dev, W5500_COMMON_REG, W5500_SIMR, &dev->simr, 1);
+		if (ret)
+			return ret;
+	}
+
 	return w5500_socket_command_write(dev, sock_id, W5500_Sn_CR_CLOSE);
 }
 
@@ -574,6 +646,404 @@ int w5500_socket_disconnect(struct w5500_dev *dev, uint8_t sock_id)
 	return w5500_socket_command_write(dev, sock_id, W5500_Sn_CR_DISCON);
 }
 
+/***************************************************************************//**
+ * @brief Start streaming on an established TCP socket
+ *
+ * Loads the shadow pointers once and unmasks the socket interrupts. Does
+ * nothing if the socket is already streaming.
+ *
+ * @param dev     - Device descriptor
+ * @param sock_id - Socket number (0-7)
+ *
+ * @return 0 on success, -ENOTCONN if not connected, other negative error codes
+*******************************************************************************/
+static int w5500_stream_start(struct w5500_dev *dev, uint8_t sock_id)
+{
+	struct w5500_socket *sock = &dev->sockets[sock_id];
+	uint8_t imr = W5500_STREAM_IMR;
+	uint8_t status;
+	uint8_t ir;
+	int ret;
+
+	if (sock->stream_ready)
+		return 0;
+
+	/*
+	 * Sn_IR is read before Sn_SR: a DISCON or TIMEOUT seen while the socket
+	 * is still established belongs to a previous connection.
+	 */
+	ret = w5500_socket_reg_read(dev, sock_id, W5500_Sn_IR, &ir, 1);
+	if (ret)
+		return ret;
+
+	ret = w5500_socket_reg_read(dev, sock_id, W5500_Sn_SR, &status, 1);
+	if (ret)
+		return ret;
+
+	if (status != W5500_Sn_SR_ESTABLISHED)
+		return -ENOTCONN;
+
+	ret = w5500_socket_clear_interrupt(dev, sock_id, ir | W5500_STREAM_IMR);
+	if (ret)
+		return ret;
+
+	ret = w5500_read_16bit_reg(dev, W5500_SOCKET_REG_BLOCK(sock_id),
+				   W5500_Sn_TX_WR, &sock->tx_wr);
+	if (ret)
+		return ret;
+	sock->tx_sent = sock->tx_wr;
+
+	ret = w5500_read_16bit_reg(dev, W5500_SOCKET_REG_BLOCK(sock_id),
+				   W5500_Sn_RX_RD, &sock->rx_rd);
+	if (ret)
+		return ret;
+
+	ret = w5500_read_16bit_reg(dev, W5500_SOCKET_REG_BLOCK(sock_id),
+				   W5500_Sn_TX_FSR, &sock->tx_free);
+	if (ret)
+		return ret;
+
+	ret = w5500_read_16bit_reg(dev, W5500_SOCKET_REG_BLOCK(sock_id),
+				   W5500_Sn_RX_RSR, &sock->rx_avail);
+	if (ret)
+		return ret;
+
+	ret = w5500_socket_reg_write(dev, sock_id, W5500_Sn_IMR, &imr, 1);
+	if (ret)
+		return ret;
+
+	dev->simr |= NO_OS_BIT(sock_id);
+	ret = w5500_reg_write(dev, W5500_COMMON_REG, W5500_SIMR, &dev->simr, 1);
+	if (ret)
+		return ret;
+
+	sock->sending = false;
+	sock->stream_ready = true;
+
+	return 0;
+}
+
+/***************************************************************************//**
+ * @brief Check whether the W5500 has a pending interrupt
+ *
+ * @param dev - Device descriptor
+ *
+ * @return true if the interrupt pin is asserted or not available
+*******************************************************************************/
+static bool w5500_stream_irq_pending(struct w5500_dev *dev)
+{
+	uint8_t val;
+
+	if (!dev->gpio_int)
+		return true;
+
+	if (no_os_gpio_get_value(dev->gpio_int, &val))
+		return true;
+
+	return val == NO_OS_GPIO_LOW;
+}
+
+/***************************************************************************//**
+ * @brief Check for the SEND_OK of the previous SEND command
+ *
+ * Sn_IR is only read over SPI when the interrupt pin is asserted.
+ *
+ * @param dev     - Device descriptor
+ * @param sock_id - Socket number (0-7)
+ *
+ * @return 0 if the previous SEND completed, -EAGAIN if it is still in
+ * progress, -ECONNRESET if the connection was lost, other negative error codes
+*******************************************************************************/
+static int w5500_stream_send_done(struct w5500_dev *dev, uint8_t sock_id)
+{
+	uint8_t ir;
+	int ret;
+
+	if (!w5500_stream_irq_pending(dev))
+		return -EAGAIN;
+
+	ret = w5500_socket_reg_read(dev, sock_id, W5500_Sn_IR, &ir, 1);
+	if (ret)
+		return ret;
+
+	if (ir & W5500_Sn_IR_SEND_OK)
+		return 0;
+
+	if (ir & (W5500_Sn_IR_TIMEOUT | W5500_Sn_IR_DISCON)) {
+		w5500_stream_reset(dev, sock_id);
+		return -ECONNRESET;
+	}
+
+	return -EAGAIN;
+}
+
+/***************************************************************************//**
+ * @brief Append a socket register write frame to a SPI message list
+ *
+ * @param msg     - Message to fill
+ * @param frame   - Frame buffer, 3 + len bytes
+ * @param sock_id - Socket number (0-7)
+ * @param reg     - Socket register offset
+ * @param val     - Register value
+ * @param len     - Register size, 1 or 2
+*******************************************************************************/
+static void w5500_stream_reg_frame(struct no_os_spi_msg *msg, uint8_t *frame,
+				   uint8_t sock_id, uint16_t reg, uint16_t val,
+				   uint8_t len)
+{
+	w5500_frame_header(frame, W5500_SOCKET_REG_BLOCK(sock_id), reg,
+			   W5500_RWB_WRITE);
+	if (len == 2) {
+		frame[3] = W5500_BYTE_HIGH(val);
+		frame[4] = W5500_BYTE_LOW(val);
+	} else {
+		frame[3] = val;
+	}
+
+	msg->tx_buff = frame;
+	msg->rx_buff = NULL;
+	msg->bytes_number = 3 + len;
+	msg->cs_change = 1;
+}
+
+/***************************************************************************//**
+ * @brief Complete the previous SEND and issue the staged payload
+ *
+ * Once SEND_OK is seen, it is acknowledged in the same transfer as the
+ * Sn_TX_WR update and the SEND command of the payload staged meanwhile, or
+ * on its own when nothing is staged, so the interrupt pin is released.
+ *
+ * @param dev     - Device descriptor
+ * @param sock_id - Socket number (0-7)
+ *
+ * @return 0 if no SEND is in flight anymore or the staged payload was issued,
+ * -EAGAIN if the previous SEND is still in progress, other negative error
+ * codes
+*******************************************************************************/
+static int w5500_stream_commit(struct w5500_dev *dev, uint8_t sock_id)
+{
+	struct w5500_socket *sock = &dev->sockets[sock_id];
+	struct no_os_spi_msg xfer[3] = {0};
+	uint8_t ir_frame[4];
+	uint8_t wr_frame[5];
+	uint8_t cr_frame[4];
+	uint8_t nb = 0;
+	int ret;
+
+	if (sock->sending) {
+		ret = w5500_stream_send_done(dev, sock_id);
+		if (ret)
+			return ret;
+
+		w5500_stream_reg_frame(&xfer[nb++], ir_frame, sock_id, W5500_Sn_IR,
+				       W5500_Sn_IR_SEND_OK, 1);
+	}
+
+	if (sock->tx_wr != sock->tx_sent) {
+		w5500_stream_reg_frame(&xfer[nb++], wr_frame, sock_id,
+				       W5500_Sn_TX_WR, sock->tx_wr, 2);
+		w5500_stream_reg_frame(&xfer[nb++], cr_frame, sock_id, W5500_Sn_CR,
+				       W5500_Sn_CR_SEND, 1);
+	}
+
+	if (!nb)
+		return 0;
+
+	ret = no_os_spi_transfer(dev->spi, xfer, nb);
+	if (ret)
+		return ret;
+
+	sock->sending = sock->tx_wr != sock->tx_sent;
+	sock->tx_sent = sock->tx_wr;
+
+	return 0;
+}
+
+/***************************************************************************//**
+ * @brief Streaming send
+ *
+ * Never waits. When the socket is idle, the payload, Sn_TX_WR and the SEND
+ * command are written in one transfer. While a SEND is on the wire, the
+ * payload is only copied to the TX buffer past Sn_TX_WR, which the W5500 does
+ * not transmit yet; it is issued by w5500_stream_commit() once SEND_OK is
+ * seen, from the next send or recv call. Sn_TX_FSR is only read when the
+ * cached free size is too small.
+ *
+ * @param dev     - Device descriptor
+ * @param sock_id - Socket number (0-7)
+ * @param buf     - Data buffer to send
+ * @param len     - Data length
+ *
+ * @return Number of bytes queued, -EAGAIN if the TX buffer is full, other
+ * negative error codes
+*******************************************************************************/
+static int w5500_stream_send(struct w5500_dev *dev, uint8_t sock_id,
+			     const void *buf, uint16_t len)
+{
+	struct w5500_socket *sock = &dev->sockets[sock_id];
+	struct no_os_spi_msg xfer[4] = {0};
+	uint8_t hdr[3];
+	uint8_t wr_frame[5];
+	uint8_t cr_frame[4];
+	uint16_t free_size;
+	uint8_t nb = 0;
+	uint8_t ir;
+	int ret;
+
+	ret = w5500_stream_commit(dev, sock_id);
+	if (ret && ret != -EAGAIN)
+		return ret;
+
+	if (sock->tx_free < len) {
+		ret = w5500_read_16bit_reg(dev, W5500_SOCKET_REG_BLOCK(sock_id),
+					   W5500_Sn_TX_FSR, &free_size);
+		if (ret)
+			return ret;
+
+		/* The W5500 does not account the staged payload yet */
+		sock->tx_free = free_size - (uint16_t)(sock->tx_wr - sock->tx_sent);
+
+		if (!sock->tx_free) {
+			ret = w5500_socket_reg_read(dev, sock_id, W5500_Sn_IR, &ir, 1);
+			if (ret)
+				return ret;
+
+			if (ir & (W5500_Sn_IR_TIMEOUT | W5500_Sn_IR_DISCON)) {
+				w5500_stream_reset(dev, sock_id);
+				return -ECONNRESET;
+			}
+
+			return -EAGAIN;
+		}
+	}
+
+	len = no_os_min(len, sock->tx_free);
+
+	w5500_frame_header(hdr, W5500_SOCKET_TX_BUF_BLOCK(sock_id), sock->tx_wr,
+			   W5500_RWB_WRITE);
+	xfer[nb].tx_buff = hdr;
+	xfer[nb++].bytes_number = 3;
+	xfer[nb].tx_buff = (uint8_t *)buf;
+	xfer[nb].bytes_number = len;
+	xfer[nb++].cs_change = 1;
+
+	sock->tx_wr += len;
+	sock->tx_free -= len;
+
+	if (!sock->sending) {
+		w5500_stream_reg_frame(&xfer[nb++], wr_frame, sock_id,
+				       W5500_Sn_TX_WR, sock->tx_wr, 2);
+		w5500_stream_reg_frame(&xfer[nb++], cr_frame, sock_id, W5500_Sn_CR,
+				       W5500_Sn_CR_SEND, 1);
+	}
+
+	ret = no_os_spi_transfer(dev->spi, xfer, nb);
+	if (ret)
+		return ret;
+
+	if (!sock->sending) {
+		sock->tx_sent = sock->tx_wr;
+		sock->sending = true;
+	}
+
+	return len;
+}
+
+/***************************************************************************//**
+ * @brief Streaming receive
+ *
+ * A completed SEND is acknowledged first, issuing the staged payload. Returns
+ * -EAGAIN without any SPI access when nothing is buffered and the interrupt
+ * pin is idle. Otherwise the payload is read straight into buf and Sn_RX_RD
+ * and the RECV command are written in the same transfer.
+ *
+ * @param dev     - Device descriptor
+ * @param sock_id - Socket number (0-7)
+ * @param buf     - Buffer to store received data
+ * @param len     - Maximum length to receive
+ *
+ * @return Number of bytes received, -EAGAIN if no data is available,
+ * -ENOTCONN if the peer closed the connection, other negative error codes
+*******************************************************************************/
+static int w5500_stream_recv(struct w5500_dev *dev, uint8_t sock_id,
+			     void *buf, uint16_t len)
+{
+	struct w5500_socket *sock = &dev->sockets[sock_id];
+	struct no_os_spi_msg xfer[4] = {0};
+	uint8_t hdr[3];
+	uint8_t rd_frame[5];
+	uint8_t cr_frame[4];
+	uint8_t ir;
+	int ret;
+
+	/*
+	 * Acknowledge SEND_OK and issue the staged payload, if any. A lost
+	 * connection is reported below, once the buffered data was read.
+	 */
+	ret = w5500_stream_commit(dev, sock_id);
+	if (ret && ret != -EAGAIN && ret != -ECONNRESET)
+		return ret;
+
+	if (!sock->rx_avail) {
+		if (!w5500_stream_irq_pending(dev))
+			return -EAGAIN;
+
+		ret = w5500_socket_reg_read(dev, sock_id, W5500_Sn_IR, &ir, 1);
+		if (ret)
+			return ret;
+
+		if (!(ir & (W5500_Sn_IR_RECV | W5500_Sn_IR_TIMEOUT |
+			    W5500_Sn_IR_DISCON)))
+			return -EAGAIN;
+
+		/* Clear RECV before sampling RSR so later data raises it again. */
+		if (ir & W5500_Sn_IR_RECV) {
+			ret = w5500_socket_clear_interrupt(dev, sock_id,
+							   W5500_Sn_IR_RECV);
+			if (ret)
+				return ret;
+		}
+
+		ret = w5500_read_16bit_reg(dev, W5500_SOCKET_REG_BLOCK(sock_id),
+					   W5500_Sn_RX_RSR, &sock->rx_avail);
+		if (ret)
+			return ret;
+
+		if (!sock->rx_avail) {
+			if (ir & (W5500_Sn_IR_TIMEOUT | W5500_Sn_IR_DISCON)) {
+				w5500_stream_reset(dev, sock_id);
+				return -ENOTCONN;
+			}
+
+			return -EAGAIN;
+		}
+	}
+
+	len = no_os_min(len, sock->rx_avail);
+
+	w5500_frame_header(hdr, W5500_SOCKET_RX_BUF_BLOCK(sock_id), sock->rx_rd,
+			   W5500_RWB_READ);
+	xfer[0].tx_buff = hdr;
+	xfer[0].bytes_number = 3;
+	xfer[1].rx_buff = buf;
+	xfer[1].bytes_number = len;
+	xfer[1].cs_change = 1;
+
+	sock->rx_rd += len;
+	sock->rx_avail -= len;
+
+	w5500_stream_reg_frame(&xfer[2], rd_frame, sock_id, W5500_Sn_RX_RD,
+			       sock->rx_rd, 2);
+	w5500_stream_reg_frame(&xfer[3], cr_frame, sock_id, W5500_Sn_CR,
+			       W5500_Sn_CR_RECV, 1);
+
+	ret = no_os_spi_transfer(dev->spi, xfer, 4);
+	if (ret)
+		return ret;
+
+	return len;
+}
+
 /***************************************************************************//**
  * @brief Send data through a socket
  *
@@ -599,6 +1069,14 @@ int w5500_socket_send(struct w5500_dev *dev, uint8_t sock_id, const void *buf,
 	if (sock_id > W5500_MAX_SOCK_NUMBER)
 		return -EINVAL;
 
+	if (dev->streaming && dev->sockets[sock_id].protocol == W5500_Sn_MR_TCP) {
+		ret = w5500_stream_start(dev, sock_id);
+		if (ret)
+			return ret;
+
+		return w5500_stream_send(dev, sock_id, buf, len);
+	}
+
 	ret = w5500_socket_reg_read(dev, sock_id, W5500_Sn_SR, &status, 1);
 	if (ret)
 		return ret;
@@ -682,6 +1160,14 @@ int w5500_socket_recv(struct w5500_dev *dev, uint8_t sock_id, void *buf,
 	if (sock_id > W5500_MAX_SOCK_NUMBER)
 		return -EINVAL;
 
+	if (dev->streaming && dev->sockets[sock_id].protocol == W5500_Sn_MR_TCP) {
+		ret = w5500_stream_start(dev, sock_id);
+		if (ret)
+			return ret;
+
+		return w5500_stream_recv(dev, sock_id, buf, len);
+	}
+
 	ret = w5500_socket_reg_read(dev, sock_id, W5500_Sn_SR, &status, 1);
 	if (ret)
 		return ret;
@@ -1063,6 +1549,12 @@ int w5500_init(struct w5500_dev **device,
 	if (ret)
 		goto free_gpio_reset;
 
+	if (dev->gpio_int) {
+		ret = no_os_gpio_direction_input(dev->gpio_int);
+		if (ret)
+			goto free_gpio_int;
+	}
+
 	ret = no_os_spi_init(&dev->spi, init_param->spi_init);
 	if (ret)
 		goto free_gpio_int;
@@ -1070,6 +1562,7 @@ int w5500_init(struct w5500_dev **device,
 	memcpy(dev->mac_addr, init_param->mac_addr, 6);
 	memcpy(&dev->retry_time, &init_param->retry_time, 1);
 	memcpy(&dev->retry_count, &init_param->retry_count, 1);
+	dev->streaming = init_param->streaming;
 
 	w5500_sockets_init(dev);
 
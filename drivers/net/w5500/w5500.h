@@ -213,6 +213,17 @@ struct w5500_socket {
 	uint16_t mss;
 	uint8_t tx_buf_size;
 	uint8_t rx_buf_size;
+	/* Streaming state, see w5500_init_param.streaming */
+	bool stream_ready;
+	/* A SEND command is in flight, waiting for SEND_OK */
+	bool sending;
+	/* Where the next payload goes in the TX buffer */
+	uint16_t tx_wr;
+	/* Last Sn_TX_WR written, tx_wr is ahead while a payload is staged */
+	uint16_t tx_sent;
+	uint16_t rx_rd;
+	uint16_t tx_free;
+	uint16_t rx_avail;
 };
 
 struct w5500_dev {
@@ -222,6 +233,8 @@ struct w5500_dev {
 	uint8_t mac_addr[6];
 	uint16_t retry_time;
 	uint8_t retry_count;
+	bool streaming;
+	uint8_t simr;
 	struct w5500_socket sockets[W5500_MAX_SOCK_NUMBER + 1];
 };
 
@@ -232,6 +245,16 @@ struct w5500_init_param {
 	uint8_t mac_addr[6];
 	uint16_t retry_time;
 	uint8_t retry_count;
+	/*
+	 * Pipelined TCP send/recv. Sn_TX_WR and Sn_RX_RD are shadowed instead of
+	 * read back, payloads go to the SPI controller without being copied and
+	 * the socket interrupts (and gpio_int, when provided) replace polling.
+	 * While a SEND is in flight the next payload is staged in the TX buffer
+	 * and issued by a later send or recv call once SEND_OK is seen. Send
+	 * and recv become non-blocking and may return partial counts or
+	 * -EAGAIN.
+	 */
+	bool streaming;
 };
 
 /** Write data to a W5500 register */
@@ -31,6 +31,8 @@
  * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 *******************************************************************************/
 
+#include <stddef.h>
+#include <sys/time.h>
 #include "no_os_delay.h"
 
 /**
@@ -50,3 +52,19 @@ void no_os_mdelay(uint32_t msecs)
 {
 	usleep(msecs * 1000);
 }
+
+/**
+ * @brief Get current time.
+ * @return Current time structure (seconds, microseconds).
+ */
+struct no_os_time no_os_get_time(void)
+{
+	struct no_os_time t;
+	struct timeval tv;
+
+	gettimeofday(&tv, NULL);
+	t.s = tv.tv_sec;
+	t.us = tv.tv_usec;
+
+	return t;
+}
@@ -0,0 +1,253 @@
+/*******************************************************************************
+ *   @file   freeRTOS/freertos_thread.c
+ *   @brief  Implementation of no-OS thread functionality on FreeRTOS.
+********************************************************************************
+ * Copyright 2026(c) Analog Devices, Inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Analog Devices, Inc. nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ANALOG DEVICES, INC. “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL ANALOG DEVICES, INC. BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+#include <FreeRTOS.h>
+#include "task.h"
+#include "semphr.h"
+#include <stdbool.h>
+#include "no_os_thread.h"
+#include "no_os_alloc.h"
+#include "no_os_error.h"
+
+/* Stack depth of the no-OS tasks, in words */
+#ifndef NO_OS_THREAD_STACK_DEPTH
+#define NO_OS_THREAD_STACK_DEPTH	2048
+#endif
+
+struct freertos_thread {
+	TaskHandle_t task;
+	SemaphoreHandle_t done;
+	void (*func)(void *);
+	void *arg;
+};
+
+/*
+ * Generation barrier built on binary semaphores only. Threads waiting on
+ * generation g block on wake[g % 2]; the releasing thread gives it once and
+ * every woken thread passes it on until all the waiters are released.
+ */
+struct freertos_barrier {
+	SemaphoreHandle_t lock;
+	SemaphoreHandle_t wake[2];
+	unsigned int to_wake[2];
+	unsigned int nb;
+	unsigned int count;
+	unsigned int generation;
+	bool aborted;
+};
+
+static void freertos_thread_entry(void *arg)
+{
+	struct freertos_thread *t = arg;
+
+	t->func(t->arg);
+	xSemaphoreGive(t->done);
+	vTaskDelete(NULL);
+}
+
+/**
+ * @brief Start a task with the priority of the caller.
+ * @param thread - Pointer toward the thread handle.
+ * @param func - Thread function.
+ * @param arg - Argument of the thread function.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+int no_os_thread_create(void **thread, void (*func)(void *), void *arg)
+{
+	struct freertos_thread *t;
+
+	if (!thread || !func)
+		return -EINVAL;
+
+	t = no_os_calloc(1, sizeof(*t));
+	if (!t)
+		return -ENOMEM;
+
+	t->done = xSemaphoreCreateBinary();
+	if (!t->done)
+		goto error;
+
+	t->func = func;
+	t->arg = arg;
+	if (xTaskCreate(freertos_thread_entry, "no_os_thread",
+			NO_OS_THREAD_STACK_DEPTH, t, uxTaskPriorityGet(NULL),
+			&t->task) != pdPASS)
+		goto error_sem;
+
+	*thread = t;
+
+	return 0;
+
+error_sem:
+	vSemaphoreDelete(t->done);
+error:
+	no_os_free(t);
+
+	return -ENOMEM;
+}
+
+/**
+ * @brief Wait for a task to return and free its resources.
+ * @param thread - The thread handle.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+int no_os_thread_join(void *thread)
+{
+	struct freertos_thread *t = thread;
+
+	if (!t)
+		return -EINVAL;
+
+	xSemaphoreTake(t->done, portMAX_DELAY);
+	vSemaphoreDelete(t->done);
+	no_os_free(t);
+
+	return 0;
+}
+
+/**
+ * @brief Create a barrier.
+ * @param barrier - Pointer toward the barrier handle.
+ * @param nb - Number of threads released together.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+int no_os_barrier_init(void **barrier, unsigned int nb)
+{
+	struct freertos_barrier *b;
+
+	if (!barrier || !nb)
+		return -EINVAL;
+
+	b = no_os_calloc(1, sizeof(*b));
+	if (!b)
+		return -ENOMEM;
+
+	b->lock = xSemaphoreCreateMutex();
+	b->wake[0] = xSemaphoreCreateBinary();
+	b->wake[1] = xSemaphoreCreateBinary();
+	if (!b->lock || !b->wake[0] || !b->wake[1]) {
+		no_os_barrier_remove(b);
+		return -ENOMEM;
+	}
+
+	b->nb = nb;
+	*barrier = b;
+
+	return 0;
+}
+
+/**
+ * @brief Wait until nb threads reached the barrier.
+ * @param barrier - The barrier handle.
+ * @return 0 in case of success, -ECANCELED if the barrier was aborted.
+ */
+int no_os_barrier_wait(void *barrier)
+{
+	struct freertos_barrier *b = barrier;
+	unsigned int parity;
+	bool aborted;
+
+	if (!b)
+		return -EINVAL;
+
+	xSemaphoreTake(b->lock, portMAX_DELAY);
+	if (b->aborted) {
+		xSemaphoreGive(b->lock);
+		return -ECANCELED;
+	}
+
+	parity = b->generation % 2;
+	if (++b->count == b->nb) {
+		b->count = 0;
+		b->generation++;
+		b->to_wake[parity] = b->nb - 1;
+		if (b->to_wake[parity])
+			xSemaphoreGive(b->wake[parity]);
+		xSemaphoreGive(b->lock);
+		return 0;
+	}
+	xSemaphoreGive(b->lock);
+
+	xSemaphoreTake(b->wake[parity], portMAX_DELAY);
+
+	xSemaphoreTake(b->lock, portMAX_DELAY);
+	aborted = b->aborted;
+	if (aborted || --b->to_wake[parity])
+		xSemaphoreGive(b->wake[parity]);
+	xSemaphoreGive(b->lock);
+
+	return aborted ? -ECANCELED : 0;
+}
+
+/**
+ * @brief Release the current and future waiters with -ECANCELED.
+ * @param barrier - The barrier handle.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+int no_os_barrier_abort(void *barrier)
+{
+	struct freertos_barrier *b = barrier;
+
+	if (!b)
+		return -EINVAL;
+
+	xSemaphoreTake(b->lock, portMAX_DELAY);
+	b->aborted = true;
+	xSemaphoreGive(b->wake[0]);
+	xSemaphoreGive(b->wake[1]);
+	xSemaphoreGive(b->lock);
+
+	return 0;
+}
+
+/**
+ * @brief Free a barrier no task waits on.
+ * @param barrier - The barrier handle.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+int no_os_barrier_remove(void *barrier)
+{
+	struct freertos_barrier *b = barrier;
+
+	if (!b)
+		return -EINVAL;
+
+	if (b->wake[1])
+		vSemaphoreDelete(b->wake[1]);
+	if (b->wake[0])
+		vSemaphoreDelete(b->wake[0]);
+	if (b->lock)
+		vSemaphoreDelete(b->lock);
+	no_os_free(b);
+
+	return 0;
+}
@@ -0,0 +1,221 @@
+/*******************************************************************************
+ *   @file   linux/linux_thread.c
+ *   @brief  Implementation of no-OS thread functionality on Linux.
+********************************************************************************
+ * Copyright 2026(c) Analog Devices, Inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Analog Devices, Inc. nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ANALOG DEVICES, INC. “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL ANALOG DEVICES, INC. BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+#include <pthread.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "no_os_thread.h"
+#include "no_os_error.h"
+#include "no_os_alloc.h"
+
+struct linux_thread {
+	pthread_t thread;
+	void (*func)(void *);
+	void *arg;
+};
+
+struct linux_barrier {
+	pthread_mutex_t lock;
+	pthread_cond_t cond;
+	unsigned int nb;
+	unsigned int count;
+	unsigned int generation;
+	bool aborted;
+};
+
+static void *linux_thread_entry(void *arg)
+{
+	struct linux_thread *t = arg;
+
+	t->func(t->arg);
+
+	return NULL;
+}
+
+/**
+ * @brief Start a thread.
+ * @param thread - Pointer toward the thread handle.
+ * @param func - Thread function.
+ * @param arg - Argument of the thread function.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+int no_os_thread_create(void **thread, void (*func)(void *), void *arg)
+{
+	struct linux_thread *t;
+
+	if (!thread || !func)
+		return -EINVAL;
+
+	t = no_os_calloc(1, sizeof(*t));
+	if (!t)
+		return -ENOMEM;
+
+	t->func = func;
+	t->arg = arg;
+	if (pthread_create(&t->thread, NULL, linux_thread_entry, t)) {
+		no_os_free(t);
+		return -EAGAIN;
+	}
+
+	*thread = t;
+
+	return 0;
+}
+
+/**
+ * @brief Wait for a thread to return and free its resources.
+ * @param thread - The thread handle.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+int no_os_thread_join(void *thread)
+{
+	struct linux_thread *t = thread;
+	int ret;
+
+	if (!t)
+		return -EINVAL;
+
+	ret = pthread_join(t->thread, NULL);
+	no_os_free(t);
+
+	return ret ? -EINVAL : 0;
+}
+
+/**
+ * @brief Create a barrier. Unlike pthread_barrier_t, it can be aborted.
+ * @param barrier - Pointer toward the barrier handle.
+ * @param nb - Number of threads released together.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+int no_os_barrier_init(void **barrier, unsigned int nb)
+{
+	struct linux_barrier *b;
+
+	if (!barrier || !nb)
+		return -EINVAL;
+
+	b = no_os_calloc(1, sizeof(*b));
+	if (!b)
+		return -ENOMEM;
+
+	if (pthread_mutex_init(&b->lock, NULL))
+		goto error;
+
+	if (pthread_cond_init(&b->cond, NULL)) {
+		pthread_mutex_destroy(&b->lock);
+		goto error;
+	}
+
+	b->nb = nb;
+	*barrier = b;
+
+	return 0;
+
+error:
+	no_os_free(b);
+
+	return -ENOMEM;
+}
+
+/**
+ * @brief Wait until nb threads reached the barrier.
+ * @param barrier - The barrier handle.
+ * @return 0 in case of success, -ECANCELED if the barrier was aborted.
+ */
+int no_os_barrier_wait(void *barrier)
+{
+	struct linux_barrier *b = barrier;
+	unsigned int generation;
+	int ret = 0;
+
+	if (!b)
+		return -EINVAL;
+
+	pthread_mutex_lock(&b->lock);
+
+	generation = b->generation;
+	if (b->aborted) {
+		ret = -ECANCELED;
+	} else if (++b->count == b->nb) {
+		b->count = 0;
+		b->generation++;
+		pthread_cond_broadcast(&b->cond);
+	} else {
+		while (generation == b->generation && !b->aborted)
+			pthread_cond_wait(&b->cond, &b->lock);
+		if (generation == b->generation)
+			ret = -ECANCELED;
+	}
+
+	pthread_mutex_unlock(&b->lock);
+
+	return ret;
+}
+
+/**
+ * @brief Release the current and future waiters with -ECANCELED.
+ * @param barrier - The barrier handle.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+int no_os_barrier_abort(void *barrier)
+{
+	struct linux_barrier *b = barrier;
+
+	if (!b)
+		return -EINVAL;
+
+	pthread_mutex_lock(&b->lock);
+	b->aborted = true;
+	pthread_cond_broadcast(&b->cond);
+	pthread_mutex_unlock(&b->lock);
+
+	return 0;
+}
+
+/**
+ * @brief Free a barrier no thread waits on.
+ * @param barrier - The barrier handle.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+int no_os_barrier_remove(void *barrier)
+{
+	struct linux_barrier *b = barrier;
+
+	if (!b)
+		return -EINVAL;
+
+	pthread_cond_destroy(&b->cond);
+	pthread_mutex_destroy(&b->lock);
+	no_os_free(b);
+
+	return 0;
+}
@@ -33,15 +33,48 @@
 
 #include "no_os_error.h"
 #include "no_os_alloc.h"
+#include "no_os_lf256fifo.h"
+#include "no_os_util.h"
 #include "linux_uart.h"
 
+#include <errno.h>
 #include <fcntl.h>
+#include <poll.h>
+#include <pthread.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <termios.h>
+#include <string.h>
+#include <time.h>
 #include <unistd.h>
 #include <sys/ioctl.h>
 
+/* Poll timeout of the worker threads, bounds the time needed to stop them */
+#define LINUX_UART_RX_POLL_MS	100
+#define LINUX_UART_RX_CHUNK	64
+/* Software TX buffer size used when linux_uart_init_param.tx_buffer_size is 0 */
+#define LINUX_UART_TX_SIZE	4096
+
+/*
+ * Kernel termios2, from asm-generic/termbits.h. It is not exposed by the libc
+ * headers since asm/termbits.h clashes with <termios.h>. It is used with
+ * BOTHER to set rates which have no Bxxx constant.
+ */
+struct linux_uart_termios2 {
+	tcflag_t c_iflag;
+	tcflag_t c_oflag;
+	tcflag_t c_cflag;
+	tcflag_t c_lflag;
+	cc_t c_line;
+	cc_t c_cc[19];
+	speed_t c_ispeed;
+	speed_t c_ospeed;
+};
+
+#ifndef BOTHER
+#define BOTHER			0010000
+#endif
+
 /**
  * @struct linux_uart_desc
  * @brief Linux platform specific UART descriptor
@@ -51,8 +84,236 @@ struct linux_uart_desc {
 	int fd;
 	/** structure containing the terminal flags/settings */
 	struct termios *terminal;
+	/** Thread filling the software FIFO when asynchronous_rx is set */
+	pthread_t rx_thread;
+	/** Cleared to stop rx_thread */
+	volatile bool rx_run;
+	/** Thread draining the software TX buffer */
+	pthread_t tx_thread;
+	/** Cleared to stop tx_thread */
+	bool tx_run;
+	/** Protects the TX buffer and the FIFO full wait */
+	pthread_mutex_t lock;
+	/** Signaled when linux_uart_read() frees space in the RX FIFO */
+	pthread_cond_t rx_space;
+	/** Signaled when bytes are queued for transmission */
+	pthread_cond_t tx_data;
+	/** Signaled when tx_thread frees space in the TX buffer */
+	pthread_cond_t tx_space;
+	/** Software TX buffer */
+	uint8_t *tx_buf;
+	uint32_t tx_size;
+	/** Oldest queued byte and number of queued bytes */
+	uint32_t tx_tail;
+	uint32_t tx_len;
+	/** Write error of tx_thread, reported by the next write */
+	int tx_err;
 };
 
+/**
+ * @brief Wait for the UART file descriptor to be ready.
+ * @param fd - File descriptor.
+ * @param events - POLLIN or POLLOUT.
+ * @param timeout_ms - Timeout in ms, -1 to wait forever.
+ * @return positive value when ready, 0 on timeout, negative value on error.
+ */
+static int linux_uart_wait(int fd, short events, int timeout_ms)
+{
+	struct pollfd pfd = {
+		.fd = fd,
+		.events = events,
+	};
+	int ret;
+
+	do {
+		ret = poll(&pfd, 1, timeout_ms);
+	} while (ret < 0 && errno == EINTR);
+
+	return ret;
+}
+
+/**
+ * @brief Wait on a condition of the descriptor, with lock held. The wait is
+ * bounded so that the threads notice when they are stopped.
+ * @param linux_desc - The Linux UART descriptor.
+ * @param cond - Condition to wait on.
+ */
+static void linux_uart_cond_wait(struct linux_uart_desc *linux_desc,
+				 pthread_cond_t *cond)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_REALTIME, &ts);
+	ts.tv_nsec += LINUX_UART_RX_POLL_MS * 1000000L;
+	if (ts.tv_nsec >= 1000000000L) {
+		ts.tv_sec++;
+		ts.tv_nsec -= 1000000000L;
+	}
+
+	pthread_cond_timedwait(cond, &linux_desc->lock, &ts);
+}
+
+/**
+ * @brief Receive thread used for asynchronous_rx. Moves the received bytes
+ * into the software FIFO, where they are consumed by linux_uart_read().
+ * @param arg - The UART descriptor.
+ * @return NULL
+ */
+static void *linux_uart_rx_thread(void *arg)
+{
+	struct no_os_uart_desc *desc = arg;
+	struct linux_uart_desc *linux_desc = desc->extra;
+	uint8_t chunk[LINUX_UART_RX_CHUNK];
+	ssize_t len;
+	ssize_t i;
+
+	while (linux_desc->rx_run) {
+		if (linux_uart_wait(linux_desc->fd, POLLIN, LINUX_UART_RX_POLL_MS) <= 0)
+			continue;
+
+		len = read(linux_desc->fd, chunk, sizeof(chunk));
+		for (i = 0; i < len && linux_desc->rx_run; ) {
+			if (!lf256fifo_write(desc->rx_fifo, chunk[i])) {
+				i++;
+				continue;
+			}
+
+			/*
+			 * FIFO full, sleep until the reader frees space. The kernel
+			 * keeps buffering the line meanwhile.
+			 */
+			pthread_mutex_lock(&linux_desc->lock);
+			if (lf256fifo_is_full(desc->rx_fifo))
+				linux_uart_cond_wait(linux_desc, &linux_desc->rx_space);
+			pthread_mutex_unlock(&linux_desc->lock);
+		}
+	}
+
+	return NULL;
+}
+
+/**
+ * @brief Transmit thread. Writes the queued bytes to the UART, so that
+ * linux_uart_write() returns as soon as its data is queued.
+ * @param arg - The Linux UART descriptor.
+ * @return NULL
+ */
+static void *linux_uart_tx_thread(void *arg)
+{
+	struct linux_uart_desc *linux_desc = arg;
+	uint32_t len;
+	ssize_t ret;
+
+	pthread_mutex_lock(&linux_desc->lock);
+	while (linux_desc->tx_run || linux_desc->tx_len) {
+		if (!linux_desc->tx_len) {
+			linux_uart_cond_wait(linux_desc, &linux_desc->tx_data);
+			continue;
+		}
+
+		/* Contiguous part, only tx_thread moves tx_tail */
+		len = no_os_min(linux_desc->tx_len,
+				linux_desc->tx_size - linux_desc->tx_tail);
+		pthread_mutex_unlock(&linux_desc->lock);
+
+		ret = write(linux_desc->fd, &linux_desc->tx_buf[linux_desc->tx_tail],
+			    len);
+		if (ret < 0 && (errno == EAGAIN || errno == EINTR)) {
+			linux_uart_wait(linux_desc->fd, POLLOUT, LINUX_UART_RX_POLL_MS);
+			ret = 0;
+		}
+
+		pthread_mutex_lock(&linux_desc->lock);
+		if (ret < 0) {
+			/* Drop the queued bytes, the next write reports the error */
+			linux_desc->tx_err = -errno;
+			linux_desc->tx_len = 0;
+			linux_desc->tx_tail = 0;
+		} else {
+			linux_desc->tx_len -= ret;
+			linux_desc->tx_tail = (linux_desc->tx_tail + ret) %
+					      linux_desc->tx_size;
+		}
+		pthread_cond_broadcast(&linux_desc->tx_space);
+	}
+	pthread_mutex_unlock(&linux_desc->lock);
+
+	return NULL;
+}
+
+/**
+ * @brief Queue bytes in the software TX buffer.
+ * @param linux_desc - The Linux UART descriptor.
+ * @param data - Bytes to be sent.
+ * @param bytes_number - Number of bytes to be sent.
+ * @param block - Wait for space until all the bytes are queued.
+ * @return Number of queued bytes in case of success, negative error code
+ * otherwise.
+ */
+static int32_t linux_uart_tx_queue(struct linux_uart_desc *linux_desc,
+				   const uint8_t *data, uint32_t bytes_number,
+				   bool block)
+{
+	uint32_t count = 0;
+	uint32_t head;
+	uint32_t len;
+	int32_t ret;
+
+	pthread_mutex_lock(&linux_desc->lock);
+	while (count < bytes_number) {
+		if (linux_desc->tx_err) {
+			ret = linux_desc->tx_err;
+			linux_desc->tx_err = 0;
+			pthread_mutex_unlock(&linux_desc->lock);
+			return ret;
+		}
+
+		if (linux_desc->tx_len == linux_desc->tx_size) {
+			if (!block)
+				break;
+			linux_uart_cond_wait(linux_desc, &linux_desc->tx_space);
+			continue;
+		}
+
+		head = (linux_desc->tx_tail + linux_desc->tx_len) %
+		       linux_desc->tx_size;
+		len = no_os_min(bytes_number - count,
+				linux_desc->tx_size - linux_desc->tx_len);
+		len = no_os_min(len, linux_desc->tx_size - head);
+		memcpy(&linux_desc->tx_buf[head], &data[count], len);
+		linux_desc->tx_len += len;
+		count += len;
+		pthread_cond_signal(&linux_desc->tx_data);
+	}
+	pthread_mutex_unlock(&linux_desc->lock);
+
+	return count;
+}
+
+/**
+ * @brief Set a baud rate which has no Bxxx constant, with BOTHER.
+ * @param fd - UART file descriptor.
+ * @param baud_rate - Baud rate.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+static int linux_uart_set_custom_baud(int fd, uint32_t baud_rate)
+{
+	struct linux_uart_termios2 tio;
+
+	if (ioctl(fd, _IOR('T', 0x2A, struct linux_uart_termios2), &tio) < 0)
+		return -errno;
+
+	tio.c_cflag &= ~(CBAUD | CIBAUD);
+	tio.c_cflag |= BOTHER;
+	tio.c_ispeed = baud_rate;
+	tio.c_ospeed = baud_rate;
+
+	if (ioctl(fd, _IOW('T', 0x2B, struct linux_uart_termios2), &tio) < 0)
+		return -errno;
+
+	return 0;
+}
+
 /**
  * @brief Initialize the UART communication peripheral.
  * @param desc - The UART descriptor.
@@ -65,15 +326,16 @@ static int32_t linux_uart_init(struct no_os_uart_desc **desc,
 	struct linux_uart_init_param *linux_init;
 	struct linux_uart_desc *linux_desc;
 	struct no_os_uart_desc *descriptor;
+	bool custom_baud = false;
 	speed_t speed;
 	char path[64];
 	int ret;
 
-	descriptor = no_os_malloc(sizeof(*descriptor));
+	descriptor = no_os_calloc(1, sizeof(*descriptor));
 	if (!descriptor)
 		return -ENOMEM;
 
-	linux_desc = (struct linux_uart_desc*) no_os_malloc(sizeof(
+	linux_desc = (struct linux_uart_desc*) no_os_calloc(1, sizeof(
 				struct linux_uart_desc));
 	if (!linux_desc) {
 		ret = -ENOMEM;
@@ -92,7 +354,7 @@ static int32_t linux_uart_init(struct no_os_uart_desc **desc,
 	ret = snprintf(path, sizeof(path), "/dev/%s", linux_init->device_id);
 	if (ret < 0 || ret >= (int)sizeof(path)) {
 		ret = -ENOMEM;
-		goto free_linux_desc;
+		goto free_terminal;
 	}
 
 	linux_desc->fd = open(path, O_RDWR | O_NOCTTY | O_NONBLOCK);
@@ -152,9 +414,38 @@ static int32_t linux_uart_init(struct no_os_uart_desc **desc,
 	case 38400:
 		speed = B38400;
 		break;
+	case 57600:
+		speed = B57600;
+		break;
+	case 115200:
+		speed = B115200;
+		break;
+	case 230400:
+		speed = B230400;
+		break;
+	case 460800:
+		speed = B460800;
+		break;
+	case 921600:
+		speed = B921600;
+		break;
+	case 1000000:
+		speed = B1000000;
+		break;
+	case 2000000:
+		speed = B2000000;
+		break;
+	case 3000000:
+		speed = B3000000;
+		break;
+	case 4000000:
+		speed = B4000000;
+		break;
 	default:
-		ret = -EINVAL;
-		goto free;
+		/* Set with BOTHER once the other attributes are applied */
+		speed = B38400;
+		custom_baud = true;
+		break;
 	}
 	cfsetispeed(linux_desc->terminal, speed);
 	cfsetospeed(linux_desc->terminal, speed);
@@ -203,12 +494,71 @@ static int32_t linux_uart_init(struct no_os_uart_desc **desc,
 
 	tcsetattr(linux_desc->fd, TCSANOW, linux_desc->terminal);
 
+	if (custom_baud) {
+		ret = linux_uart_set_custom_baud(linux_desc->fd, param->baud_rate);
+		if (ret)
+			goto free;
+	}
+
 	tcflush(linux_desc->fd, TCIOFLUSH);
 
+	descriptor->baud_rate = param->baud_rate;
+
+	pthread_mutex_init(&linux_desc->lock, NULL);
+	pthread_cond_init(&linux_desc->rx_space, NULL);
+	pthread_cond_init(&linux_desc->tx_data, NULL);
+	pthread_cond_init(&linux_desc->tx_space, NULL);
+
+	linux_desc->tx_size = linux_init->tx_buffer_size ?
+			      linux_init->tx_buffer_size : LINUX_UART_TX_SIZE;
+	linux_desc->tx_buf = no_os_malloc(linux_desc->tx_size);
+	if (!linux_desc->tx_buf) {
+		ret = -ENOMEM;
+		goto free_sync;
+	}
+
+	linux_desc->tx_run = true;
+	ret = pthread_create(&linux_desc->tx_thread, NULL, linux_uart_tx_thread,
+			     linux_desc);
+	if (ret) {
+		ret = -ret;
+		goto free_tx_buf;
+	}
+
+	if (param->asynchronous_rx) {
+		ret = lf256fifo_init(&descriptor->rx_fifo);
+		if (ret)
+			goto stop_tx;
+
+		linux_desc->rx_run = true;
+		ret = pthread_create(&linux_desc->rx_thread, NULL,
+				     linux_uart_rx_thread, descriptor);
+		if (ret) {
+			ret = -ret;
+			goto free_fifo;
+		}
+	}
+
 	*desc = descriptor;
 
 	return 0;
 
+free_fifo:
+	lf256fifo_remove(descriptor->rx_fifo);
+	no_os_free(descriptor->rx_fifo);
+stop_tx:
+	pthread_mutex_lock(&linux_desc->lock);
+	linux_desc->tx_run = false;
+	pthread_cond_signal(&linux_desc->tx_data);
+	pthread_mutex_unlock(&linux_desc->lock);
+	pthread_join(linux_desc->tx_thread, NULL);
+free_tx_buf:
+	no_os_free(linux_desc->tx_buf);
+free_sync:
+	pthread_cond_destroy(&linux_desc->tx_space);
+	pthread_cond_destroy(&linux_desc->tx_data);
+	pthread_cond_destroy(&linux_desc->rx_space);
+	pthread_mutex_destroy(&linux_desc->lock);
 free:
 	close(linux_desc->fd);
 free_terminal:
@@ -233,10 +583,31 @@ static int32_t linux_uart_remove(struct no_os_uart_desc *desc)
 
 	linux_desc = desc->extra;
 
+	if (desc->rx_fifo) {
+		linux_desc->rx_run = false;
+		pthread_join(linux_desc->rx_thread, NULL);
+		lf256fifo_remove(desc->rx_fifo);
+		no_os_free(desc->rx_fifo);
+	}
+
+	/* The TX thread sends the queued bytes before exiting */
+	pthread_mutex_lock(&linux_desc->lock);
+	linux_desc->tx_run = false;
+	pthread_cond_signal(&linux_desc->tx_data);
+	pthread_mutex_unlock(&linux_desc->lock);
+	pthread_join(linux_desc->tx_thread, NULL);
+	tcdrain(linux_desc->fd);
+
 	ret = close(linux_desc->fd);
 	if (ret < 0)
 		printf("%s: Can't close device\n\r", __func__);
 
+	pthread_cond_destroy(&linux_desc->tx_space);
+	pthread_cond_destroy(&linux_desc->tx_data);
+	pthread_cond_destroy(&linux_desc->rx_space);
+	pthread_mutex_destroy(&linux_desc->lock);
+	no_os_free(linux_desc->tx_buf);
+	no_os_free(linux_desc->terminal);
 	no_os_free(desc->extra);
 	no_os_free(desc);
 
@@ -244,29 +615,34 @@ static int32_t linux_uart_remove(struct no_os_uart_desc *desc)
 };
 
 /**
- * @brief Write data to UART device.
+ * @brief Write data to UART device. The data is queued in the software TX
+ * buffer, waiting only while the buffer is full, and sent by the TX thread.
  * @param desc - Instance of UART.
  * @param data - Pointer to buffer containing data.
- * @param bytes_number - Number of bytes to read.
- * @return 0 in case of success, -1 otherwise.
+ * @param bytes_number - Number of bytes to write.
+ * @return Number of written bytes in case of success, negative error code
+ * otherwise.
  */
 static int32_t linux_uart_write(struct no_os_uart_desc *desc,
 				const uint8_t *data,
 				uint32_t bytes_number)
 {
-	struct linux_uart_desc *linux_desc;
-	uint32_t count = 0;
-	int32_t ret;
-
-	linux_desc = desc->extra;
-
-	while (count < bytes_number) {
-		ret = write(linux_desc->fd, data, bytes_number);
-		if (ret > 0)
-			count += ret;
-	}
+	return linux_uart_tx_queue(desc->extra, data, bytes_number, true);
+};
 
-	return 0;
+/**
+ * @brief Write data to UART device without waiting.
+ * @param desc - Instance of UART.
+ * @param data - Pointer to buffer containing data.
+ * @param bytes_number - Number of bytes to write.
+ * @return Number of queued bytes, which may be less than bytes_number when the
+ * software TX buffer is full, negative error code otherwise.
+ */
+static int32_t linux_uart_write_nonblocking(struct no_os_uart_desc *desc,
+		const uint8_t *data,
+		uint32_t bytes_number)
+{
+	return linux_uart_tx_queue(desc->extra, data, bytes_number, false);
 };
 
 /**
@@ -274,24 +650,49 @@ static int32_t linux_uart_write(struct no_os_uart_desc *desc,
  * @param desc - Instance of UART.
  * @param data - Pointer to buffer containing data.
  * @param bytes_number - Number of bytes to read.
- * @return 0 in case of success, -1 otherwise.
+ * @return Number of read bytes in case of success, negative error code
+ * otherwise. With asynchronous_rx, returns the bytes already received, up to
+ * bytes_number, or -EAGAIN if there are none.
  */
 static int32_t linux_uart_read(struct no_os_uart_desc *desc, uint8_t *data,
 			       uint32_t bytes_number)
 {
 	struct linux_uart_desc *linux_desc;
 	uint32_t count = 0;
-	int ret;
+	ssize_t ret;
 
 	linux_desc = desc->extra;
 
+	if (desc->rx_fifo) {
+		for (count = 0; count < bytes_number; count++)
+			if (lf256fifo_read(desc->rx_fifo, &data[count]))
+				break;
+
+		if (!count)
+			return -EAGAIN;
+
+		/* Wake up the receive thread if it waits for space */
+		pthread_mutex_lock(&linux_desc->lock);
+		pthread_cond_signal(&linux_desc->rx_space);
+		pthread_mutex_unlock(&linux_desc->lock);
+
+		return count;
+	}
+
 	while (count < bytes_number) {
 		ret = read(linux_desc->fd, &data[count], bytes_number - count);
-		if (ret > 0)
+		if (ret > 0) {
 			count += ret;
+			continue;
+		}
+		if (ret < 0 && errno != EAGAIN && errno != EINTR)
+			return -errno;
+
+		if (linux_uart_wait(linux_desc->fd, POLLIN, -1) < 0)
+			return -errno;
 	}
 
-	return 0;
+	return count;
 };
 
 /**
@@ -301,5 +702,6 @@ const struct no_os_uart_platform_ops linux_uart_ops = {
 	.init = &linux_uart_init,
 	.read = &linux_uart_read,
 	.write = &linux_uart_write,
+	.write_nonblocking = &linux_uart_write_nonblocking,
 	.remove = &linux_uart_remove
 };
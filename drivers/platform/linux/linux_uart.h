@@ -43,6 +43,8 @@
 struct linux_uart_init_param {
 	/** UART device ID (/dev/"device_id") */
 	const char *device_id;
+	/** Size of the software TX buffer, 0 for the default 4 KiB */
+	uint32_t tx_buffer_size;
 };
 
 /**
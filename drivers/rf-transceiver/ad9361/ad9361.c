@@ -43,6 +43,7 @@
 #include "ad9361_util.h"
 #include "no_os_util.h"
 #include "no_os_alloc.h"
+#include "no_os_timer.h"
 #include "app_config.h"
 
 #define diff_abs(x, y) ((x) > (y) ? (x - y) : (y - x))
@@ -690,14 +691,11 @@ int32_t ad9361_spi_readm(struct no_os_spi_desc *spi, uint32_t reg,
 {
 	int32_t ret = 0;
 	uint16_t cmd;
-	uint8_t *rbuffer;
+	uint8_t rbuffer[MAX_MBYTE_SPI + 2];
 	if (num > MAX_MBYTE_SPI)
 		return -EINVAL;
 
 	cmd = AD_READ | AD_CNT(num) | AD_ADDR(reg);
-	rbuffer = no_os_malloc(num + 2);
-	if (!rbuffer)
-		return -ENOMEM;
 	rbuffer[0] = cmd >> 8;
 	rbuffer[1] = cmd & 0xFF;
 	ret = no_os_spi_write_and_read(spi, &rbuffer[0], 2 + num);
@@ -707,7 +705,6 @@ int32_t ad9361_spi_readm(struct no_os_spi_desc *spi, uint32_t reg,
 	else
 		memcpy(rbuf, &rbuffer[2], num);
 
-	no_os_free(rbuffer);
 #ifdef _DEBUG
 	{
 		int32_t i;
@@ -925,6 +922,91 @@ static int32_t ad9361_spi_writem(struct no_os_spi_desc *spi,
 	return 0;
 }
 
+/**
+ * Queue a multiple bytes register write. The queued writes are sent as
+ * separate frames of a single SPI transfer by ad9361_spi_queue_flush(), or
+ * when the queue is full.
+ * @param phy The AD9361 state structure.
+ * @param reg The register address.
+ * @param tbuf The data buffer.
+ * @param num The number of bytes to write.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+int32_t ad9361_spi_queue_writem(struct ad9361_rf_phy *phy, uint32_t reg,
+				const uint8_t *tbuf, uint32_t num)
+{
+	struct ad9361_spi_queue *queue = &phy->spi_queue;
+	uint8_t *buf;
+	int32_t ret;
+	uint16_t cmd;
+
+	if (num > MAX_MBYTE_SPI)
+		return -EINVAL;
+
+	if (queue->nb == AD9361_SPI_QUEUE_SIZE) {
+		ret = ad9361_spi_queue_flush(phy);
+		if (ret < 0)
+			return ret;
+	}
+
+	buf = queue->buf[queue->nb];
+	cmd = AD_WRITE | AD_CNT(num) | AD_ADDR(reg);
+	buf[0] = cmd >> 8;
+	buf[1] = cmd & 0xFF;
+	memcpy(&buf[2], tbuf, num);
+
+	queue->msgs[queue->nb] = (struct no_os_spi_msg) {
+		.tx_buff = buf,
+		.rx_buff = buf,
+		.bytes_number = num + 2,
+		.cs_change = 1,
+	};
+	queue->nb++;
+
+	return 0;
+}
+
+/**
+ * Queue a register write.
+ * @param phy The AD9361 state structure.
+ * @param reg The register address.
+ * @param val The value of the register.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+int32_t ad9361_spi_queue_write(struct ad9361_rf_phy *phy,
+			       uint32_t reg, uint32_t val)
+{
+	uint8_t buf = val;
+
+	return ad9361_spi_queue_writem(phy, reg, &buf, 1);
+}
+
+/**
+ * Send the queued register writes in a single SPI transfer. On error the
+ * queued writes are dropped and the error is returned, so callers must not
+ * go on with a register sequence after a failed queue write or flush.
+ * @param phy The AD9361 state structure.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+int32_t ad9361_spi_queue_flush(struct ad9361_rf_phy *phy)
+{
+	struct ad9361_spi_queue *queue = &phy->spi_queue;
+	uint32_t nb = queue->nb;
+	int32_t ret;
+
+	if (!nb)
+		return 0;
+
+	ret = no_os_spi_transfer(phy->spi, queue->msgs, nb);
+	/* The queue is emptied either way, a failed batch is not retried */
+	queue->nb = 0;
+	if (ret < 0)
+		dev_err(&phy->spi->dev, "Write Error %"PRId32", %"PRIu32
+			" queued writes dropped", ret, nb);
+
+	return ret;
+}
+
 /**
  * Validate RF BW frequency.
  * @param phy The AD9361 state structure.
@@ -1484,8 +1566,11 @@ static int32_t ad9361_load_gt(struct ad9361_rf_phy *phy, uint64_t freq,
 	lna = phy->pdata->elna_ctrl.elna_in_gaintable_all_index_en ?
 	      EXT_LNA_CTRL : 0;
 
-	ad9361_spi_write(spi, REG_GAIN_TABLE_CONFIG, START_GAIN_TABLE_CLOCK |
-			 RECEIVER_SELECT(dest)); /* Start Gain Table Clock */
+	ret = ad9361_spi_queue_write(phy, REG_GAIN_TABLE_CONFIG,
+				     START_GAIN_TABLE_CLOCK |
+				     RECEIVER_SELECT(dest)); /* Start Gain Table Clock */
+	if (ret < 0)
+		return ret;
 
 	/* TX QUAD Calibration */
 	if (phy->pdata->split_gt)
@@ -1496,34 +1581,62 @@ static int32_t ad9361_load_gt(struct ad9361_rf_phy *phy, uint64_t freq,
 	phy->tx_quad_lpf_tia_match = -EINVAL;
 
 	for (i = 0; i < index_max; i++) {
-		ad9361_spi_write(spi, REG_GAIN_TABLE_ADDRESS, i); /* Gain Table Index */
-		ad9361_spi_write(spi, REG_GAIN_TABLE_WRITE_DATA1,
-				 tab[i][0] | lna); /* Ext LNA, Int LNA, & Mixer Gain Word */
-		ad9361_spi_write(spi, REG_GAIN_TABLE_WRITE_DATA2,
-				 tab[i][1]); /* TIA & LPF Word */
-		ad9361_spi_write(spi, REG_GAIN_TABLE_WRITE_DATA3,
-				 tab[i][2]); /* DC Cal bit & Dig Gain Word */
-		ad9361_spi_write(spi, REG_GAIN_TABLE_CONFIG,
-				 START_GAIN_TABLE_CLOCK |
-				 WRITE_GAIN_TABLE |
-				 RECEIVER_SELECT(dest)); /* Gain Table Index */
-		ad9361_spi_write(spi, REG_GAIN_TABLE_READ_DATA1,
-				 0); /* Dummy Write to delay 3 ADCCLK/16 cycles */
-		ad9361_spi_write(spi, REG_GAIN_TABLE_READ_DATA1,
-				 0); /* Dummy Write to delay ~1u */
+		ret = ad9361_spi_queue_write(phy, REG_GAIN_TABLE_ADDRESS,
+					     i); /* Gain Table Index */
+		if (ret < 0)
+			return ret;
+		ret = ad9361_spi_queue_write(phy, REG_GAIN_TABLE_WRITE_DATA1,
+					     tab[i][0] | lna); /* Ext LNA, Int LNA, & Mixer Gain Word */
+		if (ret < 0)
+			return ret;
+		ret = ad9361_spi_queue_write(phy, REG_GAIN_TABLE_WRITE_DATA2,
+					     tab[i][1]); /* TIA & LPF Word */
+		if (ret < 0)
+			return ret;
+		ret = ad9361_spi_queue_write(phy, REG_GAIN_TABLE_WRITE_DATA3,
+					     tab[i][2]); /* DC Cal bit & Dig Gain Word */
+		if (ret < 0)
+			return ret;
+		ret = ad9361_spi_queue_write(phy, REG_GAIN_TABLE_CONFIG,
+					     START_GAIN_TABLE_CLOCK |
+					     WRITE_GAIN_TABLE |
+					     RECEIVER_SELECT(dest)); /* Gain Table Index */
+		if (ret < 0)
+			return ret;
+		ret = ad9361_spi_queue_write(phy, REG_GAIN_TABLE_READ_DATA1,
+					     0); /* Dummy Write to delay 3 ADCCLK/16 cycles */
+		if (ret < 0)
+			return ret;
+		ret = ad9361_spi_queue_write(phy, REG_GAIN_TABLE_READ_DATA1,
+					     0); /* Dummy Write to delay ~1u */
+		if (ret < 0)
+			return ret;
 
 		if ((tab[i][1] & lpf_tia_mask) == 0x20)
 			phy->tx_quad_lpf_tia_match = i;
 
 	}
 
-	ad9361_spi_write(spi, REG_GAIN_TABLE_CONFIG, START_GAIN_TABLE_CLOCK |
-			 RECEIVER_SELECT(dest)); /* Clear Write Bit */
-	ad9361_spi_write(spi, REG_GAIN_TABLE_READ_DATA1,
-			 0); /* Dummy Write to delay ~1u */
-	ad9361_spi_write(spi, REG_GAIN_TABLE_READ_DATA1,
-			 0); /* Dummy Write to delay ~1u */
-	ad9361_spi_write(spi, REG_GAIN_TABLE_CONFIG, 0); /* Stop Gain Table Clock */
+	ret = ad9361_spi_queue_write(phy, REG_GAIN_TABLE_CONFIG,
+				     START_GAIN_TABLE_CLOCK |
+				     RECEIVER_SELECT(dest)); /* Clear Write Bit */
+	if (ret < 0)
+		return ret;
+	ret = ad9361_spi_queue_write(phy, REG_GAIN_TABLE_READ_DATA1,
+				     0); /* Dummy Write to delay ~1u */
+	if (ret < 0)
+		return ret;
+	ret = ad9361_spi_queue_write(phy, REG_GAIN_TABLE_READ_DATA1,
+				     0); /* Dummy Write to delay ~1u */
+	if (ret < 0)
+		return ret;
+	ret = ad9361_spi_queue_write(phy, REG_GAIN_TABLE_CONFIG,
+				     0); /* Stop Gain Table Clock */
+	if (ret < 0)
+		return ret;
+	ret = ad9361_spi_queue_flush(phy);
+	if (ret < 0)
+		return ret;
 
 	phy->current_table = band;
 
@@ -4998,19 +5111,33 @@ int32_t ad9361_fastlock_load(struct ad9361_rf_phy *phy, bool tx,
 
 	buf[0] = values[0];
 	buf[1] = RX_FAST_LOCK_PROFILE_ADDR(profile) | RX_FAST_LOCK_PROFILE_WORD(0);
-	ad9361_spi_writem(phy->spi, REG_RX_FAST_LOCK_PROGRAM_DATA + offs, buf, 2);
+	ret = ad9361_spi_queue_writem(phy, REG_RX_FAST_LOCK_PROGRAM_DATA + offs,
+				      buf, 2);
+	if (ret < 0)
+		return ret;
 
 	for (i = 1; i < RX_FAST_LOCK_CONFIG_WORD_NUM; i++) {
 		buf[0] = RX_FAST_LOCK_PROGRAM_WRITE | RX_FAST_LOCK_PROGRAM_CLOCK_ENABLE;
 		buf[1] = 0;
 		buf[2] = values[i];
 		buf[3] = RX_FAST_LOCK_PROFILE_ADDR(profile) | RX_FAST_LOCK_PROFILE_WORD(i);
-		ad9361_spi_writem(phy->spi, REG_RX_FAST_LOCK_PROGRAM_CTRL + offs, buf, 4);
+		ret = ad9361_spi_queue_writem(phy, REG_RX_FAST_LOCK_PROGRAM_CTRL + offs,
+					      buf, 4);
+		if (ret < 0)
+			return ret;
 	}
 
-	ad9361_spi_write(phy->spi, REG_RX_FAST_LOCK_PROGRAM_CTRL + offs,
-			 RX_FAST_LOCK_PROGRAM_WRITE | RX_FAST_LOCK_PROGRAM_CLOCK_ENABLE);
-	ad9361_spi_write(phy->spi, REG_RX_FAST_LOCK_PROGRAM_CTRL + offs, 0);
+	ret = ad9361_spi_queue_write(phy, REG_RX_FAST_LOCK_PROGRAM_CTRL + offs,
+				     RX_FAST_LOCK_PROGRAM_WRITE |
+				     RX_FAST_LOCK_PROGRAM_CLOCK_ENABLE);
+	if (ret < 0)
+		return ret;
+	ret = ad9361_spi_queue_write(phy, REG_RX_FAST_LOCK_PROGRAM_CTRL + offs, 0);
+	if (ret < 0)
+		return ret;
+	ret = ad9361_spi_queue_flush(phy);
+	if (ret < 0)
+		return ret;
 
 	phy->fastlock.entry[tx][profile].flags = FASTLOOK_INIT;
 	phy->fastlock.entry[tx][profile].alc_orig = values[15];
@@ -5020,73 +5147,130 @@ int32_t ad9361_fastlock_load(struct ad9361_rf_phy *phy, bool tx,
 }
 
 /**
- * Fastlock store.
+ * Read a register field for ad9361_fastlock_read_pll(), keeping the first
+ * error.
+ * @param spi The SPI descriptor.
+ * @param reg The register address.
+ * @param mask The field mask.
+ * @param err The first error of the sequence, left untouched on success.
+ * @return The field value, 0 in case of error.
+ */
+static uint32_t ad9361_fastlock_readf(struct no_os_spi_desc *spi, uint32_t reg,
+				      uint32_t mask, int32_t *err)
+{
+	int32_t ret;
+
+	ret = ad9361_spi_readf(spi, reg, mask);
+	if (ret < 0) {
+		if (!*err)
+			*err = ret;
+		return 0;
+	}
+
+	return ret;
+}
+
+/**
+ * Read the fastlock program words of the current synthesizer setting.
  * @param phy The AD9361 state structure.
  * @param tx
- * @param profile
+ * @param val The RX_FAST_LOCK_CONFIG_WORD_NUM program words.
  * @return 0 in case of success, negative error code otherwise.
  */
-int32_t ad9361_fastlock_store(struct ad9361_rf_phy *phy, bool tx,
-			      uint32_t profile)
+static int32_t ad9361_fastlock_read_pll(struct ad9361_rf_phy *phy, bool tx,
+					uint8_t *val)
 {
 	struct no_os_spi_desc *spi = phy->spi;
-	uint8_t val[16];
 	uint32_t offs = 0, x, y;
-
-	dev_dbg(&phy->spi->dev, "%s: %s Profile %"PRIu32":",
-		__func__, tx ? "TX" : "RX", profile);
+	int32_t err = 0;
 
 	if (tx)
 		offs = REG_TX_FAST_LOCK_SETUP - REG_RX_FAST_LOCK_SETUP;
 
-	val[0] = ad9361_spi_read(spi, REG_RX_INTEGER_BYTE_0 + offs);
-	val[1] = ad9361_spi_read(spi, REG_RX_INTEGER_BYTE_1 + offs);
-	val[2] = ad9361_spi_read(spi, REG_RX_FRACT_BYTE_0 + offs);
-	val[3] = ad9361_spi_read(spi, REG_RX_FRACT_BYTE_1 + offs);
-	val[4] = ad9361_spi_read(spi, REG_RX_FRACT_BYTE_2 + offs);
+	val[0] = ad9361_fastlock_readf(spi, REG_RX_INTEGER_BYTE_0 + offs, 0xFF, &err);
+	val[1] = ad9361_fastlock_readf(spi, REG_RX_INTEGER_BYTE_1 + offs, 0xFF, &err);
+	val[2] = ad9361_fastlock_readf(spi, REG_RX_FRACT_BYTE_0 + offs, 0xFF, &err);
+	val[3] = ad9361_fastlock_readf(spi, REG_RX_FRACT_BYTE_1 + offs, 0xFF, &err);
+	val[4] = ad9361_fastlock_readf(spi, REG_RX_FRACT_BYTE_2 + offs, 0xFF, &err);
 
-	x = ad9361_spi_readf(spi, REG_RX_VCO_BIAS_1 + offs, VCO_BIAS_REF(~0));
-	y = ad9361_spi_readf(spi, REG_RX_ALC_VARACTOR + offs, VCO_VARACTOR(~0));
+	x = ad9361_fastlock_readf(spi, REG_RX_VCO_BIAS_1 + offs, VCO_BIAS_REF(~0),
+				  &err);
+	y = ad9361_fastlock_readf(spi, REG_RX_ALC_VARACTOR + offs, VCO_VARACTOR(~0),
+				  &err);
 	val[5] = (x << 4) | y;
 
-	x = ad9361_spi_readf(spi, REG_RX_VCO_BIAS_1 + offs, VCO_BIAS_TCF(~0));
-	y = ad9361_spi_readf(spi, REG_RX_CP_CURRENT + offs, CHARGE_PUMP_CURRENT(~0));
+	x = ad9361_fastlock_readf(spi, REG_RX_VCO_BIAS_1 + offs, VCO_BIAS_TCF(~0),
+				  &err);
+	y = ad9361_fastlock_readf(spi, REG_RX_CP_CURRENT + offs,
+				  CHARGE_PUMP_CURRENT(~0), &err);
 	/* Wide BW option: N = 1
 	* Set init and steady state values to the same - let user space handle it
 	*/
 	val[6] = (x << 6) | y;
 	val[7] = y;
 
-	x = ad9361_spi_readf(spi, REG_RX_LOOP_FILTER_3 + offs, LOOP_FILTER_R3(~0));
+	x = ad9361_fastlock_readf(spi, REG_RX_LOOP_FILTER_3 + offs,
+				  LOOP_FILTER_R3(~0), &err);
 	val[8] = (x << 4) | x;
 
-	x = ad9361_spi_readf(spi, REG_RX_LOOP_FILTER_2 + offs, LOOP_FILTER_C3(~0));
+	x = ad9361_fastlock_readf(spi, REG_RX_LOOP_FILTER_2 + offs,
+				  LOOP_FILTER_C3(~0), &err);
 	val[9] = (x << 4) | x;
 
-	x = ad9361_spi_readf(spi, REG_RX_LOOP_FILTER_1 + offs, LOOP_FILTER_C1(~0));
-	y = ad9361_spi_readf(spi, REG_RX_LOOP_FILTER_1 + offs, LOOP_FILTER_C2(~0));
+	x = ad9361_fastlock_readf(spi, REG_RX_LOOP_FILTER_1 + offs,
+				  LOOP_FILTER_C1(~0), &err);
+	y = ad9361_fastlock_readf(spi, REG_RX_LOOP_FILTER_1 + offs,
+				  LOOP_FILTER_C2(~0), &err);
 	val[10] = (x << 4) | y;
 
-	x = ad9361_spi_readf(spi, REG_RX_LOOP_FILTER_2 + offs, LOOP_FILTER_R1(~0));
+	x = ad9361_fastlock_readf(spi, REG_RX_LOOP_FILTER_2 + offs,
+				  LOOP_FILTER_R1(~0), &err);
 	val[11] = (x << 4) | x;
 
-	x = ad9361_spi_readf(spi, REG_RX_VCO_VARACTOR_CTRL_0 + offs,
-			     VCO_VARACTOR_REFERENCE_TCF(~0));
-	y = ad9361_spi_readf(spi, REG_RFPLL_DIVIDERS,
-			     tx ? TX_VCO_DIVIDER(~0) : RX_VCO_DIVIDER(~0));
+	x = ad9361_fastlock_readf(spi, REG_RX_VCO_VARACTOR_CTRL_0 + offs,
+				  VCO_VARACTOR_REFERENCE_TCF(~0), &err);
+	y = ad9361_fastlock_readf(spi, REG_RFPLL_DIVIDERS,
+				  tx ? TX_VCO_DIVIDER(~0) : RX_VCO_DIVIDER(~0), &err);
 	val[12] = (x << 4) | y;
 
-	x = ad9361_spi_readf(spi, REG_RX_FORCE_VCO_TUNE_1 + offs, VCO_CAL_OFFSET(~0));
-	y = ad9361_spi_readf(spi, REG_RX_VCO_VARACTOR_CTRL_1 + offs,
-			     VCO_VARACTOR_REFERENCE(~0));
+	x = ad9361_fastlock_readf(spi, REG_RX_FORCE_VCO_TUNE_1 + offs,
+				  VCO_CAL_OFFSET(~0), &err);
+	y = ad9361_fastlock_readf(spi, REG_RX_VCO_VARACTOR_CTRL_1 + offs,
+				  VCO_VARACTOR_REFERENCE(~0), &err);
 	val[13] = (x << 4) | y;
 
-	val[14] = ad9361_spi_read(spi, REG_RX_FORCE_VCO_TUNE_0 + offs);
+	val[14] = ad9361_fastlock_readf(spi, REG_RX_FORCE_VCO_TUNE_0 + offs, 0xFF,
+					&err);
 
-	x = ad9361_spi_readf(spi, REG_RX_FORCE_ALC + offs, FORCE_ALC_WORD(~0));
-	y = ad9361_spi_readf(spi, REG_RX_FORCE_VCO_TUNE_1 + offs, FORCE_VCO_TUNE);
+	x = ad9361_fastlock_readf(spi, REG_RX_FORCE_ALC + offs, FORCE_ALC_WORD(~0),
+				  &err);
+	y = ad9361_fastlock_readf(spi, REG_RX_FORCE_VCO_TUNE_1 + offs,
+				  FORCE_VCO_TUNE, &err);
 	val[15] = (x << 1) | y;
 
+	return err;
+}
+
+/**
+ * Fastlock store.
+ * @param phy The AD9361 state structure.
+ * @param tx
+ * @param profile
+ * @return 0 in case of success, negative error code otherwise.
+ */
+int32_t ad9361_fastlock_store(struct ad9361_rf_phy *phy, bool tx,
+			      uint32_t profile)
+{
+	uint8_t val[RX_FAST_LOCK_CONFIG_WORD_NUM];
+	int32_t ret;
+
+	dev_dbg(&phy->spi->dev, "%s: %s Profile %"PRIu32":",
+		__func__, tx ? "TX" : "RX", profile);
+
+	ret = ad9361_fastlock_read_pll(phy, tx, val);
+	if (ret < 0)
+		return ret;
+
 	return ad9361_fastlock_load(phy, tx, profile, val);
 }
 
@@ -5206,6 +5390,268 @@ int32_t ad9361_fastlock_recall(struct ad9361_rf_phy *phy, bool tx,
 				RX_FAST_LOCK_MODE_ENABLE);
 }
 
+/**
+ * Build a frequency hopping table. Each LO frequency is tuned once through
+ * the regular synthesizer path, including the VCO calibration, and the
+ * resulting fastlock program words are kept in memory. The LO is then set back
+ * to its frequency before the call and the first AD9361_FASTLOCK_SLOTS entries
+ * are loaded in the fastlock slots.
+ * @param phy The AD9361 state structure.
+ * @param table The hop table.
+ * @param init The hop table parameters.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+int32_t ad9361_hop_table_init(struct ad9361_rf_phy *phy,
+			      struct ad9361_hop_table **table,
+			      const struct ad9361_hop_table_init *init)
+{
+	struct refclk_scale *lo_clk;
+	struct ad9361_hop_table *tab;
+	uint32_t orig_rate;
+	int32_t restore;
+	uint32_t i;
+	int32_t ret;
+
+	if (!table || !init || !init->freq_hz || !init->nb_freqs)
+		return -EINVAL;
+
+	tab = no_os_calloc(1, sizeof(*tab));
+	if (!tab)
+		return -ENOMEM;
+
+	tab->words = no_os_calloc(init->nb_freqs, sizeof(*tab->words));
+	if (!tab->words) {
+		ret = -ENOMEM;
+		goto error;
+	}
+
+	tab->tx = init->tx;
+	tab->nb_freqs = init->nb_freqs;
+	tab->timer = init->timer;
+	tab->active_slot = -1;
+
+	/* Each entry is tuned in turn, the LO is set back afterwards */
+	lo_clk = phy->ref_clk_scale[tab->tx ? TX_RFPLL : RX_RFPLL];
+	orig_rate = clk_get_rate(phy, lo_clk);
+
+	for (i = 0; i < tab->nb_freqs; i++) {
+		ret = clk_set_rate(phy, lo_clk, ad9361_to_clk(init->freq_hz[i]));
+		if (ret < 0)
+			break;
+
+		ret = ad9361_fastlock_read_pll(phy, tab->tx, tab->words[i]);
+		if (ret < 0)
+			break;
+	}
+
+	restore = clk_set_rate(phy, lo_clk, orig_rate);
+	if (!ret)
+		ret = restore;
+	if (ret < 0)
+		goto error;
+
+	for (i = 0; i < AD9361_FASTLOCK_SLOTS; i++) {
+		tab->slot_entry[i] = -1;
+		if (i >= tab->nb_freqs)
+			continue;
+
+		ret = ad9361_fastlock_load(phy, tab->tx, i, tab->words[i]);
+		if (ret < 0)
+			goto error;
+		tab->slot_entry[i] = i;
+	}
+
+	*table = tab;
+
+	return 0;
+
+error:
+	no_os_free(tab->words);
+	no_os_free(tab);
+
+	return ret;
+}
+
+/**
+ * Free the resources allocated by ad9361_hop_table_init().
+ * @param phy The AD9361 state structure.
+ * @param table The hop table.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+int32_t ad9361_hop_table_remove(struct ad9361_rf_phy *phy,
+				struct ad9361_hop_table *table)
+{
+	if (!table)
+		return -EINVAL;
+
+	no_os_free(table->words);
+	no_os_free(table);
+
+	return 0;
+}
+
+/**
+ * Find the fastlock slot to be reloaded: the one holding the entry which is
+ * needed the latest in hop order, never the active slot.
+ * @param table The hop table.
+ * @param index The table entry which is about to become active.
+ * @return The slot number.
+ */
+static uint32_t ad9361_hop_table_victim(struct ad9361_hop_table *table,
+					uint32_t index)
+{
+	uint32_t slot, victim = 0, dist, max_dist = 0;
+
+	for (slot = 0; slot < AD9361_FASTLOCK_SLOTS; slot++) {
+		if ((int32_t)slot == table->active_slot)
+			continue;
+		if (table->slot_entry[slot] < 0)
+			return slot;
+
+		dist = (table->slot_entry[slot] + table->nb_freqs - index) %
+		       table->nb_freqs;
+		if (dist == 0)
+			dist = table->nb_freqs;
+		if (dist >= max_dist) {
+			max_dist = dist;
+			victim = slot;
+		}
+	}
+
+	return victim;
+}
+
+/**
+ * Find the fastlock slot holding a table entry.
+ * @param table The hop table.
+ * @param index The table entry.
+ * @return The slot number, -1 if the entry is not loaded.
+ */
+static int32_t ad9361_hop_table_find(struct ad9361_hop_table *table,
+				     uint32_t index)
+{
+	int32_t slot;
+
+	for (slot = 0; slot < AD9361_FASTLOCK_SLOTS; slot++)
+		if (table->slot_entry[slot] == (int32_t)index)
+			return slot;
+
+	return -1;
+}
+
+/**
+ * Retune the synthesizer to a hop table entry through fastlock, then preload
+ * the next entry in hop order into a free slot while this one is in use.
+ * When the timer is set, the time from the profile recall until the VCO is
+ * locked is accumulated in the table statistics.
+ * @param phy The AD9361 state structure.
+ * @param table The hop table.
+ * @param index The table entry.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+int32_t ad9361_hop_table_hop(struct ad9361_rf_phy *phy,
+			     struct ad9361_hop_table *table, uint32_t index)
+{
+	struct ad9361_hop_stats *stats;
+	uint64_t start = 0, end = 0;
+	uint32_t timeout = AD9361_HOP_LOCK_TIMEOUT_US, next, lat;
+	uint32_t lock_reg;
+	int32_t slot, ret;
+
+	if (!table || index >= table->nb_freqs)
+		return -EINVAL;
+
+	stats = &table->stats;
+	lock_reg = table->tx ? REG_TX_CP_OVERRANGE_VCO_LOCK :
+		   REG_RX_CP_OVERRANGE_VCO_LOCK;
+
+	slot = ad9361_hop_table_find(table, index);
+	if (slot < 0) {
+		slot = ad9361_hop_table_victim(table, index);
+		ret = ad9361_fastlock_load(phy, table->tx, slot,
+					   table->words[index]);
+		if (ret < 0)
+			return ret;
+		table->slot_entry[slot] = index;
+		stats->nb_misses++;
+	}
+
+	if (table->timer)
+		no_os_timer_get_elapsed_time_nsec(table->timer, &start);
+
+	ret = ad9361_fastlock_recall(phy, table->tx, slot);
+	if (ret < 0)
+		return ret;
+
+	while (true) {
+		ret = ad9361_spi_readf(phy->spi, lock_reg, VCO_LOCK);
+		if (ret < 0)
+			return ret;
+		if (ret)
+			break;
+
+		if (!timeout--) {
+			dev_err(&phy->spi->dev, "%s: VCO lock TIMEOUT", __func__);
+			return -ETIMEDOUT;
+		}
+		no_os_udelay(1);
+	}
+
+	if (table->timer) {
+		no_os_timer_get_elapsed_time_nsec(table->timer, &end);
+		lat = end - start;
+		stats->last_ns = lat;
+		stats->total_ns += lat;
+		if (!stats->nb_hops || lat < stats->min_ns)
+			stats->min_ns = lat;
+		if (lat > stats->max_ns)
+			stats->max_ns = lat;
+	}
+	stats->nb_hops++;
+
+	table->active_slot = slot;
+	table->current = index;
+
+	/* Pipeline: refill one slot with the first upcoming entry not loaded. */
+	if (table->nb_freqs <= AD9361_FASTLOCK_SLOTS)
+		return 0;
+
+	for (next = 1; next < AD9361_FASTLOCK_SLOTS; next++) {
+		index = (table->current + next) % table->nb_freqs;
+		if (ad9361_hop_table_find(table, index) >= 0)
+			continue;
+
+		slot = ad9361_hop_table_victim(table, table->current);
+		ret = ad9361_fastlock_load(phy, table->tx, slot,
+					   table->words[index]);
+		if (ret < 0)
+			return ret;
+		table->slot_entry[slot] = index;
+		break;
+	}
+
+	return 0;
+}
+
+/**
+ * Retune the synthesizer to the next hop table entry, wrapping around.
+ * @param phy The AD9361 state structure.
+ * @param table The hop table.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+int32_t ad9361_hop_table_next(struct ad9361_rf_phy *phy,
+			      struct ad9361_hop_table *table)
+{
+	if (!table)
+		return -EINVAL;
+
+	if (table->active_slot < 0)
+		return ad9361_hop_table_hop(phy, table, 0);
+
+	return ad9361_hop_table_hop(phy, table,
+				    (table->current + 1) % table->nb_freqs);
+}
+
 /**
  * Fastlock save.
  * @param phy The AD9361 state structure.
@@ -5859,26 +6305,48 @@ int32_t ad9361_load_fir_filter_coef(struct ad9361_rf_phy *phy,
 
 	fir_conf |= FIR_NUM_TAPS(val) | FIR_SELECT(dest) | FIR_START_CLK;
 
-	ad9361_spi_write(spi, REG_TX_FILTER_CONF + offs, fir_conf);
+	ret = ad9361_spi_queue_write(phy, REG_TX_FILTER_CONF + offs, fir_conf);
+	if (ret < 0)
+		goto restore_state;
 
 	for (val = 0; val < ntaps; val++) {
-		ad9361_spi_write(spi, REG_TX_FILTER_COEF_ADDR + offs, val);
-		ad9361_spi_write(spi, REG_TX_FILTER_COEF_WRITE_DATA_1 + offs,
-				 coef[val] & 0xFF);
-		ad9361_spi_write(spi, REG_TX_FILTER_COEF_WRITE_DATA_2 + offs,
-				 coef[val] >> 8);
-		ad9361_spi_write(spi, REG_TX_FILTER_CONF + offs,
-				 fir_conf | FIR_WRITE);
-		ad9361_spi_write(spi, REG_TX_FILTER_COEF_READ_DATA_2 + offs, 0);
-		ad9361_spi_write(spi, REG_TX_FILTER_COEF_READ_DATA_2 + offs, 0);
+		ret = ad9361_spi_queue_write(phy, REG_TX_FILTER_COEF_ADDR + offs, val);
+		if (ret < 0)
+			goto restore_state;
+		ret = ad9361_spi_queue_write(phy, REG_TX_FILTER_COEF_WRITE_DATA_1 + offs,
+					     coef[val] & 0xFF);
+		if (ret < 0)
+			goto restore_state;
+		ret = ad9361_spi_queue_write(phy, REG_TX_FILTER_COEF_WRITE_DATA_2 + offs,
+					     coef[val] >> 8);
+		if (ret < 0)
+			goto restore_state;
+		ret = ad9361_spi_queue_write(phy, REG_TX_FILTER_CONF + offs,
+					     fir_conf | FIR_WRITE);
+		if (ret < 0)
+			goto restore_state;
+		ret = ad9361_spi_queue_write(phy, REG_TX_FILTER_COEF_READ_DATA_2 + offs, 0);
+		if (ret < 0)
+			goto restore_state;
+		ret = ad9361_spi_queue_write(phy, REG_TX_FILTER_COEF_READ_DATA_2 + offs, 0);
+		if (ret < 0)
+			goto restore_state;
 	}
 
-	ad9361_spi_write(spi, REG_TX_FILTER_CONF + offs, fir_conf);
+	ret = ad9361_spi_queue_write(phy, REG_TX_FILTER_CONF + offs, fir_conf);
+	if (ret < 0)
+		goto restore_state;
 	fir_conf &= ~FIR_START_CLK;
-	ad9361_spi_write(spi, REG_TX_FILTER_CONF + offs, fir_conf);
+	ret = ad9361_spi_queue_write(phy, REG_TX_FILTER_CONF + offs, fir_conf);
+	if (ret < 0)
+		goto restore_state;
+	ret = ad9361_spi_queue_flush(phy);
+	if (ret < 0)
+		goto restore_state;
 
 	ret = ad9361_verify_fir_filter_coef(phy, dest, ntaps, coef);
 
+restore_state:
 	if (dest & FIR_IS_RX)
 		ad9361_spi_writef(phy->spi, REG_RX_ENABLE_FILTER_CTRL,
 				  RX_FIR_ENABLE_DECIMATION(~0), fir_enable);
@@ -34,6 +34,7 @@
 
 #include <stdint.h>
 #include "no_os_gpio.h"
+#include "no_os_spi.h"
 #include "common.h"
 
 #define REG_SPI_CONF				 0x000 /* SPI Configuration */
@@ -2836,6 +2837,7 @@
 #define MAX_BASEBAND_RATE		61440000UL
 
 #define MAX_MBYTE_SPI			8
+#define AD9361_SPI_QUEUE_SIZE		64
 
 #define RFPLL_MODULUS			8388593UL
 #define BBPLL_MODULUS			2088960UL
@@ -3298,6 +3300,47 @@ struct ad9361_fastlock {
 	struct ad9361_fastlock_entry entry[2][8];
 };
 
+#define AD9361_FASTLOCK_SLOTS	8
+/* Maximum wait for the VCO lock after a fastlock recall */
+#define AD9361_HOP_LOCK_TIMEOUT_US	2000
+
+struct no_os_timer_desc;
+
+/* Retune latency of the hop table, measured until the VCO is locked */
+struct ad9361_hop_stats {
+	uint32_t nb_hops;
+	/* Hops whose entry was not preloaded in a fastlock slot */
+	uint32_t nb_misses;
+	uint32_t last_ns;
+	uint32_t min_ns;
+	uint32_t max_ns;
+	uint64_t total_ns;
+};
+
+struct ad9361_hop_table_init {
+	/* Synthesizer used for hopping: false for RX, true for TX */
+	bool tx;
+	/* LO frequencies in hop order */
+	const uint64_t *freq_hz;
+	uint32_t nb_freqs;
+	/* Timer used to measure the retune latency. Optional */
+	struct no_os_timer_desc *timer;
+};
+
+struct ad9361_hop_table {
+	bool tx;
+	uint32_t nb_freqs;
+	/* Fastlock program words of each frequency */
+	uint8_t (*words)[RX_FAST_LOCK_CONFIG_WORD_NUM];
+	/* Table entry held by each fastlock slot, -1 if none */
+	int32_t slot_entry[AD9361_FASTLOCK_SLOTS];
+	/* Slot currently in use, -1 before the first hop */
+	int32_t active_slot;
+	uint32_t current;
+	struct no_os_timer_desc *timer;
+	struct ad9361_hop_stats stats;
+};
+
 enum dig_tune_flags {
 	BE_VERBOSE = 1,
 	BE_MOREVERBOSE = 2,
@@ -3325,6 +3368,13 @@ enum dev_id {
 	ID_AD9363A
 };
 
+/* Register writes queued to be sent in a single SPI transfer */
+struct ad9361_spi_queue {
+	struct no_os_spi_msg	msgs[AD9361_SPI_QUEUE_SIZE];
+	uint8_t			buf[AD9361_SPI_QUEUE_SIZE][MAX_MBYTE_SPI + 2];
+	uint32_t		nb;
+};
+
 struct ad9361_rf_phy {
 	enum dev_id		dev_sel;
 	struct no_os_spi_desc 	*spi;
@@ -3403,6 +3453,7 @@ struct ad9361_rf_phy {
 	uint32_t				bist_tone_level_dB;
 	uint32_t				bist_tone_mask;
 	bool			bbpll_initialized;
+	struct ad9361_spi_queue	spi_queue;
 };
 
 struct refclk_scale {
@@ -3434,6 +3485,11 @@ int32_t ad9361_spi_write(struct no_os_spi_desc *spi,
 			 uint32_t reg, uint32_t val);
 int32_t ad9361_reg_write(struct ad9361_rf_phy *phy,
 			 uint32_t reg, uint32_t val);
+int32_t ad9361_spi_queue_writem(struct ad9361_rf_phy *phy, uint32_t reg,
+				const uint8_t *tbuf, uint32_t num);
+int32_t ad9361_spi_queue_write(struct ad9361_rf_phy *phy,
+			       uint32_t reg, uint32_t val);
+int32_t ad9361_spi_queue_flush(struct ad9361_rf_phy *phy);
 int32_t ad9361_reset(struct ad9361_rf_phy *phy);
 int32_t ad9361_register_clocks(struct ad9361_rf_phy *phy);
 int32_t ad9361_unregister_clocks(struct ad9361_rf_phy *phy);
@@ -3524,6 +3580,15 @@ int32_t ad9361_fastlock_recall(struct ad9361_rf_phy *phy, bool tx,
 			       uint32_t profile);
 int32_t ad9361_fastlock_load(struct ad9361_rf_phy *phy, bool tx,
 			     uint32_t profile, uint8_t *values);
+int32_t ad9361_hop_table_init(struct ad9361_rf_phy *phy,
+			      struct ad9361_hop_table **table,
+			      const struct ad9361_hop_table_init *init);
+int32_t ad9361_hop_table_remove(struct ad9361_rf_phy *phy,
+				struct ad9361_hop_table *table);
+int32_t ad9361_hop_table_hop(struct ad9361_rf_phy *phy,
+			     struct ad9361_hop_table *table, uint32_t index);
+int32_t ad9361_hop_table_next(struct ad9361_rf_phy *phy,
+			      struct ad9361_hop_table *table);
 int32_t ad9361_fastlock_save(struct ad9361_rf_phy *phy, bool tx,
 			     uint32_t profile, uint8_t *values);
 void ad9361_ensm_force_state(struct ad9361_rf_phy *phy, uint8_t ensm_state);
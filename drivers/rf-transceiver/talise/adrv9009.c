@@ -1328,7 +1328,7 @@ int adrv9009_setup(struct adrv9009_rf_phy *phy)
 	struct no_os_clk_desc *rx_sample_clk = NULL;
 	struct no_os_clk_desc *orx_sample_clk = NULL;
 	struct no_os_clk_desc *tx_sample_clk = NULL;
-	struct no_os_clk_init_param clk_init;
+	struct no_os_clk_init_param clk_init = {0};
 	uint32_t api_vers[4];
 	uint8_t rev;
 	int ret;
@@ -37,6 +37,7 @@
 #include "no_os_delay.h"
 #include "no_os_error.h"
 #include "no_os_alloc.h"
+#include "no_os_util.h"
 
 #define BIT_CCS				(1u<<30)
 #define BIT_APPLICATION_CMD		(1u<<7)
@@ -62,6 +63,7 @@
 #define STUFF_ARG			(0x00000000u)
 #define CMD8_ARG			(0x000001AAu)
 #define ACMD41_ARG			(0x40000000u)
+#define SET_WR_BLK_ERASE_COUNT_MASK	(0x007FFFFFu)
 
 #define DATA_BLOCK_BITS			(9u)
 #define MASK_ADDR_IN_BLOCK		(DATA_BLOCK_LEN - 1u)
@@ -73,6 +75,8 @@
 #define MASK_RESPONSE_TOKEN		(0x0Eu)
 #define MASK_ERROR_TOKEN		(0xF0u)
 
+#define STREAM_POLL_US			(10u)
+
 
 /**
  * Read SD card bytes until one is different from 0xFF
@@ -88,6 +92,8 @@ static int32_t wait_for_response(struct sd_desc *sd_desc, uint8_t *data_out)
 	ret = -1;
 	not_timeout = WAIT_RESP_TIMEOUT;
 	do {
+		/* Keep MOSI high, the card could take other bytes for a command */
+		*data_out = 0xFF;
 		if (0 != no_os_spi_write_and_read(sd_desc->spi_desc,
 						  data_out, 1))
 			break;
@@ -158,7 +164,9 @@ static int32_t send_command(struct sd_desc *sd_desc, struct cmd_desc *cmd_desc)
 		cmd_desc_local.response_len = R1_LEN;
 		if (0 != send_command(sd_desc, &cmd_desc_local))
 			return -1;
-		if (cmd_desc_local.response[0] != R1_IDLE_STATE) {
+		/* The card is idle during initialization and ready after */
+		if (cmd_desc_local.response[0] != R1_IDLE_STATE &&
+		    cmd_desc_local.response[0] != R1_READY_STATE) {
 			DEBUG_MSG("Not the expected response for CMD55\n");
 			return -1;
 		}
@@ -193,6 +201,32 @@ static int32_t send_command(struct sd_desc *sd_desc, struct cmd_desc *cmd_desc)
 	return 0;
 }
 
+/**
+ * Read the data response token sent by the card after a block
+ * @param sd_desc	- Instance of the SD card
+ * @return 0 if the block was accepted, -1 otherwise.
+ */
+static int32_t read_data_response(struct sd_desc *sd_desc)
+{
+	uint8_t		response;
+
+	if (0 != wait_for_response(sd_desc, &response))
+		return -1;
+	switch (response & MASK_RESPONSE_TOKEN) {
+	case 0x4:
+		return 0;
+	case 0xA:
+		DEBUG_MSG("CRC error\n");
+		return -1;
+	case 0xC:
+		DEBUG_MSG("Write error\n");
+		return -1;
+	default:
+		DEBUG_MSG("Other problem\n");
+		return -1;
+	}
+}
+
 /**
  * Send one block of data to the SD card
  * @param sd_desc	- Instance of the SD card
@@ -218,22 +252,8 @@ static int32_t write_block(struct sd_desc *sd_desc, uint8_t *data,
 		return -1;
 
 	/* Read response and check if write was ok */
-	uint8_t		response;
-	if (0 != wait_for_response(sd_desc, &response))
-		return -1;
-	switch (response & MASK_RESPONSE_TOKEN) {
-	case 0x4:
-		break;
-	case 0xA:
-		DEBUG_MSG("CRC error\n");
-		return -1;
-	case 0xC:
-		DEBUG_MSG("Write error\n");
+	if (0 != read_data_response(sd_desc))
 		return -1;
-	default:
-		DEBUG_MSG("Other problem\n");
-		return -1;
-	}
 	if (0 != wait_until_not_busy(sd_desc))
 		return -1;
 
@@ -389,16 +409,16 @@ static int32_t read_multiple_blocks(struct sd_desc *sd_desc,
 }
 
 /**
- * Read data of size len from the specified address and store it in data.
- * This operation returns only when the read is complete
+ * Read data of size len from the specified address, bypassing the read-ahead
+ * cache
  * @param sd_desc	- Instance of the SD card
  * @param data		- Where data will be read
  * @param address	- Address in memory from where data will be read
  * @param len		- Length in bytes of data to be read
  * @return 0 in case of success, -1 otherwise.
  */
-int32_t sd_read(struct sd_desc *sd_desc,
-		uint8_t *data, uint64_t address, uint64_t len)
+static int32_t read_direct(struct sd_desc *sd_desc,
+			   uint8_t *data, uint64_t address, uint64_t len)
 {
 	struct cmd_desc	cmd_desc;
 
@@ -439,6 +459,74 @@ int32_t sd_read(struct sd_desc *sd_desc,
 	return 0;
 }
 
+/**
+ * Drop the blocks held by the read-ahead cache which are overwritten
+ * @param sd_desc	- Instance of the SD card
+ * @param block		- First written block
+ * @param nb_blocks	- Number of written blocks
+ */
+static void cache_invalidate(struct sd_desc *sd_desc, uint64_t block,
+			     uint64_t nb_blocks)
+{
+	if (sd_desc->cache_valid &&
+	    block < sd_desc->cache_start + sd_desc->cache_valid &&
+	    block + nb_blocks > sd_desc->cache_start)
+		sd_desc->cache_valid = 0;
+}
+
+/**
+ * Read data of size len from the specified address and store it in data.
+ * This operation returns only when the read is complete.
+ * Reads which are not larger than the read-ahead cache are served from it.
+ * On a miss, the cache is filled with the blocks following the address, so
+ * sequential reads of a few blocks become a single multiple block read.
+ * @param sd_desc	- Instance of the SD card
+ * @param data		- Where data will be read
+ * @param address	- Address in memory from where data will be read
+ * @param len		- Length in bytes of data to be read
+ * @return 0 in case of success, -1 otherwise.
+ */
+int32_t sd_read(struct sd_desc *sd_desc,
+		uint8_t *data, uint64_t address, uint64_t len)
+{
+	uint64_t	block;
+	uint64_t	nb_blocks;
+	uint64_t	last;
+
+	if (!sd_desc || !data || !len)
+		return -1;
+
+	/* The card does not accept commands during a write session */
+	if (0 != sd_stream_close(sd_desc))
+		return -1;
+
+	nb_blocks = get_nb_of_blocks(address, len);
+	if (!sd_desc->cache || nb_blocks > sd_desc->cache_blocks)
+		return read_direct(sd_desc, data, address, len);
+
+	block = address >> DATA_BLOCK_BITS;
+	if (block < sd_desc->cache_start ||
+	    block + nb_blocks > sd_desc->cache_start + sd_desc->cache_valid) {
+		last = sd_desc->memory_size >> DATA_BLOCK_BITS;
+		if (block + nb_blocks > last)
+			return -1;
+
+		sd_desc->cache_valid = 0;
+		sd_desc->cache_start = block;
+		nb_blocks = no_os_min(last - block, (uint64_t)sd_desc->cache_blocks);
+		if (0 != read_direct(sd_desc, sd_desc->cache,
+				     block << DATA_BLOCK_BITS,
+				     nb_blocks << DATA_BLOCK_BITS))
+			return -1;
+		sd_desc->cache_valid = nb_blocks;
+	}
+
+	memcpy(data, sd_desc->cache +
+	       (address - (sd_desc->cache_start << DATA_BLOCK_BITS)), len);
+
+	return 0;
+}
+
 /**
  * Write data of size len to the specified address
  * This operation returns only when the write is complete
@@ -454,12 +542,16 @@ int32_t sd_write(struct sd_desc *sd_desc, uint8_t *data, uint64_t address,
 	struct cmd_desc	cmd_desc;
 	uint8_t		first_block[DATA_BLOCK_LEN] __attribute__((aligned));
 	uint8_t		last_block[DATA_BLOCK_LEN] __attribute__((aligned));
+	uint32_t	nb_blocks;
 
 	/* Initial checks */
 	if (data == NULL || address > sd_desc->memory_size ||
 	    len > sd_desc->memory_size || address + len > sd_desc->memory_size)
 		return -1;
 
+	if (0 != sd_stream_close(sd_desc))
+		return -1;
+
 	/* Read first and last block in memory if needed to be updated with user data and then written back                                                                        */
 	/* If not writing from the beginning of a block or */
 	if ((address & MASK_ADDR_IN_BLOCK) != 0 ||
@@ -473,8 +565,25 @@ int32_t sd_write(struct sd_desc *sd_desc, uint8_t *data, uint64_t address,
 		sd_read(sd_desc, last_block, (address + len - 1) & MASK_BLOCK_NUMBER,
 			DATA_BLOCK_LEN);
 
+	/*
+	 * Pre-erase the blocks of a multiple block write, so the card does not
+	 * have to erase them one by one while data is coming in.
+	 */
+	nb_blocks = get_nb_of_blocks(address, len);
+	if (nb_blocks != 1) {
+		cmd_desc.cmd = ACMD(23);
+		cmd_desc.arg = nb_blocks & SET_WR_BLK_ERASE_COUNT_MASK;
+		cmd_desc.response_len = R1_LEN;
+		if (0 != send_command(sd_desc, &cmd_desc))
+			return -1;
+		if (cmd_desc.response[0] != R1_READY_STATE) {
+			DEBUG_MSG("Failed to pre-erase blocks\n");
+			return -1;
+		}
+	}
+
 	/* Send write command to SD */
-	cmd_desc.cmd = (get_nb_of_blocks(address, len) == 1) ? CMD(24) : CMD(25);
+	cmd_desc.cmd = (nb_blocks == 1) ? CMD(24) : CMD(25);
 	cmd_desc.arg = address >> DATA_BLOCK_BITS; //Address of first block
 	cmd_desc.response_len = R1_LEN;
 	if (0 != send_command(sd_desc, &cmd_desc))
@@ -484,13 +593,15 @@ int32_t sd_write(struct sd_desc *sd_desc, uint8_t *data, uint64_t address,
 		return -1;
 	}
 
+	cache_invalidate(sd_desc, address >> DATA_BLOCK_BITS, nb_blocks);
+
 	/* Write blocks */
 	if (0 != write_multiple_blocks(sd_desc, data, address, len,
 				       first_block, last_block))
 		return -1;
 
 	/* Send stop transmission token */
-	if (get_nb_of_blocks(address, len) != 1) {
+	if (nb_blocks != 1) {
 		sd_desc->buff[0] = STOP_TRANSMISSION_TOKEN;
 		sd_desc->buff[1] = 0xFF;
 		if (0 != no_os_spi_write_and_read(sd_desc->spi_desc, sd_desc->buff, 2))
@@ -502,6 +613,317 @@ int32_t sd_write(struct sd_desc *sd_desc, uint8_t *data, uint64_t address,
 	return 0;
 }
 
+/**
+ * Called when the DMA transfer of a streamed block is done
+ * @param ctx	- Instance of the SD card
+ */
+static void stream_dma_done(void *ctx)
+{
+	struct sd_desc *sd_desc = ctx;
+
+	sd_desc->stream_state = SD_STREAM_SENT;
+}
+
+/**
+ * Send one block of a streaming write session
+ * @param sd_desc	- Instance of the SD card
+ * @param data		- Block to be written
+ * @param async		- Return once the DMA transfer is started
+ * @return 0 in case of success, negative error code otherwise.
+ */
+static int32_t stream_send_block(struct sd_desc *sd_desc, uint8_t *data,
+				 bool async)
+{
+	struct no_os_spi_msg	*msgs = sd_desc->stream_msgs;
+	int32_t			ret;
+
+	sd_desc->stream_token = START_N_BLOCK_TOKEN;
+	sd_desc->stream_crc[0] = 0xFF;
+	sd_desc->stream_crc[1] = 0xFF;
+	memset(msgs, 0, sizeof(sd_desc->stream_msgs));
+	msgs[0].tx_buff = &sd_desc->stream_token;
+	msgs[0].bytes_number = 1;
+	msgs[1].tx_buff = data;
+	msgs[1].bytes_number = DATA_BLOCK_LEN;
+	msgs[2].tx_buff = sd_desc->stream_crc;
+	msgs[2].bytes_number = CRC_LEN;
+	msgs[2].cs_change = 1;
+
+	if (async) {
+		sd_desc->stream_state = SD_STREAM_DMA;
+		ret = no_os_spi_transfer_dma_async(sd_desc->spi_desc, msgs, 3,
+						   stream_dma_done, sd_desc);
+		if (ret)
+			sd_desc->stream_state = SD_STREAM_READY;
+
+		return ret;
+	}
+
+	if (sd_desc->spi_desc->platform_ops->transfer) {
+		ret = no_os_spi_transfer(sd_desc->spi_desc, msgs, 3);
+		if (ret)
+			return ret;
+	} else if (0 != no_os_spi_write_and_read(sd_desc->spi_desc,
+			&sd_desc->stream_token, 1) ||
+		   0 != no_os_spi_write_and_read(sd_desc->spi_desc, data,
+				   DATA_BLOCK_LEN) ||
+		   0 != no_os_spi_write_and_read(sd_desc->spi_desc,
+				   sd_desc->stream_crc, CRC_LEN)) {
+		return -EIO;
+	}
+
+	sd_desc->stream_state = SD_STREAM_SENT;
+
+	return 0;
+}
+
+/**
+ * Poll the streaming write session until it reaches a state
+ * @param sd_desc	- Instance of the SD card
+ * @param payload_only	- Only wait for the DMA transfer of the last block
+ * @return 0 in case of success, negative error code otherwise.
+ */
+static int32_t stream_wait(struct sd_desc *sd_desc, bool payload_only)
+{
+	uint32_t	not_timeout;
+	int32_t		ret;
+
+	not_timeout = WAIT_RESP_TIMEOUT * 1000 / STREAM_POLL_US;
+	while (true) {
+		if (payload_only) {
+			if (sd_desc->stream_state != SD_STREAM_DMA)
+				return 0;
+			ret = -EAGAIN;
+		} else {
+			ret = sd_stream_poll(sd_desc);
+			if (ret != -EAGAIN && ret != -EBUSY)
+				return ret;
+		}
+
+		if (!not_timeout--)
+			return -ETIMEDOUT;
+		no_os_udelay(STREAM_POLL_US);
+	}
+}
+
+/**
+ * Start a multiple block write which stays open across sd_stream_write()
+ * calls, until sd_stream_close(). Commands to the card, including reads,
+ * close the session first.
+ * @param sd_desc	- Instance of the SD card
+ * @param address	- Address of the first block, multiple of DATA_BLOCK_LEN
+ * @param nb_blocks	- Number of blocks to pre-erase, if known. 0 otherwise.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+int32_t sd_stream_open(struct sd_desc *sd_desc, uint64_t address,
+		       uint32_t nb_blocks)
+{
+	struct cmd_desc	cmd_desc;
+	int32_t		ret;
+
+	if (!sd_desc || (address & MASK_ADDR_IN_BLOCK) ||
+	    address >= sd_desc->memory_size)
+		return -EINVAL;
+
+	ret = sd_stream_close(sd_desc);
+	if (ret)
+		return ret;
+
+	if (nb_blocks) {
+		cmd_desc.cmd = ACMD(23);
+		cmd_desc.arg = nb_blocks & SET_WR_BLK_ERASE_COUNT_MASK;
+		cmd_desc.response_len = R1_LEN;
+		if (0 != send_command(sd_desc, &cmd_desc))
+			return -EIO;
+		if (cmd_desc.response[0] != R1_READY_STATE) {
+			DEBUG_MSG("Failed to pre-erase blocks\n");
+			return -EIO;
+		}
+	}
+
+	cmd_desc.cmd = CMD(25);
+	cmd_desc.arg = address >> DATA_BLOCK_BITS;
+	cmd_desc.response_len = R1_LEN;
+	if (0 != send_command(sd_desc, &cmd_desc))
+		return -EIO;
+	if (cmd_desc.response[0] != R1_READY_STATE) {
+		DEBUG_MSG("Failed to write Data command\n");
+		return -EIO;
+	}
+
+	sd_desc->stream_next = address >> DATA_BLOCK_BITS;
+	sd_desc->stream_state = SD_STREAM_READY;
+
+	return 0;
+}
+
+/**
+ * Send whole blocks in the open streaming write session. Each block is sent
+ * as soon as the card finished programming the previous one. The function
+ * returns when the last block was sent, so the card programs it while the
+ * caller prepares the next data.
+ * @param sd_desc	- Instance of the SD card
+ * @param data		- Blocks to be written
+ * @param nb_blocks	- Number of blocks
+ * @return 0 in case of success, negative error code otherwise.
+ */
+int32_t sd_stream_write(struct sd_desc *sd_desc, uint8_t *data,
+			uint32_t nb_blocks)
+{
+	uint32_t	i;
+	int32_t		ret;
+
+	if (!sd_desc || !data)
+		return -EINVAL;
+
+	if (sd_desc->stream_state == SD_STREAM_CLOSED)
+		return -EINVAL;
+
+	if (sd_desc->stream_next + nb_blocks >
+	    sd_desc->memory_size >> DATA_BLOCK_BITS)
+		return -ENOSPC;
+
+	cache_invalidate(sd_desc, sd_desc->stream_next, nb_blocks);
+
+	for (i = 0; i < nb_blocks; i++) {
+		ret = stream_wait(sd_desc, false);
+		if (ret)
+			return ret;
+
+		ret = stream_send_block(sd_desc, data + i * DATA_BLOCK_LEN,
+					sd_desc->stream_dma);
+		if (ret == -ENOSYS && sd_desc->stream_dma) {
+			/* The platform has no DMA support, stop trying */
+			sd_desc->stream_dma = false;
+			ret = stream_send_block(sd_desc, data + i * DATA_BLOCK_LEN,
+						false);
+		}
+		if (ret)
+			return ret;
+
+		ret = stream_wait(sd_desc, true);
+		if (ret)
+			return ret;
+
+		sd_desc->stream_next++;
+	}
+
+	return 0;
+}
+
+/**
+ * Start sending one block in the open streaming write session using DMA and
+ * return immediately. The data must not be changed until sd_stream_poll()
+ * stops returning -EAGAIN.
+ * @param sd_desc	- Instance of the SD card
+ * @param data		- Block to be written
+ * @return 0 in case of success, -EBUSY if the card did not accept the
+ * previous block yet, negative error code otherwise.
+ */
+int32_t sd_stream_write_async(struct sd_desc *sd_desc, uint8_t *data)
+{
+	int32_t		ret;
+
+	if (!sd_desc || !data || sd_desc->stream_state == SD_STREAM_CLOSED)
+		return -EINVAL;
+
+	if (sd_desc->stream_next >= sd_desc->memory_size >> DATA_BLOCK_BITS)
+		return -ENOSPC;
+
+	ret = sd_stream_poll(sd_desc);
+	if (ret == -EAGAIN)
+		return -EBUSY;
+	if (ret)
+		return ret;
+
+	cache_invalidate(sd_desc, sd_desc->stream_next, 1);
+	ret = stream_send_block(sd_desc, data, true);
+	if (ret)
+		return ret;
+
+	sd_desc->stream_next++;
+
+	return 0;
+}
+
+/**
+ * Advance the streaming write session without blocking. Reads the data
+ * response of the last block once it was sent and checks if the card
+ * finished programming it, in which case stream_ready_cb is called.
+ * @param sd_desc	- Instance of the SD card
+ * @return 0 if the card accepts the next block, -EAGAIN while a block is sent
+ * using DMA, -EBUSY while the card programs the last block, negative error
+ * code otherwise.
+ */
+int32_t sd_stream_poll(struct sd_desc *sd_desc)
+{
+	uint8_t		data;
+
+	if (!sd_desc)
+		return -EINVAL;
+
+	switch (sd_desc->stream_state) {
+	case SD_STREAM_CLOSED:
+		return -EINVAL;
+	case SD_STREAM_READY:
+		return 0;
+	case SD_STREAM_DMA:
+		return -EAGAIN;
+	case SD_STREAM_SENT:
+		if (0 != read_data_response(sd_desc)) {
+			sd_desc->stream_state = SD_STREAM_READY;
+			return -EIO;
+		}
+		sd_desc->stream_state = SD_STREAM_BUSY;
+	/* fallthrough */
+	case SD_STREAM_BUSY:
+		data = 0xFF;
+		if (0 != no_os_spi_write_and_read(sd_desc->spi_desc, &data, 1))
+			return -EIO;
+		if (data == 0x00)
+			return -EBUSY;
+
+		sd_desc->stream_state = SD_STREAM_READY;
+		if (sd_desc->stream_ready_cb)
+			sd_desc->stream_ready_cb(sd_desc->stream_ready_ctx);
+
+		return 0;
+	default:
+		return -EINVAL;
+	}
+}
+
+/**
+ * Wait for the card to program the last block and end the streaming write
+ * session. Does nothing if no session is open.
+ * @param sd_desc	- Instance of the SD card
+ * @return 0 in case of success, negative error code otherwise.
+ */
+int32_t sd_stream_close(struct sd_desc *sd_desc)
+{
+	int32_t		ret;
+
+	if (!sd_desc)
+		return -EINVAL;
+
+	if (sd_desc->stream_state == SD_STREAM_CLOSED)
+		return 0;
+
+	ret = stream_wait(sd_desc, false);
+	sd_desc->stream_state = SD_STREAM_CLOSED;
+	if (ret)
+		return ret;
+
+	sd_desc->buff[0] = STOP_TRANSMISSION_TOKEN;
+	sd_desc->buff[1] = 0xFF;
+	if (0 != no_os_spi_write_and_read(sd_desc->spi_desc, sd_desc->buff, 2))
+		return -EIO;
+	if (0 != wait_until_not_busy(sd_desc))
+		return -EIO;
+
+	return 0;
+}
+
 /**
  * Initialize an instance of SD card and stores it to the parameter desc
  * @param sd_desc	- Pointer where to store the instance of the SD
@@ -522,6 +944,9 @@ int32_t sd_init(struct sd_desc **sd_desc, const struct sd_init_param *param)
 	if (!local_desc)
 		return -1;
 	local_desc->spi_desc = param->spi_desc;
+	local_desc->stream_dma = param->stream_dma;
+	local_desc->stream_ready_cb = param->stream_ready_cb;
+	local_desc->stream_ready_ctx = param->stream_ready_ctx;
 
 	/* Synchronize SD card frequency: Send 10 dummy bytes*/
 	memset(local_desc->buff, 0xFF, 10);
@@ -606,6 +1031,14 @@ int32_t sd_init(struct sd_desc **sd_desc, const struct sd_init_param *param)
 	local_desc->memory_size = ((uint64_t)c_size + 1) *
 				  ((uint64_t)DATA_BLOCK_LEN << 10u);
 
+	if (param->read_ahead_blocks) {
+		local_desc->cache = no_os_calloc(param->read_ahead_blocks,
+						 DATA_BLOCK_LEN);
+		if (!local_desc->cache)
+			goto failure;
+		local_desc->cache_blocks = param->read_ahead_blocks;
+	}
+
 	*sd_desc = local_desc;
 
 	return 0;
@@ -624,6 +1057,8 @@ int32_t sd_remove(struct sd_desc *desc)
 	if (desc == NULL)
 		return -1;
 
+	sd_stream_close(desc);
+	no_os_free(desc->cache);
 	no_os_free(desc);
 	return 0;
 }
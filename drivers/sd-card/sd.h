@@ -67,6 +67,37 @@
 struct sd_init_param {
 	/** Descriptor of an initialized SPI channel */
 	struct no_os_spi_desc *spi_desc;
+	/**
+	 * Number of blocks read at once on a read miss and kept for the
+	 * following reads. 0 disables the read-ahead cache.
+	 */
+	uint32_t read_ahead_blocks;
+	/** Send the blocks of a streaming write session using SPI DMA */
+	bool stream_dma;
+	/**
+	 * Called from sd_stream_poll() when the card finished programming a
+	 * block of a streaming write session. Optional.
+	 */
+	void (*stream_ready_cb)(void *ctx);
+	/** Parameter of stream_ready_cb */
+	void *stream_ready_ctx;
+};
+
+/**
+ * @enum sd_stream_state
+ * @brief State of a streaming write session
+ */
+enum sd_stream_state {
+	/** No write command is open */
+	SD_STREAM_CLOSED,
+	/** The card accepts the next block */
+	SD_STREAM_READY,
+	/** A block is being sent using DMA */
+	SD_STREAM_DMA,
+	/** A block was sent, its data response was not read yet */
+	SD_STREAM_SENT,
+	/** The card is programming the last block */
+	SD_STREAM_BUSY,
 };
 
 /**
@@ -82,6 +113,29 @@ struct sd_desc {
 	uint8_t		high_capacity;
 	/** Buffer used for the driver implementation */
 	uint8_t		buff[18];
+	/** Read-ahead cache, NULL if disabled */
+	uint8_t		*cache;
+	/** Size of the read-ahead cache in blocks */
+	uint32_t	cache_blocks;
+	/** First block held by the read-ahead cache */
+	uint64_t	cache_start;
+	/** Number of valid blocks in the read-ahead cache */
+	uint32_t	cache_valid;
+	/** State of the streaming write session */
+	volatile enum sd_stream_state	stream_state;
+	/** Block written by the next sd_stream_write() */
+	uint64_t	stream_next;
+	/** Send the blocks of a streaming write session using SPI DMA */
+	bool		stream_dma;
+	/** Called when the card finished programming a streamed block */
+	void		(*stream_ready_cb)(void *ctx);
+	/** Parameter of stream_ready_cb */
+	void		*stream_ready_ctx;
+	/** Start token and CRC of the streamed block, sent from stream_msgs */
+	uint8_t		stream_token;
+	uint8_t		stream_crc[2];
+	/** Messages sending a block of a streaming write session */
+	struct no_os_spi_msg	stream_msgs[3];
 };
 
 /**
@@ -111,5 +165,21 @@ int32_t sd_write(struct sd_desc *desc,
 		 uint64_t address,
 		 uint64_t len);
 
+/* Start a multiple block write left open across sd_stream_write() calls */
+int32_t sd_stream_open(struct sd_desc *desc,
+		       uint64_t address,
+		       uint32_t nb_blocks);
+/* Send whole blocks, return before the card finished programming the last */
+int32_t sd_stream_write(struct sd_desc *desc,
+			uint8_t *data,
+			uint32_t nb_blocks);
+/* Start sending one block using DMA and return immediately */
+int32_t sd_stream_write_async(struct sd_desc *desc,
+			      uint8_t *data);
+/* Advance the session, -EAGAIN or -EBUSY until the next block is accepted */
+int32_t sd_stream_poll(struct sd_desc *desc);
+/* Wait for the last block and end the multiple block write */
+int32_t sd_stream_close(struct sd_desc *desc);
+
 #endif /* __SD_H__ */
 
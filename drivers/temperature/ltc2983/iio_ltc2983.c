@@ -37,14 +37,17 @@
 #include "no_os_util.h"
 #include "no_os_alloc.h"
 #include "iio.h"
+#include "no_os_print_log.h"
 
-#define LTC2983_CHAN(_type, _index) ({ \
+#define LTC2983_CHAN(_type, _index, _si) ({ \
 	struct iio_channel __chan = { \
 		.ch_type = _type, \
 		.indexed = true, \
 		.channel = _index, \
 		.attributes = ltc2983_iio_attrs, \
 		.address = _index, \
+		.scan_index = _si, \
+		.scan_type = &ltc2983_iio_scan_type, \
 	}; \
 	__chan; \
 })
@@ -59,6 +62,17 @@ static int ltc2983_iio_reg_read(struct ltc2983_iio_desc *dev, uint32_t reg,
 				uint32_t *readval);
 static int ltc2983_iio_reg_write(struct ltc2983_iio_desc *dev, uint32_t reg,
 				 uint32_t writeval);
+static int32_t ltc2983_iio_pre_enable(void *dev, uint32_t mask);
+static int32_t ltc2983_iio_post_disable(void *dev);
+static int32_t ltc2983_iio_trigger_handler(struct iio_device_data *dev_data);
+
+static struct scan_type ltc2983_iio_scan_type = {
+	.sign = 's',
+	.realbits = 24,
+	.storagebits = 32,
+	.shift = 0,
+	.is_big_endian = false
+};
 
 static struct iio_attribute ltc2983_iio_attrs[] = {
 	{
@@ -77,6 +91,9 @@ static struct iio_attribute ltc2983_iio_attrs[] = {
 };
 
 static struct iio_device ltc2983_iio_dev = {
+	.pre_enable = ltc2983_iio_pre_enable,
+	.post_disable = ltc2983_iio_post_disable,
+	.trigger_handler = ltc2983_iio_trigger_handler,
 	.debug_reg_read = (int32_t (*)())ltc2983_iio_reg_read,
 	.debug_reg_write = (int32_t (*)())ltc2983_iio_reg_write,
 };
@@ -110,6 +127,7 @@ int ltc2983_iio_init(struct ltc2983_iio_desc **iio_dev,
 		goto free_desc;
 
 	descriptor->iio_dev = &ltc2983_iio_dev;
+	descriptor->scan_period_ms = init_param->scan_period_ms;
 
 	ltc2983_channels = no_os_calloc(descriptor->ltc2983_dev->num_channels,
 					sizeof(*ltc2983_channels));
@@ -128,7 +146,9 @@ int ltc2983_iio_init(struct ltc2983_iio_desc **iio_dev,
 			else
 				ch_type = IIO_TEMP;
 
-			ltc2983_channels[chan++] = LTC2983_CHAN(ch_type, i + 1);
+			ltc2983_channels[chan] = LTC2983_CHAN(ch_type, i + 1,
+							      chan);
+			chan++;
 		}
 	}
 
@@ -244,3 +264,58 @@ static int ltc2983_iio_reg_write(struct ltc2983_iio_desc *dev, uint32_t reg,
 	return ltc2983_reg_write(dev->ltc2983_dev, (uint16_t)reg,
 				 (uint8_t)writeval);
 }
+
+/**
+ * @brief Arm the scan scheduler with the channels of the buffer.
+ * @param dev - The iio device structure.
+ * @param mask - Active IIO channels mask.
+ * @return 0 in case of success, errno errors otherwise
+ */
+static int32_t ltc2983_iio_pre_enable(void *dev, uint32_t mask)
+{
+	struct ltc2983_iio_desc *ltc2983_iio = dev;
+	uint32_t chan_mask = 0;
+	uint32_t i;
+
+	/* IIO channel i converts the device channel in its address field */
+	for (i = 0; i < ltc2983_iio->iio_dev->num_ch; i++)
+		if (mask & NO_OS_BIT(i))
+			chan_mask |= NO_OS_BIT(ltc2983_iio->iio_dev->channels[i].address - 1);
+
+	return ltc2983_scan_schedule(ltc2983_iio->ltc2983_dev, chan_mask,
+				     ltc2983_iio->scan_period_ms);
+}
+
+/**
+ * @brief Stop the scan scheduler, waiting for the scan in progress.
+ * @param dev - The iio device structure.
+ * @return 0 in case of success, errno errors otherwise
+ */
+static int32_t ltc2983_iio_post_disable(void *dev)
+{
+	struct ltc2983_iio_desc *ltc2983_iio = dev;
+
+	return ltc2983_scan_cancel(ltc2983_iio->ltc2983_dev);
+}
+
+/**
+ * @brief Run the scan scheduler and push the results of a finished scan.
+ * @param dev_data - IIO device data.
+ * @return 0 in case of success, errno errors otherwise
+ */
+static int32_t ltc2983_iio_trigger_handler(struct iio_device_data *dev_data)
+{
+	struct ltc2983_iio_desc *ltc2983_iio = dev_data->dev;
+	struct ltc2983_scan_result res;
+	int ret;
+
+	ret = ltc2983_scan_poll(ltc2983_iio->ltc2983_dev, &res);
+	if (ret <= 0)
+		return ret;
+
+	if (res.hard_faults)
+		pr_warning("Hard fault on channels 0x%05lx\r\n",
+			   (unsigned long)res.hard_faults);
+
+	return iio_buffer_push_scan(dev_data->buffer, res.val);
+}
@@ -39,12 +39,21 @@
 struct ltc2983_iio_desc {
 	struct ltc2983_desc *ltc2983_dev;
 	struct iio_device *iio_dev;
+	/* Minimum time between buffered scans in ms, 0 for back to back */
+	uint32_t scan_period_ms;
 };
 
 struct ltc2983_iio_desc_init_param {
 	struct ltc2983_init_param *ltc2983_desc_init_param;
+	/* Minimum time between buffered scans in ms, 0 for back to back.
+	 * Periodic scans need a timer trigger, the INTERRUPT pin only fires
+	 * at the end of a scan. */
+	uint32_t scan_period_ms;
 };
 
+/* INTERRUPT pin or timer trigger running the scan scheduler */
+extern struct iio_trigger ltc2983_iio_trig_desc;
+
 int ltc2983_iio_init(struct ltc2983_iio_desc **,
 		     struct ltc2983_iio_desc_init_param *);
 int ltc2983_iio_remove(struct ltc2983_iio_desc *);
@@ -32,6 +32,7 @@
 *******************************************************************************/
 
 #include <errno.h>
+#include <string.h>
 #include "ltc2983.h"
 #include "no_os_alloc.h"
 #include "no_os_delay.h"
@@ -99,13 +100,23 @@ int ltc2983_init(struct ltc2983_desc **device,
 	if (ret)
 		goto gpio_err;
 
-	ret = ltc2983_setup(descriptor);
+	ret = no_os_gpio_get_optional(&descriptor->gpio_intr,
+				      init_param->gpio_intr);
 	if (ret)
 		goto gpio_err;
+	ret = no_os_gpio_direction_input(descriptor->gpio_intr);
+	if (ret)
+		goto intr_err;
+
+	ret = ltc2983_setup(descriptor);
+	if (ret)
+		goto intr_err;
 
 	*device = descriptor;
 	return 0;
 
+intr_err:
+	no_os_gpio_remove(descriptor->gpio_intr);
 gpio_err:
 	no_os_gpio_remove(descriptor->gpio_rstn);
 spi_err:
@@ -130,6 +141,10 @@ int ltc2983_remove(struct ltc2983_desc *device)
 	if (ret)
 		return -EINVAL;
 
+	ret = no_os_gpio_remove(device->gpio_intr);
+	if (ret)
+		return -EINVAL;
+
 	ret = no_os_spi_remove(device->comm_desc);
 	if (ret)
 		return -EINVAL;
@@ -388,6 +403,252 @@ int ltc2983_chan_read_raw(struct ltc2983_desc *device, const int chan,
 	return 0;
 }
 
+/**
+ * @brief Start a conversion of all the channels of a mask. The multiple
+ *	  channel mask is written in one burst, then a single start command
+ *	  converts the channels in ascending order.
+ * @param device - LTC2983 descriptor
+ * @param chan_mask - channels to convert, bit n for channel n + 1
+ * @return 0 in case of success, errno errors otherwise
+ */
+int ltc2983_scan_start(struct ltc2983_desc *device, uint32_t chan_mask)
+{
+	uint8_t raw_array[7];
+	int ret;
+
+	if (!chan_mask || chan_mask & ~NO_OS_GENMASK(device->max_channels_nr - 1,
+			0))
+		return -EINVAL;
+
+	raw_array[0] = LTC2983_SPI_WRITE_BYTE;
+	no_os_put_unaligned_be16(LTC2983_MULT_CHANNEL_MASK_REG, raw_array + 1);
+	no_os_put_unaligned_be32(chan_mask, raw_array + 3);
+	ret = no_os_spi_write_and_read(device->comm_desc, raw_array,
+				       NO_OS_ARRAY_SIZE(raw_array));
+	if (ret)
+		return ret;
+
+	/* channel 0 selects the multiple channel mask */
+	ret = ltc2983_reg_write(device, LTC2983_STATUS_REG,
+				LTC2983_STATUS_START(true));
+	if (ret)
+		return ret;
+
+	device->scan_mask = chan_mask;
+	device->scan_busy = true;
+
+	return 0;
+}
+
+/**
+ * @brief Check if the started conversions are finished, from the INTERRUPT
+ *	  pin when available, from the status register otherwise.
+ * @param device - LTC2983 descriptor
+ * @param done - true if the conversions are finished
+ * @return 0 in case of success, errno errors otherwise
+ */
+int ltc2983_scan_done(struct ltc2983_desc *device, bool *done)
+{
+	uint8_t val;
+	int ret;
+
+	if (device->gpio_intr) {
+		ret = no_os_gpio_get_value(device->gpio_intr, &val);
+		if (ret)
+			return ret;
+
+		*done = val == NO_OS_GPIO_HIGH;
+
+		return 0;
+	}
+
+	ret = ltc2983_reg_read(device, LTC2983_STATUS_REG, &val);
+	if (ret)
+		return ret;
+
+	*done = LTC2983_STATUS_UP(val) == LTC2983_STATUS_DONE;
+
+	return 0;
+}
+
+/**
+ * @brief Read the results of the channels of the last scan in one burst, from
+ *	  the first to the last channel of the mask, and decode them. Faults
+ *	  are reported per channel instead of failing the whole scan.
+ * @param device - LTC2983 descriptor
+ * @param res - decoded results
+ * @return 0 in case of success, errno errors otherwise
+ */
+int ltc2983_scan_read(struct ltc2983_desc *device,
+		      struct ltc2983_scan_result *res)
+{
+	uint8_t raw_array[3 + 4 * LTC2983_MAX_CHANNELS_NR];
+	uint32_t hard_mask, soft_mask;
+	uint32_t mask = device->scan_mask;
+	uint32_t first, last;
+	uint32_t word;
+	uint8_t *p;
+	uint32_t i;
+	int ret;
+
+	if (!mask)
+		return -EINVAL;
+
+	first = no_os_find_first_set_bit(mask);
+	last = no_os_find_last_set_bit(mask);
+
+	raw_array[0] = LTC2983_SPI_READ_BYTE;
+	no_os_put_unaligned_be16(LTC2983_CHAN_RES_ADDR(first + 1),
+				 raw_array + 1);
+	memset(raw_array + 3, 0, 4 * (last - first + 1));
+	ret = no_os_spi_write_and_read(device->comm_desc, raw_array,
+				       3 + 4 * (last - first + 1));
+	if (ret)
+		return ret;
+
+	res->nb_val = 0;
+	res->hard_faults = 0;
+	res->soft_faults = 0;
+	for (i = first, p = raw_array + 3; i <= last; i++, p += 4) {
+		if (!(mask & NO_OS_BIT(i)))
+			continue;
+
+		word = no_os_get_unaligned_be32(p);
+		if (device->sensors[i] &&
+		    device->sensors[i]->type <= LTC2983_THERMOCOUPLE_CUSTOM) {
+			hard_mask = LTC2983_THERMOCOUPLE_HARD_FAULT_MASK;
+			soft_mask = LTC2983_THERMOCOUPLE_SOFT_FAULT_MASK;
+		} else {
+			hard_mask = LTC2983_COMMON_HARD_FAULT_MASK;
+			soft_mask = LTC2983_COMMON_SOFT_FAULT_MASK;
+		}
+
+		if (!(word & LTC2983_RES_VALID_MASK) || (word & hard_mask))
+			res->hard_faults |= NO_OS_BIT(i);
+		else if (word & soft_mask)
+			res->soft_faults |= NO_OS_BIT(i);
+
+		res->val[res->nb_val++] = no_os_sign_extend32(word & LTC2983_DATA_MASK,
+					  LTC2983_DATA_SIGN_BIT);
+	}
+
+	device->scan_busy = false;
+
+	return 0;
+}
+
+/**
+ * @brief Arm the periodic scan scheduler and start the first scan, so that
+ *	  the INTERRUPT pin signals its end.
+ * @param device - LTC2983 descriptor
+ * @param chan_mask - channels to convert, bit n for channel n + 1
+ * @param period_ms - minimum time between scan starts, 0 for back to back
+ * @return 0 in case of success, errno errors otherwise
+ */
+int ltc2983_scan_schedule(struct ltc2983_desc *device, uint32_t chan_mask,
+			  uint32_t period_ms)
+{
+	struct no_os_time now;
+	int ret;
+
+	if (device->scan_busy)
+		return -EBUSY;
+
+	ret = ltc2983_scan_start(device, chan_mask);
+	if (ret)
+		return ret;
+
+	now = no_os_get_time();
+	device->scan_period_ms = period_ms;
+	device->scan_next_ms = now.s * 1000 + now.us / 1000 + period_ms;
+
+	return 0;
+}
+
+/**
+ * @brief Stop the periodic scan scheduler. The device has no abort command,
+ *	  so a scan in progress is waited for, for at most
+ *	  LTC2983_SCAN_TIMEOUT_MS, before the device accepts new commands.
+ * @param device - LTC2983 descriptor
+ * @return 0 in case of success, errno errors otherwise
+ */
+int ltc2983_scan_cancel(struct ltc2983_desc *device)
+{
+	uint32_t timeout = LTC2983_SCAN_TIMEOUT_MS / 10;
+	bool done;
+	int ret;
+
+	device->scan_mask = 0;
+
+	while (device->scan_busy) {
+		ret = ltc2983_scan_done(device, &done);
+		if (ret)
+			return ret;
+
+		if (done) {
+			device->scan_busy = false;
+			break;
+		}
+
+		if (!--timeout)
+			return -ETIMEDOUT;
+
+		no_os_mdelay(10);
+	}
+
+	return 0;
+}
+
+/**
+ * @brief Run the periodic scan scheduler: read the results of a finished scan
+ *	  and start the next one when it is due. To be called periodically, or
+ *	  from the INTERRUPT pin rising edge for back to back scans.
+ * @param device - LTC2983 descriptor
+ * @param res - decoded results, valid when 1 is returned
+ * @return 1 if a scan was read, 0 if not, errno errors otherwise
+ */
+int ltc2983_scan_poll(struct ltc2983_desc *device,
+		      struct ltc2983_scan_result *res)
+{
+	struct no_os_time now;
+	uint32_t now_ms;
+	bool done;
+	int read = 0;
+	int ret;
+
+	if (!device->scan_mask)
+		return 0;
+
+	if (device->scan_busy) {
+		ret = ltc2983_scan_done(device, &done);
+		if (ret)
+			return ret;
+		if (!done)
+			return 0;
+
+		ret = ltc2983_scan_read(device, res);
+		if (ret)
+			return ret;
+		read = 1;
+	}
+
+	now = no_os_get_time();
+	now_ms = now.s * 1000 + now.us / 1000;
+	if ((int32_t)(now_ms - device->scan_next_ms) < 0)
+		return read;
+
+	ret = ltc2983_scan_start(device, device->scan_mask);
+	if (ret)
+		return ret;
+
+	/* Skip the missed periods instead of starting scans in a burst */
+	device->scan_next_ms += device->scan_period_ms;
+	if ((int32_t)(now_ms - device->scan_next_ms) >= 0)
+		device->scan_next_ms = now_ms + device->scan_period_ms;
+
+	return read;
+}
+
 /**
  * @brief Set scale of raw channel data / temperature
  * @param device - LTC2983 descriptor
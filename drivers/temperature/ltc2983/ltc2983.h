@@ -45,6 +45,7 @@
 #define LTC2983_EEPROM_READ_STATUS_REG		0x00D0
 #define LTC2983_GLOBAL_CONFIG_REG 		0x00F0
 #define LTC2986_EEPROM_STATUS_REG		0x00F9
+#define LTC2983_MULT_CHANNEL_MASK_REG		0x00F4
 #define LTC2983_MUX_CONFIG_REG 			0x00FF
 #define LTC2983_CHAN_ASSIGN_START_REG 	0x0200
 #define LTC2983_CUST_SENS_TBL_START_REG 0x0250
@@ -77,12 +78,20 @@
 #define	LTC2983_STATUS_UP_MASK	NO_OS_GENMASK(7, 6)
 #define	LTC2983_STATUS_UP(reg)	no_os_field_get(LTC2983_STATUS_UP_MASK, reg)
 
+/* Conversion finished: start bit (7) is 0 and done bit (6) is 1 */
+#define LTC2983_STATUS_DONE		1
+
 #define	LTC2983_STATUS_CHAN_SEL_MASK	NO_OS_GENMASK(4, 0)
 #define	LTC2983_STATUS_CHAN_SEL(x) \
 			no_os_field_prep(LTC2983_STATUS_CHAN_SEL_MASK, x)
 
 #define LTC2983_NOTCH_FREQ_MASK	NO_OS_GENMASK(1, 0)
 
+#define LTC2983_MAX_CHANNELS_NR		20
+
+/* Longest multiple channel conversion: about 167 ms per channel, with margin */
+#define LTC2983_SCAN_TIMEOUT_MS		(LTC2983_MAX_CHANNELS_NR * 250)
+
 #define LTC2983_RES_VALID_MASK		NO_OS_BIT(24)
 #define LTC2983_DATA_SIGN_BIT		23
 #define LTC2983_DATA_MASK		NO_OS_GENMASK(LTC2983_DATA_SIGN_BIT, 0)
@@ -222,6 +231,9 @@ struct ltc2983_init_param {
 	struct no_os_spi_init_param spi_init;
 	/** Reset GPIO configuration */
 	struct no_os_gpio_init_param gpio_rstn;
+	/** INTERRUPT GPIO configuration. Optional, the status register is polled
+	 *  when not provided */
+	struct no_os_gpio_init_param *gpio_intr;
 	/** MUX configuration delay in us */
 	uint32_t mux_delay_config_us;
 	/** Notch frequency of the digital filter */
@@ -242,6 +254,8 @@ struct ltc2983_desc {
 	struct no_os_spi_desc *comm_desc;
 	/** Reset GPIO descriptor */
 	struct no_os_gpio_desc *gpio_rstn;
+	/** INTERRUPT GPIO descriptor */
+	struct no_os_gpio_desc *gpio_intr;
 	/** MUX configuration delay in us */
 	uint32_t mux_delay_config_us;
 	/** Notch frequency of the digital filter */
@@ -254,6 +268,29 @@ struct ltc2983_desc {
 	uint16_t custom_addr_ptr;
 	/** max number of channels */
 	uint8_t max_channels_nr;
+	/** Channels converted by a scan, bit n for channel n + 1 */
+	uint32_t scan_mask;
+	/** Minimum time between scan starts in ms, 0 for back to back scans */
+	uint32_t scan_period_ms;
+	/** Time of the next scheduled scan start, in ms */
+	uint32_t scan_next_ms;
+	/** Set while a scan is converting */
+	bool scan_busy;
+};
+
+/**
+ * @brief Results of a multiple channel conversion
+ */
+struct ltc2983_scan_result {
+	/** Sign extended results of the scanned channels, in channel order */
+	int32_t val[LTC2983_MAX_CHANNELS_NR];
+	/** Number of results */
+	uint8_t nb_val;
+	/** Channels with an invalid result or a hard fault, bit n for
+	 *  channel n + 1 */
+	uint32_t hard_faults;
+	/** Channels with a soft fault, bit n for channel n + 1 */
+	uint32_t soft_faults;
 };
 
 /**
@@ -448,6 +485,24 @@ int ltc2983_adc_assign_chan(struct ltc2983_desc *,
 int ltc2983_temp_assign_chan(struct ltc2983_desc *,
 			     const struct ltc2983_sensor *);
 
+/** Start a conversion of all the channels of a mask */
+int ltc2983_scan_start(struct ltc2983_desc *, uint32_t);
+
+/** Check if the started conversions are finished */
+int ltc2983_scan_done(struct ltc2983_desc *, bool *);
+
+/** Read and decode the results of a scan */
+int ltc2983_scan_read(struct ltc2983_desc *, struct ltc2983_scan_result *);
+
+/** Arm the periodic scan scheduler */
+int ltc2983_scan_schedule(struct ltc2983_desc *, uint32_t, uint32_t);
+
+/** Stop the periodic scan scheduler */
+int ltc2983_scan_cancel(struct ltc2983_desc *);
+
+/** Run the periodic scan scheduler */
+int ltc2983_scan_poll(struct ltc2983_desc *, struct ltc2983_scan_result *);
+
 /** Fault handling of thermocouple sensors */
 int ltc2983_thermocouple_fault_handler(const uint32_t);
 
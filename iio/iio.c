@@ -43,7 +43,9 @@
 #include "no_os_error.h"
 #include "no_os_alloc.h"
 #include "no_os_circular_buffer.h"
+#include "no_os_timer.h"
 #include <inttypes.h>
+#include <stddef.h>
 #include <stdio.h>
 #include <string.h>
 
@@ -62,6 +64,8 @@
 #define MAX_SOCKET_TO_HANDLE	10
 #define REG_ACCESS_ATTRIBUTE	"direct_reg_access"
 #define IIOD_CONN_BUFFER_SIZE	0x1000
+/* Matches the software FIFO of UARTs with asynchronous_rx */
+#define IIO_UART_RX_SIZE	256
 #define NO_TRIGGER				(uint32_t)-1
 
 #define NO_OS_STRINGIFY(x) #x
@@ -113,6 +117,7 @@ static const char * const iio_chan_type_string[] = {
 	[IIO_DELTA_VELOCITY] = "deltavelocity",
 	[IIO_WEIGHT] = "weight",
 	[IIO_POWER] = "power",
+	[IIO_TIMESTAMP] = "timestamp",
 };
 
 static const char * const iio_modifier_names[] = {
@@ -125,6 +130,14 @@ static const char * const iio_modifier_names[] = {
 	[IIO_MOD_ROLL] = "roll",
 };
 
+struct scan_type iio_timestamp_scan_type = {
+	.sign = 's',
+	.realbits = 64,
+	.storagebits = 64,
+	.shift = 0,
+	.is_big_endian = false
+};
+
 /* Parameters used in show and store functions */
 struct attr_fun_params {
 	void			*dev_instance;
@@ -170,6 +183,10 @@ struct iio_dev_priv {
 	struct iio_buffer_priv buffer;
 	/* Set to -1 when no trigger is set*/
 	uint32_t		trig_idx;
+	/* Deferred trigger events handled, compared to iio_trig_priv.events */
+	uint32_t		trig_events_handled;
+	/* Last trigger handler error, reported by the next buffer read */
+	int			trig_err;
 };
 
 /**
@@ -188,6 +205,12 @@ struct iio_trig_priv {
 	struct iio_trigger *descriptor;
 	/** Set to true when the triggering condition is met */
 	bool	triggered;
+	/** Time of the last firing, in ns from the timestamp timer */
+	volatile uint64_t timestamp;
+	/** Deferred trigger events fired. Only incremented by
+	 *  iio_process_trigger_type(), every device linked to the trigger keeps
+	 *  its own read index, so no locking is needed */
+	volatile uint32_t events;
 };
 
 struct iio_desc {
@@ -202,7 +225,12 @@ struct iio_desc {
 	uint32_t		nb_devs;
 	struct iio_trig_priv	*trigs;
 	uint32_t		nb_trigs;
+	struct no_os_timer_desc	*timestamp_timer;
 	struct no_os_uart_desc	*uart_desc;
+	/* Bytes received from an asynchronous UART, not yet parsed by iiod */
+	uint8_t			uart_rx[IIO_UART_RX_SIZE];
+	uint32_t		uart_rx_idx;
+	uint32_t		uart_rx_len;
 	int (*recv)(void *conn, uint8_t *buf, uint32_t len);
 	int (*send)(void *conn, uint8_t *buf, uint32_t len);
 	/* FIFO for socket descriptors */
@@ -254,6 +282,65 @@ static int iio_send(struct iiod_ctx *ctx, uint8_t *buf, uint32_t len)
 	return desc->send(ctx->conn, buf, len);
 }
 
+/**
+ * @brief Receive from the UART. When the UART receives in the background
+ * (asynchronous_rx), all the available bytes are fetched at once, so that the
+ * byte-wise command line parsing of iiod does not access the UART per byte.
+ * @param desc - IIO descriptor.
+ * @param buf - Destination buffer.
+ * @param len - Maximum number of bytes to receive.
+ * @return Number of received bytes, -EAGAIN if there are none, negative error
+ * code otherwise.
+ */
+static int iio_uart_recv(struct iio_desc *desc, uint8_t *buf, uint32_t len)
+{
+	int32_t ret;
+
+	if (!desc->uart_desc->rx_fifo)
+		return no_os_uart_read(desc->uart_desc, buf, len);
+
+	if (desc->uart_rx_idx == desc->uart_rx_len) {
+		desc->uart_rx_idx = 0;
+		desc->uart_rx_len = 0;
+
+		/* Payloads go straight to their destination */
+		if (len >= sizeof(desc->uart_rx))
+			return no_os_uart_read(desc->uart_desc, buf, len);
+
+		ret = no_os_uart_read(desc->uart_desc, desc->uart_rx,
+				      sizeof(desc->uart_rx));
+		if (ret <= 0)
+			return ret ? ret : -EAGAIN;
+
+		desc->uart_rx_len = ret;
+	}
+
+	len = no_os_min(len, desc->uart_rx_len - desc->uart_rx_idx);
+	memcpy(buf, desc->uart_rx + desc->uart_rx_idx, len);
+	desc->uart_rx_idx += len;
+
+	return len;
+}
+
+/**
+ * @brief Send to the UART.
+ * @param desc - IIO descriptor.
+ * @param buf - Data to be sent.
+ * @param len - Number of bytes to send.
+ * @return len in case of success, negative error code otherwise.
+ */
+static int iio_uart_send(struct iio_desc *desc, uint8_t *buf, uint32_t len)
+{
+	int32_t ret;
+
+	/* Not all platforms return the number of written bytes */
+	ret = no_os_uart_write(desc->uart_desc, buf, len);
+	if (NO_OS_IS_ERR_VALUE(ret))
+		return ret;
+
+	return len;
+}
+
 static inline void _print_ch_id(char *buff, struct iio_channel *ch)
 {
 	if (ch->modified) {
@@ -467,6 +554,9 @@ static int iio_rd_wr_attribute(struct attr_fun_params *params,
 {
 	int16_t i = 0;
 
+	if (!attributes)
+		return -ENOENT;
+
 	/* Search attribute */
 	while (attributes[i].name) {
 		if (!strcmp(attr_name, attributes[i].name))
@@ -493,6 +583,39 @@ static int iio_rd_wr_attribute(struct attr_fun_params *params,
 	}
 }
 
+/**
+ * @brief Show one of the buffer counters maintained by the IIO core.
+ * @param device - IIO buffer.
+ * @param buf - Where value is stored.
+ * @param len - Maximum length of value to be stored in buf.
+ * @param channel - Unused.
+ * @param priv - Offset of the counter in struct iio_buffer_stats.
+ * @return Length of chars written in buf.
+ */
+static int iio_buffer_stats_show(void *device, char *buf, uint32_t len,
+				 const struct iio_ch_info *channel,
+				 intptr_t priv)
+{
+	struct iio_buffer *buffer = device;
+	uint32_t *cnt = (uint32_t *)((uint8_t *)&buffer->stats + priv);
+
+	return snprintf(buf, len, "%"PRIu32"", *cnt);
+}
+
+#define IIO_BUFFER_STATS_ATTR(_name) {\
+	.name = #_name,\
+	.priv = offsetof(struct iio_buffer_stats, _name),\
+	.show = iio_buffer_stats_show,\
+}
+
+/* Buffer attributes provided by the IIO core for each device with a buffer */
+static struct iio_attribute iio_buffer_stats_attributes[] = {
+	IIO_BUFFER_STATS_ATTR(scans_pushed),
+	IIO_BUFFER_STATS_ATTR(scans_overrun),
+	IIO_BUFFER_STATS_ATTR(scans_dropped),
+	END_ATTRIBUTES_ARRAY,
+};
+
 /* Read a device register. The register address to read is set on
  * in desc->active_reg_addr in the function set_demo_reg_attr
  */
@@ -788,6 +911,7 @@ static int iio_read_attr(struct iiod_ctx *ctx, const char *device,
 	struct attr_fun_params params;
 	struct iio_attribute *attributes;
 	int8_t ch_out;
+	int ret;
 
 	dev = get_iio_device(ctx->instance, device);
 
@@ -818,6 +942,14 @@ static int iio_read_attr(struct iiod_ctx *ctx, const char *device,
 
 		params.buf = buf;
 		params.len = len;
+		if (attr->type == IIO_ATTR_TYPE_BUFFER && dev->buffer.initalized) {
+			params.dev_instance = &dev->buffer.public;
+			ret = iio_rd_wr_attribute(&params, iio_buffer_stats_attributes,
+						  attr->name, 0);
+			if (ret != -ENOENT)
+				return ret;
+		}
+
 		params.dev_instance = dev->dev_instance;
 		attributes = get_attributes(attr->type, dev, ch);
 		if (!strcmp(attr->name, ""))
@@ -1037,10 +1169,32 @@ static int iio_set_trigger(struct iiod_ctx *ctx, const char *device,
 		return -EINVAL;
 
 	dev->trig_idx = i;
+	dev->trig_events_handled = desc->trigs[i].events;
 
 	return len;
 }
 
+/**
+ * @brief Call the trigger handler of a device. Scans pushed by the handler are
+ * dated from the trigger firing instead of from their push.
+ * @param dev    - IIO device.
+ * @param trig   - Trigger linked to the device.
+ * @param events - Number of trigger events handled by this call.
+ * @return Result of the trigger handler.
+ */
+static int iio_call_trigger_handler(struct iio_dev_priv *dev,
+				    struct iio_trig_priv *trig, uint32_t events)
+{
+	int ret;
+
+	dev->dev_data.events_pending = events;
+	dev->buffer.public.trigger_timestamp = trig->timestamp;
+	ret = dev->dev_descriptor->trigger_handler(&dev->dev_data);
+	dev->buffer.public.trigger_timestamp = 0;
+
+	return ret;
+}
+
 /**
  * @brief Asynchronous trigger processing routine.
  * @param desc - IIO descriptor.
@@ -1049,18 +1203,80 @@ static void iio_process_async_triggers(struct iio_desc *desc)
 {
 	struct iio_dev_priv *dev;
 	uint32_t i;
+	int ret;
 
 	for (i = 0; i < desc->nb_devs; i++) {
 		dev = desc->devs + i;
 		if (dev->trig_idx == NO_TRIGGER)
 			continue;
 
+		if (desc->trigs[dev->trig_idx].descriptor->is_deferred)
+			continue;
+
 		if (!desc->trigs[dev->trig_idx].triggered)
 			continue;
 
 		if (dev->dev_descriptor->trigger_handler) {
-			dev->dev_descriptor->trigger_handler(&dev->dev_data);
-			desc->trigs[i].triggered = 0;
+			ret = iio_call_trigger_handler(dev, &desc->trigs[dev->trig_idx], 1);
+			if (ret < 0)
+				dev->trig_err = ret;
+			desc->trigs[dev->trig_idx].triggered = 0;
+		}
+	}
+}
+
+/**
+ * @brief Bottom half of the deferred triggers. Calls the trigger handler of
+ * each device with the events fired since its previous call, at most
+ * max_batch events per call. When a handler fails, the events left are
+ * dropped and the error is returned by the next read of the device buffer.
+ * @param desc - IIO descriptor.
+ */
+static void iio_process_deferred_triggers(struct iio_desc *desc)
+{
+	struct iio_trig_priv *trig;
+	struct iio_dev_priv *dev;
+	uint32_t pending;
+	uint32_t batch;
+	uint32_t i;
+	int ret;
+
+	for (i = 0; i < desc->nb_devs; i++) {
+		dev = desc->devs + i;
+		if (dev->trig_idx == NO_TRIGGER)
+			continue;
+
+		trig = &desc->trigs[dev->trig_idx];
+		if (!trig->descriptor->is_deferred)
+			continue;
+
+		/* Unsigned difference stays valid when the counter wraps */
+		pending = trig->events - dev->trig_events_handled;
+		if (!pending)
+			continue;
+
+		if (!dev->dev_descriptor->trigger_handler ||
+		    !dev->buffer.public.active_mask) {
+			dev->trig_events_handled += pending;
+			continue;
+		}
+
+		while (pending) {
+			batch = pending;
+			if (trig->descriptor->max_batch)
+				batch = no_os_min(pending, trig->descriptor->max_batch);
+
+			ret = iio_call_trigger_handler(dev, trig, batch);
+			if (ret < 0) {
+				/* Don't retry, the events left are lost */
+				dev->trig_err = ret;
+				iio_buffer_drop_scans(&dev->buffer.public, pending);
+				dev->trig_events_handled += pending;
+				break;
+			}
+
+			dev->trig_events_handled += batch;
+			pending -= batch;
 		}
 	}
 }
@@ -1078,6 +1294,7 @@ int iio_process_trigger_type(struct iio_desc *desc, char *trigger_name)
 	uint32_t i;
 	uint32_t trig_id;
 	struct iio_trig_priv *trig;
+	uint64_t ns = 0;
 
 	trig_id = iio_get_trig_idx_by_name(desc, trigger_name);
 
@@ -1086,13 +1303,23 @@ int iio_process_trigger_type(struct iio_desc *desc, char *trigger_name)
 
 	struct iio_dev_priv *dev;
 
+	trig = &desc->trigs[trig_id];
+	/* Called from the data ready interrupt for hardware triggers */
+	if (desc->timestamp_timer)
+		no_os_timer_get_elapsed_time_nsec(desc->timestamp_timer, &ns);
+	trig->timestamp = ns;
+
+	if (trig->descriptor->is_deferred) {
+		trig->events++;
+		return 0;
+	}
+
 	for (i = 0; i < desc->nb_devs; i++) {
 		dev = desc->devs + i;
 		if (dev->trig_idx == trig_id) {
-			trig = &desc->trigs[trig_id];
 			if (trig->descriptor->is_synchronous) {
 				if (dev->dev_descriptor->trigger_handler)
-					dev->dev_descriptor->trigger_handler(&dev->dev_data);
+					iio_call_trigger_handler(dev, trig, 1);
 			} else {
 				trig->triggered = 1;
 			}
@@ -1131,6 +1358,36 @@ static uint32_t bytes_per_scan(struct iio_channel *channels, uint32_t mask)
 	return cnt;
 }
 
+/**
+ * @brief Configure the timestamp of the active scan and reset the buffer
+ * counters. The timestamp channel must be the last active channel.
+ * @param dev - IIO device.
+ * @param mask - Active channels.
+ * @return 0 in case of success, -EINVAL if the timestamp channel is misplaced.
+ */
+static int iio_buffer_scan_setup(struct iio_dev_priv *dev, uint32_t mask)
+{
+	struct iio_buffer *buffer = &dev->buffer.public;
+	struct iio_channel *channels = dev->dev_descriptor->channels;
+	uint32_t last = no_os_find_last_set_bit(mask);
+	uint32_t i;
+
+	for (i = 0; i < last; i++)
+		if ((mask & NO_OS_BIT(i)) && channels[i].ch_type == IIO_TIMESTAMP)
+			return -EINVAL;
+
+	buffer->timestamp_en = channels[last].ch_type == IIO_TIMESTAMP;
+	if (buffer->timestamp_en)
+		buffer->timestamp_offset = buffer->bytes_per_scan -
+					   channels[last].scan_type->storagebits / 8;
+	else
+		buffer->timestamp_offset = 0;
+
+	memset(&buffer->stats, 0, sizeof(buffer->stats));
+
+	return 0;
+}
+
 /**
  * @brief  Open device.
  * @param ctx - IIO instance and conn instance
@@ -1168,6 +1425,10 @@ static int iio_open_dev(struct iiod_ctx *ctx, const char *device,
 	dev->buffer.public.active_mask = mask;
 	dev->buffer.public.bytes_per_scan =
 		bytes_per_scan(dev->dev_descriptor->channels, mask);
+	ret = iio_buffer_scan_setup(dev, mask);
+	if (ret)
+		return ret;
+
 	dev->buffer.public.size = dev->buffer.public.bytes_per_scan * samples;
 	dev->buffer.public.samples = samples;
 	if (dev->buffer.raw_buf && dev->buffer.raw_buf_len) {
@@ -1214,6 +1475,9 @@ static int iio_open_dev(struct iiod_ctx *ctx, const char *device,
 	desc = ctx->instance;
 	if (dev->trig_idx != NO_TRIGGER) {
 		trig = &desc->trigs[dev->trig_idx];
+		/* Discard deferred events fired while the buffer was closed */
+		dev->trig_events_handled = trig->events;
+		dev->trig_err = 0;
 		if (trig->descriptor->enable)
 			ret = trig->descriptor->enable(trig->instance);
 	}
@@ -1334,6 +1598,12 @@ static int iio_read_buffer(struct iiod_ctx *ctx, const char *device, char *buf,
 	if (!dev || !dev->buffer.initalized)
 		return -EINVAL;
 
+	if (dev->trig_err) {
+		ret = dev->trig_err;
+		dev->trig_err = 0;
+		return ret;
+	}
+
 	ret = no_os_cb_size(&dev->buffer.cb, &size);
 #ifdef IIO_IGNORE_BUFF_OVERRUN_ERR
 #warning Buffer overrun error checking is disabled.
@@ -1391,6 +1661,88 @@ static int iio_write_buffer(struct iiod_ctx *ctx, const char *device,
 	return bytes;
 }
 
+/**
+ * @brief Open the buffer of a device for a consumer running in the firmware,
+ * for example a recorder, instead of an iiod client.
+ * @param desc - IIO descriptor.
+ * @param device - Device name.
+ * @param samples - Number of scans per refill.
+ * @param mask - Channels to be enabled.
+ * @param buffer - Set to the opened buffer. Optional.
+ * @return 0 in case of success, -EBUSY if the buffer is already in use,
+ * negative error code otherwise.
+ */
+int iio_buffer_open(struct iio_desc *desc, const char *device,
+		    uint32_t samples, uint32_t mask, struct iio_buffer **buffer)
+{
+	struct iiod_ctx ctx = {.instance = desc};
+	struct iio_dev_priv *dev;
+	int ret;
+
+	if (!desc || !device)
+		return -EINVAL;
+
+	dev = get_iio_device(desc, device);
+	if (!dev)
+		return -ENODEV;
+
+	if (dev->buffer.public.active_mask)
+		return -EBUSY;
+
+	ret = iio_open_dev(&ctx, device, samples, mask, false);
+	if (ret)
+		return ret;
+
+	if (buffer)
+		*buffer = &dev->buffer.public;
+
+	return 0;
+}
+
+/**
+ * @brief Ask a device opened with iio_buffer_open() for new scans. Devices
+ * driven by a trigger push scans on their own and are not called.
+ * @param desc - IIO descriptor.
+ * @param device - Device name.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+int iio_buffer_refill(struct iio_desc *desc, const char *device)
+{
+	struct iiod_ctx ctx = {.instance = desc};
+
+	return iio_refill_buffer(&ctx, device);
+}
+
+/**
+ * @brief Read the scans available in a buffer opened with iio_buffer_open().
+ * @param desc - IIO descriptor.
+ * @param device - Device name.
+ * @param buf - Destination.
+ * @param bytes - Maximum number of bytes to read.
+ * @return Number of bytes read, -EAGAIN if the buffer is empty, negative
+ * error code otherwise.
+ */
+int iio_buffer_read(struct iio_desc *desc, const char *device, void *buf,
+		    uint32_t bytes)
+{
+	struct iiod_ctx ctx = {.instance = desc};
+
+	return iio_read_buffer(&ctx, device, buf, bytes);
+}
+
+/**
+ * @brief Close a buffer opened with iio_buffer_open().
+ * @param desc - IIO descriptor.
+ * @param device - Device name.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+int iio_buffer_close(struct iio_desc *desc, const char *device)
+{
+	struct iiod_ctx ctx = {.instance = desc};
+
+	return iio_close_dev(&ctx, device);
+}
+
 int iio_buffer_get_block(struct iio_buffer *buffer, void **addr)
 {
 	uint32_t size;
@@ -1406,22 +1758,143 @@ int iio_buffer_get_block(struct iio_buffer *buffer, void **addr)
 
 int iio_buffer_block_done(struct iio_buffer *buffer)
 {
+	int ret;
+
 	if (!buffer)
 		return -EINVAL;
 
-	if (buffer->dir == IIO_DIRECTION_INPUT)
-		return no_os_cb_end_async_write(buffer->buf);
+	if (buffer->dir == IIO_DIRECTION_INPUT) {
+		ret = no_os_cb_end_async_write(buffer->buf);
+		if (!ret && buffer->bytes_per_scan)
+			buffer->stats.scans_pushed += buffer->size /
+						      buffer->bytes_per_scan;
+		return ret;
+	}
 
 	return no_os_cb_end_async_read(buffer->buf);
 }
 
-/* Write to buffer iio_buffer.bytes_per_scan bytes from data */
+/**
+ * @brief Get the current time of the timer used to timestamp scans.
+ * @param buffer - IIO buffer.
+ * @return Time in ns from the timestamp timer, 0 if there is no timer.
+ */
+uint64_t iio_buffer_get_timestamp(struct iio_buffer *buffer)
+{
+	uint64_t ns = 0;
+
+	if (!buffer || !buffer->timestamp_timer)
+		return 0;
+
+	if (no_os_timer_get_elapsed_time_nsec(buffer->timestamp_timer, &ns))
+		return 0;
+
+	return ns;
+}
+
+/*
+ * Write to buffer iio_buffer.bytes_per_scan bytes from data. If the timestamp
+ * channel is enabled, only the bytes before the timestamp are taken from data.
+ * Scans pushed from a trigger handler get the time of the trigger firing.
+ */
 int iio_buffer_push_scan(struct iio_buffer *buffer, void *data)
 {
+	uint64_t timestamp = 0;
+
 	if (!buffer)
 		return -EINVAL;
 
-	return no_os_cb_write(buffer->buf, data, buffer->bytes_per_scan);
+	if (buffer->timestamp_en) {
+		timestamp = buffer->trigger_timestamp;
+		if (!timestamp)
+			timestamp = iio_buffer_get_timestamp(buffer);
+	}
+
+	return iio_buffer_push_scan_ts(buffer, data, timestamp);
+}
+
+/*
+ * Same as iio_buffer_push_scan(), with the timestamp of the scan provided by
+ * the caller. Used by devices which deliver several scans at once, from a
+ * hardware FIFO, to date each scan from its sample period.
+ */
+int iio_buffer_push_scan_ts(struct iio_buffer *buffer, void *data,
+			    uint64_t timestamp)
+{
+	uint8_t ts[8];
+	uint32_t size;
+	int ret;
+
+	if (!buffer)
+		return -EINVAL;
+
+	if (buffer->timestamp_en)
+		no_os_put_unaligned_le64(timestamp, ts);
+
+	/* The circular buffer overwrites unread data instead of failing */
+	no_os_cb_size(buffer->buf, &size);
+	if (size + buffer->bytes_per_scan > buffer->buf->size)
+		buffer->stats.scans_overrun++;
+
+	if (!buffer->timestamp_en) {
+		ret = no_os_cb_write(buffer->buf, data, buffer->bytes_per_scan);
+	} else {
+		ret = 0;
+		if (buffer->timestamp_offset)
+			ret = no_os_cb_write(buffer->buf, data,
+					     buffer->timestamp_offset);
+		if (!ret)
+			ret = no_os_cb_write(buffer->buf, ts, sizeof(ts));
+	}
+	if (ret) {
+		buffer->stats.scans_dropped++;
+		return ret;
+	}
+
+	buffer->stats.scans_pushed++;
+
+	return 0;
+}
+
+/* Account scans lost before reaching the buffer */
+void iio_buffer_drop_scans(struct iio_buffer *buffer, uint32_t nb_scans)
+{
+	if (buffer)
+		buffer->stats.scans_dropped += nb_scans;
+}
+
+/**
+ * @brief Account lost scans from a free running hardware sample counter, which
+ * increments by one for each new sample and wraps around at 2^bits.
+ * @param buffer - IIO buffer.
+ * @param counter - Counter value read together with the sample.
+ * @param bits - Counter width, 1 to 32.
+ * @return 0 if the sample is new, -EAGAIN if the counter did not change since
+ * the previous call (the sample was already pushed), -EINVAL otherwise.
+ */
+int iio_buffer_check_counter(struct iio_buffer *buffer, uint32_t counter,
+			     uint8_t bits)
+{
+	uint32_t mask;
+	uint32_t gap;
+
+	if (!buffer || !bits || bits > 32)
+		return -EINVAL;
+
+	mask = (uint32_t)(NO_OS_BIT_ULL(bits) - 1);
+	counter &= mask;
+
+	if (buffer->stats.counter_valid) {
+		gap = (counter - buffer->stats.last_counter) & mask;
+		if (!gap)
+			return -EAGAIN;
+		buffer->stats.scans_dropped += gap - 1;
+	}
+
+	buffer->stats.last_counter = counter;
+	buffer->stats.counter_valid = true;
+
+	return 0;
 }
 
 /* Read from buffer iio_buffer.bytes_per_scan bytes into data */
@@ -1499,6 +1972,7 @@ int iio_step(struct iio_desc *desc)
 	int32_t ret;
 
 	iio_process_async_triggers(desc);
+	iio_process_deferred_triggers(desc);
 
 #if defined(NO_OS_NETWORKING) || defined(NO_OS_LWIP_NETWORKING) || defined(NO_OS_W5500_NETWORKING)
 	if (desc->server) {
@@ -1573,6 +2047,13 @@ static uint32_t iio_add_ctx_attr_in_xml(struct iio_desc *desc, char *buff,
 	return i;
 }
 
+/* Devices with data callbacks get a buffer */
+static inline bool iio_device_has_buffer(struct iio_device *device)
+{
+	return device->read_dev || device->write_dev || device->submit ||
+	       device->trigger_handler;
+}
+
 /*
  * Generate an xml describing a device and write it to buff.
  * Will return the size of the xml.
@@ -1739,6 +2220,11 @@ static uint32_t iio_generate_device_xml(struct iio_device *device, char *name,
 			i += snprintf(buff + i, no_os_max(n - i, 0),
 				      "<buffer-attribute name=\"%s\" />",
 				      device->buffer_attributes[j].name);
+	if (iio_device_has_buffer(device))
+		for (j = 0; iio_buffer_stats_attributes[j].name; j++)
+			i += snprintf(buff + i, no_os_max(n - i, 0),
+				      "<buffer-attribute name=\"%s\" />",
+				      iio_buffer_stats_attributes[j].name);
 
 	i += snprintf(buff + i, no_os_max(n - i, 0), "</device>");
 
@@ -1818,13 +2304,11 @@ static int32_t iio_init_devs(struct iio_desc *desc,
 		ldev->dev_data.dev = ndev->dev;
 		ldev->dev_data.buffer = &ldev->buffer.public;
 		ldev->name = ndev->name;
-		if (ndev->dev_descriptor->read_dev ||
-		    ndev->dev_descriptor->write_dev ||
-		    ndev->dev_descriptor->submit ||
-		    ndev->dev_descriptor->trigger_handler) {
+		if (iio_device_has_buffer(ndev->dev_descriptor)) {
 			ldev->buffer.raw_buf = ndev->raw_buf;
 			ldev->buffer.raw_buf_len = ndev->raw_buf_len;
 			ldev->buffer.public.buf = &ldev->buffer.cb;
+			ldev->buffer.public.timestamp_timer = desc->timestamp_timer;
 			ldev->buffer.initalized = 1;
 		} else {
 			ldev->buffer.initalized = 0;
@@ -1889,6 +2373,7 @@ int iio_init(struct iio_desc **desc, struct iio_init_param *init_param)
 
 	ldesc->ctx_attrs = init_param->ctx_attrs;
 	ldesc->nb_ctx_attr = init_param->nb_ctx_attr;
+	ldesc->timestamp_timer = init_param->timestamp_timer;
 
 	ret = iio_init_trigs(ldesc, init_param->trigs, init_param->nb_trigs);
 	if (NO_OS_IS_ERR_VALUE(ret))
@@ -1934,12 +2419,12 @@ int iio_init(struct iio_desc **desc, struct iio_init_param *init_param)
 		goto free_iiod;
 
 	if (init_param->phy_type == USE_UART) {
-		ldesc->send = (int (*)())no_os_uart_write;
-		ldesc->recv = (int (*)())no_os_uart_read;
+		ldesc->send = (int (*)())iio_uart_send;
+		ldesc->recv = (int (*)())iio_uart_recv;
 		ldesc->uart_desc = init_param->uart_desc;
 
 		struct iiod_conn_data data = {
-			.conn = ldesc->uart_desc,
+			.conn = ldesc,
 			.buf = uart_buff,
 			.len = sizeof(uart_buff)
 		};
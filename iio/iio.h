@@ -49,6 +49,22 @@ enum physical_link_type {
 
 struct iio_desc;
 
+/*
+ * Timestamp channel. Must be the last channel of the device. When enabled, the
+ * IIO core appends the time of iio_buffer_push_scan() to each scan, in ns, so
+ * drivers only provide the data of the other channels.
+ */
+#define IIO_CHAN_SOFT_TIMESTAMP(_si) {\
+	.name = "timestamp",\
+	.ch_type = IIO_TIMESTAMP,\
+	.channel = -1,\
+	.scan_index = _si,\
+	.scan_type = &iio_timestamp_scan_type,\
+	.ch_out = false,\
+}
+
+extern struct scan_type iio_timestamp_scan_type;
+
 struct iio_device_init {
 	char *name;
 	void *dev;
@@ -108,6 +124,8 @@ struct iio_init_param {
 	uint32_t nb_devs;
 	struct iio_trigger_init *trigs;
 	uint32_t nb_trigs;
+	/* Timer used to timestamp scans. Optional */
+	struct no_os_timer_desc *timestamp_timer;
 };
 
 /* Set communication ops and read/write ops. */
@@ -134,10 +152,32 @@ int iio_buffer_get_block(struct iio_buffer *buffer, void **addr);
 /* To be called to mark last iio_buffer_read as done */
 int iio_buffer_block_done(struct iio_buffer *buffer);
 
+/* Local buffer access, for consumers running in the firmware. */
+/* Open the buffer of a device, -EBUSY if an iiod client already uses it */
+int iio_buffer_open(struct iio_desc *desc, const char *device,
+		    uint32_t samples, uint32_t mask, struct iio_buffer **buffer);
+/* Acquire new scans on devices which are not driven by a trigger */
+int iio_buffer_refill(struct iio_desc *desc, const char *device);
+/* Read up to bytes of scans, -EAGAIN if none is available */
+int iio_buffer_read(struct iio_desc *desc, const char *device, void *buf,
+		    uint32_t bytes);
+/* Close a buffer opened with iio_buffer_open() */
+int iio_buffer_close(struct iio_desc *desc, const char *device);
+
 /* Trigger buffer functions. */
 /* Write to buffer iio_buffer.bytes_per_scan bytes from data */
 int iio_buffer_push_scan(struct iio_buffer *buffer, void *data);
+/* Same as iio_buffer_push_scan(), with the timestamp provided by the caller */
+int iio_buffer_push_scan_ts(struct iio_buffer *buffer, void *data,
+			    uint64_t timestamp);
+/* Current time of the timestamp timer in ns, 0 if there is no timer */
+uint64_t iio_buffer_get_timestamp(struct iio_buffer *buffer);
 /* Read from buffer iio_buffer.bytes_per_scan bytes into data */
 int iio_buffer_pop_scan(struct iio_buffer *buffer, void *data);
+/* Account scans lost before reaching the buffer */
+void iio_buffer_drop_scans(struct iio_buffer *buffer, uint32_t nb_scans);
+/* Account lost scans from a free running hardware sample counter */
+int iio_buffer_check_counter(struct iio_buffer *buffer, uint32_t counter,
+			     uint8_t bits);
 
 #endif /* IIO_H_ */
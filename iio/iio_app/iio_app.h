@@ -124,6 +124,8 @@ struct iio_app_init_param {
 	int (*post_step_callback)(void *arg);
 	/** Function parameteres */
 	void *arg;
+	/** Timer used to timestamp buffer scans. Optional */
+	struct no_os_timer_desc *timestamp_timer;
 
 #ifdef NO_OS_LWIP_NETWORKING
 	struct lwip_network_param lwip_param;
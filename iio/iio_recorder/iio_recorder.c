@@ -0,0 +1,441 @@
+/***************************************************************************//**
+ *   @file   iio_recorder.c
+ *   @brief  Source file of the IIO buffer to FatFs recorder.
+********************************************************************************
+ * Copyright 2026(c) Analog Devices, Inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Analog Devices, Inc. nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ANALOG DEVICES, INC. “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL ANALOG DEVICES, INC. BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+#include <errno.h>
+#include <string.h>
+#include "iio_recorder.h"
+#include "no_os_alloc.h"
+#include "no_os_util.h"
+
+/**
+ * @brief Convert a FatFs result to an error code.
+ * @param res - FatFs result.
+ * @return 0 for FR_OK, negative error code otherwise.
+ */
+static int iio_recorder_fs_err(FRESULT res)
+{
+	switch (res) {
+	case FR_OK:
+		return 0;
+	case FR_NO_FILE:
+	case FR_NO_PATH:
+	case FR_NOT_ENABLED:
+	case FR_NO_FILESYSTEM:
+		return -ENOENT;
+	case FR_DENIED:
+		return -ENOSPC;
+	case FR_EXIST:
+		return -EEXIST;
+	case FR_INVALID_NAME:
+	case FR_INVALID_OBJECT:
+	case FR_INVALID_PARAMETER:
+		return -EINVAL;
+	case FR_WRITE_PROTECTED:
+		return -EROFS;
+	case FR_TIMEOUT:
+	case FR_LOCKED:
+		return -EBUSY;
+	case FR_NOT_ENOUGH_CORE:
+		return -ENOMEM;
+	default:
+		return -EIO;
+	}
+}
+
+/**
+ * @brief Write a buffer to the recording file.
+ * @param rec - Recorder descriptor.
+ * @param buf - Data.
+ * @param len - Number of bytes.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+static int iio_recorder_file_write(struct iio_recorder *rec, const void *buf,
+				   uint32_t len)
+{
+	UINT written;
+	FRESULT res;
+
+	res = f_write(&rec->file, buf, len, &written);
+	if (res != FR_OK)
+		return iio_recorder_fs_err(res);
+
+	/* The volume is full */
+	if (written != len)
+		return -ENOSPC;
+
+	return 0;
+}
+
+/**
+ * @brief Build the file header. Channel offsets follow the scan layout of the
+ * IIO core, where each sample is aligned to its own size.
+ * @param rec - Recorder descriptor.
+ * @param dev - Device descriptor.
+ * @param mask - Active channels.
+ */
+static void iio_recorder_header_init(struct iio_recorder *rec,
+				     struct iio_device *dev, uint32_t mask)
+{
+	struct iio_channel *ch;
+	uint8_t *hdr = rec->header;
+	uint8_t *entry = hdr + IIO_RECORDER_HDR_LEN;
+	uint32_t offset = 0;
+	uint32_t length;
+	uint16_t nb_ch = 0;
+	uint8_t flags;
+	uint32_t i;
+
+	no_os_put_unaligned_le32(IIO_RECORDER_MAGIC, hdr);
+	no_os_put_unaligned_le16(IIO_RECORDER_VERSION, hdr + 4);
+	no_os_put_unaligned_le16(rec->header_size, hdr + 6);
+	no_os_put_unaligned_le32(rec->buffer->bytes_per_scan, hdr + 8);
+	no_os_put_unaligned_le32(mask, hdr + 12);
+	no_os_put_unaligned_le16(IIO_RECORDER_CH_LEN, hdr + 18);
+	strncpy((char *)hdr + 44, rec->name, IIO_RECORDER_NAME_LEN - 1);
+
+	for (i = 0; i < dev->num_ch; i++) {
+		if (!(mask & NO_OS_BIT(i)))
+			continue;
+
+		ch = &dev->channels[i];
+		length = ch->scan_type->storagebits / 8;
+		if (offset % length)
+			offset += length - offset % length;
+
+		flags = 0;
+		if (ch->modified)
+			flags |= IIO_RECORDER_CH_MODIFIED;
+		if (ch->indexed)
+			flags |= IIO_RECORDER_CH_INDEXED;
+		if (ch->diferential)
+			flags |= IIO_RECORDER_CH_DIFFERENTIAL;
+
+		entry[0] = i;
+		entry[1] = ch->ch_type;
+		entry[2] = ch->scan_type->sign;
+		entry[3] = ch->scan_type->realbits;
+		entry[4] = ch->scan_type->storagebits;
+		entry[5] = ch->scan_type->shift;
+		entry[6] = ch->scan_type->is_big_endian;
+		entry[7] = flags;
+		no_os_put_unaligned_le16(ch->channel, entry + 8);
+		no_os_put_unaligned_le16(ch->channel2, entry + 10);
+		no_os_put_unaligned_le16(offset, entry + 12);
+		if (ch->name)
+			strncpy((char *)entry + 16, ch->name,
+				IIO_RECORDER_CH_NAME_LEN - 1);
+
+		offset += length;
+		entry += IIO_RECORDER_CH_LEN;
+		nb_ch++;
+	}
+
+	no_os_put_unaligned_le16(nb_ch, hdr + 16);
+}
+
+/**
+ * @brief Update the counters of the file header.
+ * @param rec - Recorder descriptor.
+ */
+static void iio_recorder_header_update(struct iio_recorder *rec)
+{
+	struct iio_buffer_stats *stats = &rec->buffer->stats;
+	uint8_t *hdr = rec->header;
+
+	no_os_put_unaligned_le64(rec->stats.data_bytes, hdr + 20);
+	no_os_put_unaligned_le32(stats->scans_pushed, hdr + 28);
+	no_os_put_unaligned_le32(stats->scans_overrun, hdr + 32);
+	no_os_put_unaligned_le32(stats->scans_dropped, hdr + 36);
+	no_os_put_unaligned_le32(rec->stats.blocks_busy, hdr + 40);
+}
+
+/**
+ * @brief Create the recording file and open the buffer of the IIO device.
+ * The file starts with a header describing the scan, followed by the scans
+ * as read from the IIO buffer.
+ * @param rec - The recorder descriptor.
+ * @param param - Initialization parameters.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+int iio_recorder_init(struct iio_recorder **rec,
+		      const struct iio_recorder_init_param *param)
+{
+	struct iio_recorder *desc;
+	uint32_t nb_ch;
+	FRESULT res;
+	int ret;
+
+	if (!rec || !param || !param->iio_desc || !param->name ||
+	    !param->dev_descriptor || !param->path || !param->mask ||
+	    !param->samples || !param->block_size ||
+	    param->block_size % IIO_RECORDER_SECTOR)
+		return -EINVAL;
+
+	desc = no_os_calloc(1, sizeof(*desc));
+	if (!desc)
+		return -ENOMEM;
+
+	desc->iio_desc = param->iio_desc;
+	desc->name = param->name;
+	desc->block_size = param->block_size;
+
+	nb_ch = no_os_hweight32(param->mask);
+	desc->header_size = NO_OS_DIV_ROUND_UP(IIO_RECORDER_HDR_LEN +
+					       nb_ch * IIO_RECORDER_CH_LEN,
+					       IIO_RECORDER_SECTOR) *
+			    IIO_RECORDER_SECTOR;
+	desc->header = no_os_calloc(desc->header_size, sizeof(*desc->header));
+	if (!desc->header) {
+		ret = -ENOMEM;
+		goto free_desc;
+	}
+
+	desc->block[0] = no_os_calloc(2, desc->block_size);
+	if (!desc->block[0]) {
+		ret = -ENOMEM;
+		goto free_header;
+	}
+	desc->block[1] = desc->block[0] + desc->block_size;
+
+	res = f_open(&desc->file, param->path, FA_CREATE_ALWAYS | FA_WRITE);
+	if (res != FR_OK) {
+		ret = iio_recorder_fs_err(res);
+		goto free_blocks;
+	}
+
+	/* Contiguous clusters let FatFs write blocks without FAT lookups */
+	if (param->file_size) {
+		res = f_expand(&desc->file, param->file_size, 1);
+		if (res != FR_OK) {
+			ret = iio_recorder_fs_err(res);
+			goto close_file;
+		}
+	}
+
+	ret = iio_buffer_open(desc->iio_desc, desc->name, param->samples,
+			      param->mask, &desc->buffer);
+	if (ret)
+		goto close_file;
+
+	iio_recorder_header_init(desc, param->dev_descriptor,
+				 desc->buffer->active_mask);
+	ret = iio_recorder_file_write(desc, desc->header, desc->header_size);
+	if (ret)
+		goto close_buffer;
+
+	*rec = desc;
+
+	return 0;
+
+close_buffer:
+	iio_buffer_close(desc->iio_desc, desc->name);
+close_file:
+	f_close(&desc->file);
+free_blocks:
+	no_os_free(desc->block[0]);
+free_header:
+	no_os_free(desc->header);
+free_desc:
+	no_os_free(desc);
+
+	return ret;
+}
+
+/**
+ * @brief Move the scans available in the IIO buffer to the free blocks.
+ * @param rec - The recorder descriptor.
+ * @param refill - Refill the IIO buffer once when it is empty.
+ * @return 0 in case of success, -EBUSY if both blocks wait to be written,
+ * negative error code otherwise.
+ */
+static int iio_recorder_fill_blocks(struct iio_recorder *rec, bool refill)
+{
+	int ret;
+
+	while (true) {
+		if (__atomic_load_n(&rec->ready[rec->fill_idx], __ATOMIC_ACQUIRE)) {
+			rec->stats.blocks_busy++;
+			return -EBUSY;
+		}
+
+		ret = iio_buffer_read(rec->iio_desc, rec->name,
+				      rec->block[rec->fill_idx] + rec->fill_len,
+				      rec->block_size - rec->fill_len);
+		if (ret == -EAGAIN) {
+			if (!refill)
+				return 0;
+
+			ret = iio_buffer_refill(rec->iio_desc, rec->name);
+			if (ret)
+				return ret;
+
+			refill = false;
+			continue;
+		}
+		if (ret < 0)
+			return ret;
+
+		rec->fill_len += ret;
+		if (rec->fill_len == rec->block_size) {
+			/* Publish the block data before the flag */
+			__atomic_store_n(&rec->ready[rec->fill_idx], true,
+					 __ATOMIC_RELEASE);
+			rec->fill_idx ^= 1;
+			rec->fill_len = 0;
+		}
+	}
+}
+
+/**
+ * @brief Move the scans available in the IIO buffer to the block being
+ * filled. Devices which are not driven by a trigger are refilled when the IIO
+ * buffer is empty. When a block is full, filling continues with the other
+ * block, unless it still waits to be written.
+ * @param rec - The recorder descriptor.
+ * @return 0 in case of success, -EBUSY if both blocks wait to be written,
+ * negative error code otherwise.
+ */
+int iio_recorder_fill(struct iio_recorder *rec)
+{
+	if (!rec)
+		return -EINVAL;
+
+	return iio_recorder_fill_blocks(rec, true);
+}
+
+/**
+ * @brief Write the oldest full block to the file. May be called from a
+ * different context than iio_recorder_fill(), so the card busy time does not
+ * stop scans from being moved out of the IIO buffer.
+ * @param rec - The recorder descriptor.
+ * @return 0 in case of success or if no block is full, negative error code
+ * otherwise.
+ */
+int iio_recorder_write(struct iio_recorder *rec)
+{
+	int ret;
+
+	if (!rec)
+		return -EINVAL;
+
+	if (!__atomic_load_n(&rec->ready[rec->write_idx], __ATOMIC_ACQUIRE))
+		return 0;
+
+	ret = iio_recorder_file_write(rec, rec->block[rec->write_idx],
+				      rec->block_size);
+	if (ret)
+		return ret;
+
+	rec->stats.data_bytes += rec->block_size;
+	rec->stats.blocks_written++;
+	/* The block may be refilled once the write is done */
+	__atomic_store_n(&rec->ready[rec->write_idx], false, __ATOMIC_RELEASE);
+	rec->write_idx ^= 1;
+
+	return 0;
+}
+
+/**
+ * @brief Fill the blocks and write the full ones, for applications recording
+ * from the main loop.
+ * @param rec - The recorder descriptor.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+int iio_recorder_step(struct iio_recorder *rec)
+{
+	int ret;
+
+	ret = iio_recorder_fill(rec);
+	if (ret && ret != -EBUSY)
+		return ret;
+
+	ret = iio_recorder_write(rec);
+	if (ret)
+		return ret;
+
+	return iio_recorder_write(rec);
+}
+
+/**
+ * @brief Write the pending scans, update the header, release the unused
+ * pre-allocated space and close the file and the IIO buffer.
+ * @param rec - The recorder descriptor.
+ * @return 0 in case of success, negative error code otherwise. The resources
+ * are released in both cases.
+ */
+int iio_recorder_remove(struct iio_recorder *rec)
+{
+	FRESULT res;
+	bool busy;
+	int ret;
+
+	if (!rec)
+		return -EINVAL;
+
+	/* Drain the IIO buffer without acquiring more scans */
+	do {
+		ret = iio_recorder_fill_blocks(rec, false);
+		busy = ret == -EBUSY;
+		if (busy)
+			ret = 0;
+		if (!ret)
+			ret = iio_recorder_write(rec);
+		if (!ret)
+			ret = iio_recorder_write(rec);
+	} while (!ret && busy);
+
+	if (!ret && rec->fill_len) {
+		ret = iio_recorder_file_write(rec, rec->block[rec->fill_idx],
+					      rec->fill_len);
+		if (!ret)
+			rec->stats.data_bytes += rec->fill_len;
+	}
+
+	iio_recorder_header_update(rec);
+	if (!ret)
+		ret = iio_recorder_fs_err(f_truncate(&rec->file));
+	if (!ret)
+		ret = iio_recorder_fs_err(f_lseek(&rec->file, 0));
+	if (!ret)
+		ret = iio_recorder_file_write(rec, rec->header, rec->header_size);
+
+	res = f_close(&rec->file);
+	if (!ret)
+		ret = iio_recorder_fs_err(res);
+
+	iio_buffer_close(rec->iio_desc, rec->name);
+	no_os_free(rec->block[0]);
+	no_os_free(rec->header);
+	no_os_free(rec);
+
+	return ret;
+}
@@ -0,0 +1,177 @@
+/***************************************************************************//**
+ *   @file   iio_recorder.h
+ *   @brief  Header file of the IIO buffer to FatFs recorder.
+********************************************************************************
+ * Copyright 2026(c) Analog Devices, Inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Analog Devices, Inc. nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ANALOG DEVICES, INC. “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL ANALOG DEVICES, INC. BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+#ifndef IIO_RECORDER_H_
+#define IIO_RECORDER_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "iio.h"
+#include "no_os_util.h"
+#include "ff.h"
+
+/*
+ * Recording file layout, all fields little endian:
+ *
+ * Header, padded to a multiple of IIO_RECORDER_SECTOR bytes so the scans
+ * which follow start on a sector boundary:
+ *   0  u32 magic, IIO_RECORDER_MAGIC
+ *   4  u16 version, IIO_RECORDER_VERSION
+ *   6  u16 header size in bytes, offset of the first scan
+ *   8  u32 bytes per scan
+ *  12  u32 active channel mask
+ *  16  u16 number of channel entries
+ *  18  u16 size of a channel entry
+ *  20  u64 number of data bytes
+ *  28  u32 scans pushed to the IIO buffer
+ *  32  u32 scans overwritten in the IIO buffer
+ *  36  u32 scans dropped before reaching the IIO buffer
+ *  40  u32 blocks the recorder could not take from the IIO buffer
+ *  44  char[20] device name
+ *  64  channel entries, in scan order
+ *
+ * Channel entry:
+ *   0  u8 channel index in the device
+ *   1  u8 channel type, enum iio_chan_type
+ *   2  u8 sign, 's' or 'u'
+ *   3  u8 realbits
+ *   4  u8 storagebits
+ *   5  u8 shift
+ *   6  u8 is_big_endian
+ *   7  u8 IIO_RECORDER_CH_* flags
+ *   8  s16 channel
+ *  10  s16 channel2
+ *  12  u16 offset of the sample in the scan
+ *  14  u16 reserved
+ *  16  char[16] channel name
+ */
+#define IIO_RECORDER_MAGIC		0x524f4949 /* "IIOR" */
+#define IIO_RECORDER_VERSION		1
+#define IIO_RECORDER_SECTOR		512
+#define IIO_RECORDER_HDR_LEN		64
+#define IIO_RECORDER_CH_LEN		32
+#define IIO_RECORDER_NAME_LEN		20
+#define IIO_RECORDER_CH_NAME_LEN	16
+
+#define IIO_RECORDER_CH_MODIFIED	NO_OS_BIT(0)
+#define IIO_RECORDER_CH_INDEXED		NO_OS_BIT(1)
+#define IIO_RECORDER_CH_DIFFERENTIAL	NO_OS_BIT(2)
+
+/**
+ * @struct iio_recorder_init_param
+ * @brief IIO recorder initialization parameters
+ */
+struct iio_recorder_init_param {
+	/** IIO descriptor the device was registered to */
+	struct iio_desc *iio_desc;
+	/** Device name, as registered with iio_init() */
+	const char *name;
+	/** Device descriptor, as registered with iio_init() */
+	struct iio_device *dev_descriptor;
+	/** Channels to record */
+	uint32_t mask;
+	/** Number of scans acquired by a buffer refill */
+	uint32_t samples;
+	/** File path, on a volume already mounted with f_mount() */
+	const char *path;
+	/**
+	 * Size to pre-allocate as a contiguous area, in bytes. Unused space is
+	 * released by iio_recorder_remove(). 0 to grow the file on demand.
+	 */
+	uint64_t file_size;
+	/** Size of a file write, multiple of IIO_RECORDER_SECTOR */
+	uint32_t block_size;
+};
+
+/**
+ * @struct iio_recorder_stats
+ * @brief IIO recorder counters
+ */
+struct iio_recorder_stats {
+	/** Bytes written to the file, without the header */
+	uint64_t data_bytes;
+	/** Blocks written to the file */
+	uint32_t blocks_written;
+	/** Times iio_recorder_fill() found both blocks waiting for a write */
+	uint32_t blocks_busy;
+};
+
+/**
+ * @struct iio_recorder
+ * @brief IIO recorder descriptor
+ */
+struct iio_recorder {
+	/** IIO descriptor */
+	struct iio_desc *iio_desc;
+	/** Device name */
+	const char *name;
+	/** IIO buffer of the device */
+	struct iio_buffer *buffer;
+	/** Recording file */
+	FIL file;
+	/** File header, rewritten on remove */
+	uint8_t *header;
+	/** Header size in bytes */
+	uint32_t header_size;
+	/** Blocks alternately filled from the IIO buffer and written */
+	uint8_t *block[2];
+	/** Size of a block in bytes */
+	uint32_t block_size;
+	/**
+	 * Set when a block is full and waits to be written. Only set by
+	 * iio_recorder_fill() and cleared by iio_recorder_write(), which may
+	 * run in different contexts, with release stores and acquire loads.
+	 */
+	volatile bool ready[2];
+	/** Block being filled */
+	uint8_t fill_idx;
+	/** Bytes in the block being filled */
+	uint32_t fill_len;
+	/** Next block to be written */
+	uint8_t write_idx;
+	/** Counters */
+	struct iio_recorder_stats stats;
+};
+
+/* Create the recording file and open the buffer of the IIO device. */
+int iio_recorder_init(struct iio_recorder **rec,
+		      const struct iio_recorder_init_param *param);
+/* Write the pending scans, update the header and close the file. */
+int iio_recorder_remove(struct iio_recorder *rec);
+/* Move the scans available in the IIO buffer to the block being filled. */
+int iio_recorder_fill(struct iio_recorder *rec);
+/* Write a full block to the file, if there is one. */
+int iio_recorder_write(struct iio_recorder *rec);
+/* Fill and write, for applications recording from the main loop. */
+int iio_recorder_step(struct iio_recorder *rec);
+
+#endif /* IIO_RECORDER_H_ */
@@ -37,6 +37,8 @@
 #include <stdint.h>
 #include "no_os_circular_buffer.h"
 
+struct no_os_timer_desc;
+
 enum iio_val {
 	IIO_VAL_INT = 1,
 	IIO_VAL_INT_PLUS_MICRO,
@@ -71,6 +73,7 @@ enum iio_chan_type {
 	IIO_DELTA_VELOCITY,
 	IIO_WEIGHT,
 	IIO_POWER,
+	IIO_TIMESTAMP,
 };
 
 /**
@@ -198,6 +201,23 @@ struct iio_cyclic_buffer_info {
 	uint32_t buff_index;
 };
 
+/**
+ * @struct iio_buffer_stats
+ * @brief Per buffer counters maintained by the IIO core. Reset on buffer open.
+ */
+struct iio_buffer_stats {
+	/** Number of scans written to the buffer */
+	uint32_t scans_pushed;
+	/** Number of unread scans overwritten in the circular buffer */
+	uint32_t scans_overrun;
+	/** Number of scans lost before reaching the buffer */
+	uint32_t scans_dropped;
+	/** Last hardware sample counter value, see iio_buffer_check_counter() */
+	uint32_t last_counter;
+	/** Set once last_counter holds a valid value */
+	bool counter_valid;
+};
+
 struct iio_buffer {
 	/* Mask with active channels */
 	uint32_t active_mask;
@@ -213,17 +233,37 @@ struct iio_buffer {
 	struct no_os_circular_buffer *buf;
 	/* Stores cyclic buffer specific information */
 	struct iio_cyclic_buffer_info cyclic_info;
+	/* Timer used to timestamp scans. NULL if timestamps are not supported */
+	struct no_os_timer_desc *timestamp_timer;
+	/* Set when the timestamp channel is part of the active scan */
+	bool timestamp_en;
+	/* Offset of the timestamp in a scan, in bytes */
+	uint32_t timestamp_offset;
+	/* Time of the trigger event being handled, 0 outside trigger handlers */
+	uint64_t trigger_timestamp;
+	/* Sample accounting */
+	struct iio_buffer_stats stats;
 };
 
 struct iio_device_data {
 	void *dev;
 	struct iio_buffer *buffer;
+	/* Number of trigger events handled by this trigger_handler call. Always
+	 * 1, except for deferred triggers, where firings are coalesced */
+	uint32_t events_pending;
 };
 
 struct iio_trigger {
 	/** If true the trigger handler will be called in interrupt context
 	 *  If false the handler will be called from iio_step */
 	bool is_synchronous;
+	/** If true, firings are only counted in interrupt context and the
+	 *  trigger handler is called from iio_step with the number of events
+	 *  pending since the last call. Takes precedence over is_synchronous */
+	bool is_deferred;
+	/** Maximum number of events passed to one trigger handler call in
+	 *  deferred mode. 0 for no limit */
+	uint32_t max_batch;
 	/** Array of attributes. Last one should have its name set to NULL */
 	struct iio_attribute *attributes;
 	/** Called when needs to be enabled */
@@ -506,27 +506,35 @@ static int32_t do_read_buff_delayed(struct iiod_desc *desc,
 {
 	struct iiod_ctx ctx = IIOD_CTX(desc, conn);
 	uint32_t max_to_read;
-	int32_t ret, len;
+	uint32_t len;
+	int32_t ret;
 
 	conn->nb_buf.buf = conn->payload_buf;
 	len = no_os_min(conn->payload_buf_len, conn->cmd_data.bytes_count);
-	max_to_read = len - conn->nb_buf.len;
-	ret = desc->ops.read_buffer(&ctx, conn->cmd_data.device,
-				    conn->nb_buf.buf + conn->nb_buf.len, max_to_read);
-	if (ret < 0)
-		return ret;
+	if (conn->nb_buf.len < len) {
+		max_to_read = len - conn->nb_buf.len;
+		ret = desc->ops.read_buffer(&ctx, conn->cmd_data.device,
+					    conn->nb_buf.buf + conn->nb_buf.len,
+					    max_to_read);
+		if (ret < 0)
+			return ret;
 
-	conn->nb_buf.len += ret;
+		conn->nb_buf.len += ret;
 
-	if (conn->nb_buf.len < conn->cmd_data.bytes_count)
-		return -EAGAIN;
+		/* Requests bigger than payload_buf are sent in full chunks */
+		if (conn->nb_buf.len < len)
+			return -EAGAIN;
+	}
 
 	ret = rw_iiod_buff(desc, conn, &conn->nb_buf, IIOD_WR);
 	if (ret < 0)
 		return ret;
 
+	conn->cmd_data.bytes_count -= conn->nb_buf.len;
 	conn->nb_buf.len = 0;
 	conn->nb_buf.idx = 0;
+	if (conn->cmd_data.bytes_count)
+		return -EAGAIN;
 
 	return 0;
 }
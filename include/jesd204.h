@@ -244,11 +244,18 @@ struct jesd204_topology_dev {
 	unsigned int		links_number;
 };
 
+/* no-OS specific */
+#define JESD204_FSM_MAX_WORKERS		8
+
 /* no-OS specific */
 struct jesd204_topology {
 	struct jesd204_dev_top		*dev_top;
 	struct jesd204_topology_dev	*devs;
 	unsigned int			devs_number;
+	/* Workers running the non-top devices of a link, 0 or 1 for serial */
+	unsigned int			nb_workers;
+	/* Time spent in each state by the last jesd204_fsm_start/stop, in us */
+	uint32_t			state_time_us[__JESD204_MAX_OPS];
 };
 
 /* no-OS specific */
@@ -266,6 +273,19 @@ int jesd204_topology_init(struct jesd204_topology **topology,
 /* no-OS specific */
 int jesd204_topology_remove(struct jesd204_topology *topology);
 
+/*
+ * no-OS specific
+ * Run the FSM on nb_workers threads, 0 or 1 for the serial FSM. The states,
+ * the links and the top device keep the serial order, but the non-top
+ * devices of the same link run each state concurrently. Their state ops must
+ * therefore not depend on each other within a state of a link, only across
+ * links and states, and must protect any data they share themselves:
+ * no_os_mutex_lock() is a no-op on some platforms, Linux included. Without
+ * no_os_thread and no_os_barrier support the FSM runs serially.
+ */
+int jesd204_topology_set_workers(struct jesd204_topology *topology,
+				 unsigned int nb_workers);
+
 /* no-OS specific */
 int jesd204_fsm_start(struct jesd204_topology *topology, unsigned int link_idx);
 
@@ -0,0 +1,101 @@
+/***************************************************************************//**
+ *   @file   no_os_bus_stats.h
+ *   @brief  Header file of the bus transfer statistics.
+********************************************************************************
+ * Copyright 2026(c) Analog Devices, Inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Analog Devices, Inc. nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ANALOG DEVICES, INC. “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL ANALOG DEVICES, INC. BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+#ifndef _NO_OS_BUS_STATS_H_
+#define _NO_OS_BUS_STATS_H_
+
+#include <stdint.h>
+
+struct no_os_timer_desc;
+
+/*
+ * Number of transfer time histogram bins. Bin 0 counts the transfers shorter
+ * than one timer tick, bin n the ones taking [2^(n-1), 2^n) ticks and the last
+ * bin all the longer ones.
+ */
+#define NO_OS_BUS_STATS_HIST_BINS	16
+
+/**
+ * @struct no_os_bus_stats
+ * @brief Transfer counters of a SPI/I2C bus or of a DMA channel
+ */
+struct no_os_bus_stats {
+	/** Number of transfers */
+	uint32_t xfers;
+	/** Transfers which returned an error */
+	uint32_t errors;
+	/** Bytes transferred */
+	uint64_t bytes;
+	/** Time spent waiting for the bus lock, in timer ticks */
+	uint64_t wait_ticks;
+	/** Longest wait for the bus lock, in timer ticks */
+	uint32_t max_wait_ticks;
+	/** Time spent transferring, in timer ticks */
+	uint64_t xfer_ticks;
+	/** Longest transfer, in timer ticks */
+	uint32_t max_xfer_ticks;
+	/** Transfer time histogram */
+	uint32_t hist[NO_OS_BUS_STATS_HIST_BINS];
+};
+
+#ifdef NO_OS_BUS_STATS
+
+/* Select the timestamp timer. With no timer only transfers are counted. */
+int no_os_bus_stats_set_timer(struct no_os_timer_desc *timer);
+/* Current timestamp, in timer ticks. */
+uint32_t no_os_bus_stats_now(void);
+/* Account a transfer which waited for the bus from start to locked. */
+void no_os_bus_stats_add(struct no_os_bus_stats *stats, uint32_t start,
+			 uint32_t locked, uint32_t bytes, int ret);
+/* Convert timer ticks to nanoseconds. */
+uint64_t no_os_bus_stats_ticks_to_ns(uint64_t ticks);
+/* Print the counters of a bus. */
+void no_os_bus_stats_dump(const char *name,
+			  const struct no_os_bus_stats *stats);
+
+#define NO_OS_BUS_STATS_STAMP(t)	((t) = no_os_bus_stats_now())
+#define NO_OS_BUS_STATS_ADD(stats, start, locked, bytes, ret)	\
+	no_os_bus_stats_add(stats, start, locked, bytes, ret)
+
+#else
+
+/* Compiled out, the stats member does not even exist in the descriptors. */
+#define NO_OS_BUS_STATS_STAMP(t)	((t) = 0)
+#define NO_OS_BUS_STATS_ADD(stats, start, locked, bytes, ret)	\
+	do {							\
+		(void)(start);					\
+		(void)(locked);					\
+	} while (0)
+
+#endif /* NO_OS_BUS_STATS */
+
+#endif /* _NO_OS_BUS_STATS_H_ */
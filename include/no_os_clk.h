@@ -35,6 +35,20 @@
 
 #include <stdint.h>
 
+/*
+ * Cache the rate until the clock or a parent is changed through no_os_clk.
+ * Providers which also change the rate internally must call
+ * no_os_clk_invalidate() when they do.
+ */
+#define NO_OS_CLK_F_CACHE_RATE		0x01
+/* The cached rate is valid. Managed by no_os_clk */
+#define NO_OS_CLK_F_RATE_VALID		0x02
+
+/* Maximum number of clocks changed by one transaction */
+#define NO_OS_CLK_TRANSACTION_SIZE	16
+
+struct no_os_clk_desc;
+
 struct no_os_clk_init_param {
 	/** Device name */
 	const char	*name;
@@ -44,6 +58,10 @@ struct no_os_clk_init_param {
 	const struct no_os_clk_platform_ops *platform_ops;
 	/**  CLK hardware device descriptor */
 	void		*dev_desc;
+	/** Parent clock. Optional */
+	struct no_os_clk_desc	*parent;
+	/** NO_OS_CLK_F_CACHE_RATE */
+	uint32_t	flags;
 };
 
 struct no_os_clk_hw {
@@ -75,8 +93,42 @@ typedef struct no_os_clk_desc {
 	const struct no_os_clk_platform_ops *platform_ops;
 	/**  CLK hardware device descriptor */
 	void		*dev_desc;
+	/** Parent clock, NULL for a root clock */
+	struct no_os_clk_desc	*parent;
+	/** First child clock */
+	struct no_os_clk_desc	*child;
+	/** Next clock with the same parent */
+	struct no_os_clk_desc	*sibling;
+	/** NO_OS_CLK_F_* flags */
+	uint32_t	flags;
+	/** Cached rate, valid when NO_OS_CLK_F_RATE_VALID is set */
+	uint64_t	rate;
 } no_os_clk_desc;
 
+/**
+ * @struct no_os_clk_rate_req
+ * @brief Rate change of one clock in a transaction
+ */
+struct no_os_clk_rate_req {
+	/** Clock to change */
+	struct no_os_clk_desc	*clk;
+	/** Requested rate */
+	uint64_t	rate;
+	/** Rate the clock will output, computed by the commit */
+	uint64_t	rounded_rate;
+};
+
+/**
+ * @struct no_os_clk_transaction
+ * @brief Set of rate changes computed first and programmed together
+ */
+struct no_os_clk_transaction {
+	/** Rate changes */
+	struct no_os_clk_rate_req	req[NO_OS_CLK_TRANSACTION_SIZE];
+	/** Number of rate changes */
+	uint32_t	nb_req;
+};
+
 /**
  * @struct no_os_clk_platform_ops
  * @brief Structure holding CLK function pointers that point to the platform
@@ -95,6 +147,8 @@ struct no_os_clk_platform_ops {
 	int (*clk_round_rate)(struct no_os_clk_desc *, uint64_t, uint64_t *);
 	/* Change CLK frequency function pointer. */
 	int (*clk_set_rate)(struct no_os_clk_desc *, uint64_t);
+	/* Change the frequency of several clocks of the same device. Optional */
+	int (*clk_set_rates)(struct no_os_clk_desc **, const uint64_t *, uint32_t);
 	/** CLK remove function pointer */
 	int (*remove)(struct no_os_clk_desc *);
 };
@@ -125,4 +179,25 @@ int32_t no_os_clk_round_rate(struct no_os_clk_desc *desc,
 int32_t no_os_clk_set_rate(struct no_os_clk_desc *desc,
 			   uint64_t rate);
 
+/* Link the clock to a new parent clock. */
+int32_t no_os_clk_set_parent(struct no_os_clk_desc *desc,
+			     struct no_os_clk_desc *parent);
+
+/* Get the parent of the clock. */
+struct no_os_clk_desc *no_os_clk_get_parent(struct no_os_clk_desc *desc);
+
+/* Drop the cached rate of the clock and of all its children. */
+void no_os_clk_invalidate(struct no_os_clk_desc *desc);
+
+/* Start an empty rate change transaction. */
+void no_os_clk_transaction_init(struct no_os_clk_transaction *tr);
+
+/* Add a rate change to the transaction. */
+int32_t no_os_clk_transaction_add(struct no_os_clk_transaction *tr,
+				  struct no_os_clk_desc *desc,
+				  uint64_t rate);
+
+/* Compute all the rates of the transaction, then program them. */
+int32_t no_os_clk_transaction_commit(struct no_os_clk_transaction *tr);
+
 #endif // _NO_OS_CLK_H_
@@ -36,5 +36,72 @@
 #include "no_os_crc8.h"
 #include "no_os_crc16.h"
 #include "no_os_crc24.h"
+#include <stdbool.h>
+
+/* Number of lookup tables of the engines declared with NO_OS_DECLARE_CRC_ENGINE */
+#ifndef NO_OS_CRC_DEFAULT_SLICES
+#define NO_OS_CRC_DEFAULT_SLICES	1
+#endif
+
+/* Buffers shorter than this are always computed with the lookup tables */
+#define NO_OS_CRC_CLMUL_MIN_BYTES	64
+
+/**
+ * @enum no_os_crc_impl
+ * @brief CRC engine implementation selection
+ */
+enum no_os_crc_impl {
+	/** Carry-less multiply folding when the CPU supports it, tables otherwise */
+	NO_OS_CRC_IMPL_AUTO,
+	/** Lookup tables only */
+	NO_OS_CRC_IMPL_TABLE,
+};
+
+/**
+ * @struct no_os_crc_engine
+ * @brief msb-first CRC engine for widths up to 24 bits
+ */
+struct no_os_crc_engine {
+	/** CRC width in bits, 1 to 24 */
+	uint8_t width;
+	/** msb-first representation of the polynomial, without the x^width term */
+	uint32_t polynomial;
+	/** Number of lookup tables: 1, 4 or 8 */
+	uint8_t nb_slices;
+	/** Implementation selection */
+	enum no_os_crc_impl impl;
+	/** Storage for the lookup tables, NO_OS_CRC_TABLE_WORDS() words */
+	uint32_t *table;
+	/** Set once no_os_crc_engine_setup() populated the tables */
+	bool ready;
+	/** Use carry-less multiply folding for long buffers */
+	bool clmul;
+	/** Folding constants x^(d + 64) and x^d mod P, for d = 128 .. 512 */
+	uint64_t fold[4][2];
+};
+
+#define NO_OS_CRC_TABLE_WORDS(_width, _nb_slices) \
+	((_nb_slices) * NO_OS_CRC8_TABLE_SIZE * \
+	 ((_width) <= 8 ? 1 : (_width) <= 16 ? 2 : 4) / 4)
+
+#define NO_OS_DECLARE_CRC_ENGINE_SLICES(_name, _width, _poly, _nb_slices) \
+	static uint32_t _name##_table[NO_OS_CRC_TABLE_WORDS(_width, _nb_slices)]; \
+	static struct no_os_crc_engine _name = { \
+		.width = _width, \
+		.polynomial = _poly, \
+		.nb_slices = _nb_slices, \
+		.impl = NO_OS_CRC_IMPL_AUTO, \
+		.table = _name##_table, \
+	}
+
+#define NO_OS_DECLARE_CRC_ENGINE(_name, _width, _poly) \
+	NO_OS_DECLARE_CRC_ENGINE_SLICES(_name, _width, _poly, \
+					NO_OS_CRC_DEFAULT_SLICES)
+
+/* Populate the tables and select the implementation of a CRC engine. */
+int no_os_crc_engine_setup(struct no_os_crc_engine *engine);
+/* Compute the CRC over a buffer, setting the engine up on first use. */
+uint32_t no_os_crc_compute(struct no_os_crc_engine *engine,
+			   const uint8_t *pdata, size_t nbytes, uint32_t crc);
 
 #endif // _NO_OS_CRC_H_
@@ -41,9 +41,17 @@
 #define NO_OS_DECLARE_CRC16_TABLE(_table) \
 	static uint16_t _table[NO_OS_CRC16_TABLE_SIZE]
 
+#define NO_OS_DECLARE_CRC16_SLICE_TABLE(_table, _nb_slices) \
+	static uint16_t _table[_nb_slices][NO_OS_CRC16_TABLE_SIZE]
+
 void no_os_crc16_populate_msb(uint16_t * table, const uint16_t polynomial);
 uint16_t no_os_crc16(const uint16_t * table, const uint8_t *pdata,
 		     size_t nbytes,
 		     uint16_t crc);
+void no_os_crc16_populate_slice_msb(uint16_t (*table)[NO_OS_CRC16_TABLE_SIZE],
+				    uint8_t nb_slices, const uint16_t polynomial);
+uint16_t no_os_crc16_slice(const uint16_t (*table)[NO_OS_CRC16_TABLE_SIZE],
+			   uint8_t nb_slices, const uint8_t *pdata, size_t nbytes,
+			   uint16_t crc);
 
 #endif // _NO_OS_CRC16_H_
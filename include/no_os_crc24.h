@@ -41,9 +41,17 @@
 #define NO_OS_DECLARE_CRC24_TABLE(_table) \
 	static uint32_t _table[NO_OS_CRC24_TABLE_SIZE]
 
+#define NO_OS_DECLARE_CRC24_SLICE_TABLE(_table, _nb_slices) \
+	static uint32_t _table[_nb_slices][NO_OS_CRC24_TABLE_SIZE]
+
 void no_os_crc24_populate_msb(uint32_t * table, const uint32_t polynomial);
 uint32_t no_os_crc24(const uint32_t * table, const uint8_t *pdata,
 		     size_t nbytes,
 		     uint32_t crc);
+void no_os_crc24_populate_slice_msb(uint32_t (*table)[NO_OS_CRC24_TABLE_SIZE],
+				    uint8_t nb_slices, const uint32_t polynomial);
+uint32_t no_os_crc24_slice(const uint32_t (*table)[NO_OS_CRC24_TABLE_SIZE],
+			   uint8_t nb_slices, const uint8_t *pdata, size_t nbytes,
+			   uint32_t crc);
 
 #endif // _NO_OS_CRC24_H_
@@ -0,0 +1,114 @@
+/***************************************************************************//**
+ *   @file   no_os_dds.h
+ *   @brief  Header file of the direct digital synthesis library.
+********************************************************************************
+ * Copyright 2026(c) Analog Devices, Inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Analog Devices, Inc. nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ANALOG DEVICES, INC. “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL ANALOG DEVICES, INC. BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+#ifndef _NO_OS_DDS_H_
+#define _NO_OS_DDS_H_
+
+#include <stdint.h>
+
+/* Address bits of the sine table */
+#define NO_OS_DDS_LUT_BITS		9
+/* Maximum number of channels generated by one DDS */
+#define NO_OS_DDS_MAX_CHANNELS		16
+/* Full scale amplitude, Q15 */
+#define NO_OS_DDS_FULL_SCALE		0x8000
+/* Phase accumulator value of a phase given in degrees */
+#define NO_OS_DDS_PHASE_DEG(deg)	\
+	((uint32_t)(((uint64_t)(deg) << 32) / 360))
+
+/**
+ * @struct no_os_dds_channel
+ * @brief Settings of a DDS channel
+ */
+struct no_os_dds_channel {
+	/** Phase added to the accumulator, 2^32 is a full period */
+	uint32_t phase_offset;
+	/** Amplitude, Q15. NO_OS_DDS_FULL_SCALE is the full table swing */
+	uint16_t amplitude;
+};
+
+/**
+ * @struct no_os_dds_init_param
+ * @brief DDS initialization parameters
+ */
+struct no_os_dds_init_param {
+	/** Phase increment per sample, see no_os_dds_tuning_word() */
+	uint32_t tuning_word;
+	/** Number of channels */
+	uint8_t nb_channels;
+	/** Channel settings */
+	struct no_os_dds_channel channels[NO_OS_DDS_MAX_CHANNELS];
+};
+
+/**
+ * @struct no_os_dds_desc
+ * @brief DDS descriptor
+ */
+struct no_os_dds_desc {
+	/** Phase increment per sample */
+	uint32_t tuning_word;
+	/** Phase accumulator */
+	uint32_t phase;
+	/** Number of channels */
+	uint8_t nb_channels;
+	/** Channel settings */
+	struct no_os_dds_channel channels[NO_OS_DDS_MAX_CHANNELS];
+	/**
+	 * no_os_sine_lut_16 entries in the low half word and the difference to
+	 * the next entry in the high half word, so one load per sample is
+	 * enough for the interpolation.
+	 */
+	int32_t lut[1 << NO_OS_DDS_LUT_BITS];
+};
+
+/* Compute the tuning word of a tone. */
+uint32_t no_os_dds_tuning_word(uint32_t freq_hz, uint32_t sample_rate_hz);
+
+/* Allocate a DDS. */
+int no_os_dds_init(struct no_os_dds_desc **desc,
+		   const struct no_os_dds_init_param *param);
+/* Free the resources allocated by no_os_dds_init(). */
+int no_os_dds_remove(struct no_os_dds_desc *desc);
+
+/* Change the tone frequency, keeping the phase continuous. */
+int no_os_dds_set_tuning_word(struct no_os_dds_desc *desc, uint32_t tuning_word);
+/* Change the phase offset and amplitude of a channel. */
+int no_os_dds_set_channel(struct no_os_dds_desc *desc, uint8_t ch,
+			  uint32_t phase_offset, uint16_t amplitude);
+/* Set the phase accumulator. */
+int no_os_dds_set_phase(struct no_os_dds_desc *desc, uint32_t phase);
+
+/* Generate nb_samples interleaved samples of each channel. */
+int no_os_dds_generate(struct no_os_dds_desc *desc, uint16_t *buf,
+		       uint32_t nb_samples);
+
+#endif /* _NO_OS_DDS_H_ */
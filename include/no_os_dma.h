@@ -41,6 +41,7 @@
 #include "no_os_list.h"
 #include "no_os_irq.h"
 #include "no_os_mutex.h"
+#include "no_os_bus_stats.h"
 
 /**
  * @enum no_os_dma_xfer_type
@@ -127,6 +128,13 @@ struct no_os_dma_ch {
 	 * even if it's free. Used as a synchronization mechanism between channels.
 	 */
 	bool sync_lock;
+#ifdef NO_OS_BUS_STATS
+	/** Transfer statistics, updated when a transfer of the list completes */
+	struct no_os_bus_stats stats;
+	/** Timestamps of the last no_os_dma_xfer_start() */
+	uint32_t stats_start;
+	uint32_t stats_locked;
+#endif
 };
 
 /**
@@ -227,6 +235,10 @@ bool no_os_dma_is_completed(struct no_os_dma_desc *, struct no_os_dma_ch *);
 /** Whether or not a specific channel has an ongoing transfer. */
 bool no_os_dma_in_progress(struct no_os_dma_desc *, struct no_os_dma_ch *);
 
+#ifdef NO_OS_BUS_STATS
+int no_os_dma_get_stats(struct no_os_dma_ch *, struct no_os_bus_stats *, bool);
+#endif
+
 /** Get a free DMA channel. */
 int no_os_dma_acquire_channel(struct no_os_dma_desc *, struct no_os_dma_ch **);
 
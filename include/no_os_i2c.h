@@ -35,6 +35,8 @@
 #define _NO_OS_I2C_H_
 
 #include <stdint.h>
+#include <stdbool.h>
+#include "no_os_bus_stats.h"
 
 #define I2C_MAX_BUS_NUMBER 4
 
@@ -79,6 +81,10 @@ struct no_os_i2cbus_desc {
 	const struct no_os_i2c_platform_ops *platform_ops;
 	/** I2C bus extra parameters (device specific parameters) */
 	void		*extra;
+#ifdef NO_OS_BUS_STATS
+	/** I2C bus transfer statistics */
+	struct no_os_bus_stats	stats;
+#endif
 };
 
 
@@ -143,4 +149,10 @@ int32_t no_os_i2cbus_init(const struct no_os_i2c_init_param *param);
 /* Free the resources allocated for I2C  bus desc*/
 void no_os_i2cbus_remove(uint32_t bus_number);
 
+#ifdef NO_OS_BUS_STATS
+/* Get the transfer statistics of an I2C bus and optionally clear them. */
+int32_t no_os_i2cbus_get_stats(uint32_t bus_number,
+			       struct no_os_bus_stats *stats, bool clear);
+#endif
+
 #endif // _NO_OS_I2C_H_
@@ -76,4 +76,48 @@ int no_os_pid_hysteresis(struct no_os_pid *pid, unsigned int hyst);
 int no_os_pid_reset(struct no_os_pid *pid);
 int no_os_pid_remove(struct no_os_pid *pid);
 
+/* Fractional bits of the no_os_pid_bank gains */
+#define NO_OS_PID_BANK_Q		16
+
+/**
+ * @struct no_os_pid_bank
+ * @brief Bank of PID controllers stepped together. The state of the loops is
+ * kept in per-field arrays so that one no_os_pid_bank_control() call walks
+ * each array once.
+ */
+struct no_os_pid_bank {
+	/** Number of controllers */
+	unsigned int nb_loops;
+	/** Outputs, on 64-bits to avoid overflow like no_os_pid */
+	int64_t *output;
+	/** Proportional gains, Q NO_OS_PID_BANK_Q */
+	int32_t *kp;
+	/** Integral gains, Q NO_OS_PID_BANK_Q */
+	int32_t *ki;
+	/** Derivative gains, Q NO_OS_PID_BANK_Q */
+	int32_t *kd;
+	/** Integral accumulators */
+	int32_t *iacc;
+	/** Derivative accumulators */
+	int32_t *dacc;
+	/** Hysteresis */
+	uint32_t *hysteresis;
+	/** Integral accumulator limits, full range when clipping is disabled */
+	int32_t *i_high;
+	int32_t *i_low;
+	/** Output limits, full range when clipping is disabled */
+	int64_t *o_high;
+	int64_t *o_low;
+};
+
+int no_os_pid_bank_init(struct no_os_pid_bank **bank,
+			const struct no_os_pid_config *configs,
+			unsigned int nb_loops);
+int no_os_pid_bank_control(struct no_os_pid_bank *bank, const int *SP,
+			   const int *PV, int *output);
+int no_os_pid_bank_hysteresis(struct no_os_pid_bank *bank, unsigned int loop,
+			      unsigned int hyst);
+int no_os_pid_bank_reset(struct no_os_pid_bank *bank);
+int no_os_pid_bank_remove(struct no_os_pid_bank *bank);
+
 #endif
@@ -0,0 +1,174 @@
+/***************************************************************************//**
+ *   @file   no_os_regmap.h
+ *   @brief  Header file of the cached register map library.
+********************************************************************************
+ * Copyright 2026(c) Analog Devices, Inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Analog Devices, Inc. nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ANALOG DEVICES, INC. “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL ANALOG DEVICES, INC. BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+#ifndef _NO_OS_REGMAP_H_
+#define _NO_OS_REGMAP_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * @enum no_os_regmap_cache_type
+ * @brief Register cache policy
+ */
+enum no_os_regmap_cache_type {
+	/** Every access goes to the bus */
+	NO_OS_REGMAP_CACHE_NONE,
+	/** Reads are served from the cache, writes go to the bus immediately */
+	NO_OS_REGMAP_CACHE_WRITE_THROUGH,
+	/** Writes only update the cache, no_os_regmap_sync() flushes them */
+	NO_OS_REGMAP_CACHE_WRITE_BACK,
+};
+
+/**
+ * @struct no_os_regmap_bus
+ * @brief Register access callbacks provided by the device driver
+ */
+struct no_os_regmap_bus {
+	/** Read one register from the device */
+	int (*reg_read)(void *ctx, uint32_t reg, uint32_t *val);
+	/** Write one register to the device */
+	int (*reg_write)(void *ctx, uint32_t reg, uint32_t val);
+	/** Write nb consecutive registers in a single transfer. Optional */
+	int (*bulk_write)(void *ctx, uint32_t reg, const uint32_t *vals,
+			  uint32_t nb);
+};
+
+/**
+ * @struct no_os_regmap_stats
+ * @brief Register map access counters
+ */
+struct no_os_regmap_stats {
+	/** Registers read from the device */
+	uint32_t bus_reads;
+	/** Single register writes issued to the device */
+	uint32_t bus_writes;
+	/** Bulk writes issued to the device */
+	uint32_t bursts;
+	/** Reads served from the cache */
+	uint32_t cache_hits;
+	/** Writes dropped because the cached value was already up to date */
+	uint32_t writes_skipped;
+};
+
+/**
+ * @struct no_os_regmap_init_param
+ * @brief Register map initialization parameters
+ */
+struct no_os_regmap_init_param {
+	/** Register access callbacks */
+	const struct no_os_regmap_bus *bus;
+	/** Driver context passed to the callbacks */
+	void *ctx;
+	/** Number of registers. Valid registers are 0 .. nb_regs - 1 */
+	uint32_t nb_regs;
+	/** Cache policy */
+	enum no_os_regmap_cache_type cache_type;
+	/** Maximum number of registers in a bulk write. 0 means no limit */
+	uint32_t max_burst;
+	/** Return true for registers which must not be cached. Optional */
+	bool (*volatile_reg)(void *ctx, uint32_t reg);
+};
+
+/**
+ * @struct no_os_regmap
+ * @brief Register map descriptor
+ */
+struct no_os_regmap {
+	/** Register access callbacks */
+	const struct no_os_regmap_bus *bus;
+	/** Driver context passed to the callbacks */
+	void *ctx;
+	/** Number of registers */
+	uint32_t nb_regs;
+	/** Cache policy */
+	enum no_os_regmap_cache_type cache_type;
+	/** Maximum number of registers in a bulk write */
+	uint32_t max_burst;
+	/** Cached register values */
+	uint32_t *cache;
+	/** Per register NO_OS_REGMAP_F_* flags */
+	uint8_t *flags;
+	/** Number of registers waiting to be written back */
+	uint32_t nb_dirty;
+	/** Access counters */
+	struct no_os_regmap_stats stats;
+};
+
+/* The cached value matches the device */
+#define NO_OS_REGMAP_F_VALID		0x01
+/* The cached value was not written to the device yet */
+#define NO_OS_REGMAP_F_DIRTY		0x02
+/* The register is never cached */
+#define NO_OS_REGMAP_F_VOLATILE		0x04
+
+/* Allocate a register map. */
+int no_os_regmap_init(struct no_os_regmap **map,
+		      const struct no_os_regmap_init_param *param);
+/* Free the resources allocated by no_os_regmap_init(). */
+int no_os_regmap_remove(struct no_os_regmap *map);
+
+/* Read a register, from the cache when possible. */
+int no_os_regmap_read(struct no_os_regmap *map, uint32_t reg, uint32_t *val);
+/* Write a register. */
+int no_os_regmap_write(struct no_os_regmap *map, uint32_t reg, uint32_t val);
+/* Read nb consecutive registers. */
+int no_os_regmap_bulk_read(struct no_os_regmap *map, uint32_t reg,
+			   uint32_t *vals, uint32_t nb);
+/* Write nb consecutive registers. */
+int no_os_regmap_bulk_write(struct no_os_regmap *map, uint32_t reg,
+			    const uint32_t *vals, uint32_t nb);
+/* Update the bits of a register selected by mask. val is already shifted. */
+int no_os_regmap_update_bits(struct no_os_regmap *map, uint32_t reg,
+			     uint32_t mask, uint32_t val);
+/* Read the field of a register selected by mask. */
+int no_os_regmap_field_read(struct no_os_regmap *map, uint32_t reg,
+			    uint32_t mask, uint32_t *val);
+/* Write the field of a register selected by mask. */
+int no_os_regmap_field_write(struct no_os_regmap *map, uint32_t reg,
+			     uint32_t mask, uint32_t val);
+
+/* Write all dirty registers to the device. */
+int no_os_regmap_sync(struct no_os_regmap *map);
+/* Change the cache policy, flushing dirty registers when leaving write-back. */
+int no_os_regmap_set_cache_type(struct no_os_regmap *map,
+				enum no_os_regmap_cache_type cache_type);
+/* Mark registers first .. last as unknown, for example after a reset. */
+void no_os_regmap_cache_invalidate(struct no_os_regmap *map, uint32_t first,
+				   uint32_t last);
+/* Mark a register as volatile or cacheable. */
+int no_os_regmap_set_volatile(struct no_os_regmap *map, uint32_t reg,
+			      bool is_volatile);
+/* Check if a register bypasses the cache. */
+bool no_os_regmap_is_volatile(struct no_os_regmap *map, uint32_t reg);
+
+#endif /* _NO_OS_REGMAP_H_ */
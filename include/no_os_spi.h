@@ -35,6 +35,8 @@
 #define _NO_OS_SPI_H_
 
 #include <stdint.h>
+#include <stdbool.h>
+#include "no_os_bus_stats.h"
 
 #define	NO_OS_SPI_CPHA	0x01
 #define	NO_OS_SPI_CPOL	0x02
@@ -171,6 +173,10 @@ struct no_os_spibus_desc {
 	const struct no_os_spi_platform_ops *platform_ops;
 	/** SPI bus extra */
 	void		*extra;
+#ifdef NO_OS_BUS_STATS
+	/** SPI bus transfer statistics */
+	struct no_os_bus_stats	stats;
+#endif
 };
 
 /**
@@ -271,5 +277,11 @@ int32_t no_os_spibus_init(const struct no_os_spi_init_param *param);
 /* Free the resources allocated for SPI bus desc*/
 void no_os_spibus_remove(uint32_t bus_number);
 
+#ifdef NO_OS_BUS_STATS
+/* Get the transfer statistics of a SPI bus and optionally clear them. */
+int32_t no_os_spibus_get_stats(uint32_t bus_number,
+			       struct no_os_bus_stats *stats, bool clear);
+#endif
+
 
 #endif // _NO_OS_SPI_H_
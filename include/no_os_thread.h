@@ -0,0 +1,54 @@
+/***************************************************************************//**
+ *   @file   no_os_thread.h
+ *   @brief  Header file of the no-OS thread functionality.
+********************************************************************************
+ * Copyright 2026(c) Analog Devices, Inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Analog Devices, Inc. nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ANALOG DEVICES, INC. “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL ANALOG DEVICES, INC. BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+#ifndef _NO_OS_THREAD_H_
+#define _NO_OS_THREAD_H_
+
+/* Start a thread running func(arg). */
+int no_os_thread_create(void **thread, void (*func)(void *), void *arg);
+
+/* Wait for the thread to return and free its resources. */
+int no_os_thread_join(void *thread);
+
+/* Create a barrier released each time nb threads wait on it. */
+int no_os_barrier_init(void **barrier, unsigned int nb);
+
+/* Wait until nb threads reached the barrier. */
+int no_os_barrier_wait(void *barrier);
+
+/* Release the current and future waiters with -ECANCELED. */
+int no_os_barrier_abort(void *barrier);
+
+/* Free the resources allocated by no_os_barrier_init(). */
+int no_os_barrier_remove(void *barrier);
+
+#endif // _NO_OS_THREAD_H_
@@ -0,0 +1,67 @@
+/***************************************************************************//**
+ *   @file   no_os_unpack.h
+ *   @brief  Header file of the packed sample unpacking library.
+********************************************************************************
+ * Copyright 2026(c) Analog Devices, Inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Analog Devices, Inc. nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ANALOG DEVICES, INC. “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL ANALOG DEVICES, INC. BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+#ifndef _NO_OS_UNPACK_H_
+#define _NO_OS_UNPACK_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * @struct no_os_unpack_fmt
+ * @brief Layout of the words of a packed sample stream
+ *
+ * Words which are not a multiple of 8 bits are packed back to back, MSB
+ * first, as shifted out by most converters. Byte aligned words may be big or
+ * little endian.
+ */
+struct no_os_unpack_fmt {
+	/** Packed word size in bits, 1 to 32 */
+	uint8_t word_bits;
+	/** Sample size in bits, 1 to word_bits - shift */
+	uint8_t data_bits;
+	/** Position of the sample LSB in the word, lower (status) bits are dropped */
+	uint8_t shift;
+	/** Byte aligned words are little endian instead of big endian */
+	bool little_endian;
+	/** Sign extend the samples */
+	bool is_signed;
+};
+
+/* Unpack nb_samples words from src into dst. */
+int no_os_unpack_s32(const struct no_os_unpack_fmt *fmt, const uint8_t *src,
+		     uint32_t nb_samples, int32_t *dst);
+/* Unpack nb_samples words of at most 16 data bits from src into dst. */
+int no_os_unpack_s16(const struct no_os_unpack_fmt *fmt, const uint8_t *src,
+		     uint32_t nb_samples, int16_t *dst);
+
+#endif /* _NO_OS_UNPACK_H_ */
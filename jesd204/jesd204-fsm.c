@@ -5,20 +5,286 @@
  */
 
 #include "no_os_error.h"
+#include "no_os_alloc.h"
+#include "no_os_delay.h"
+#include "no_os_thread.h"
+#include "no_os_util.h"
 #include "jesd204-priv.h"
 
+/* no-OS specific */
+struct jesd204_fsm_pool {
+	struct jesd204_topology		*topology;
+	void				*barrier;
+	bool				*per_device_op_done;
+	unsigned int			nb_workers;
+};
+
+/* no-OS specific */
+struct jesd204_fsm_job {
+	struct jesd204_fsm_pool		*pool;
+	/* Index of the worker, 0 is the caller which also runs the top device */
+	unsigned int			first;
+};
+
+/* no-OS specific */
+static uint32_t jesd204_fsm_elapsed_us(struct no_os_time start)
+{
+	struct no_os_time now = no_os_get_time();
+
+	return (now.s - start.s) * 1000000 + now.us - start.us;
+}
+
+/* no-OS specific */
+static unsigned int jesd204_fsm_job_dev(struct jesd204_fsm_job *job,
+					unsigned int i, bool reverse)
+{
+	return reverse ? job->pool->topology->devs_number - 1 - i : i;
+}
+
+/* no-OS specific */
+static void jesd204_fsm_job_reset(struct jesd204_fsm_job *job)
+{
+	struct jesd204_fsm_pool *pool = job->pool;
+	unsigned int i;
+
+	for (i = job->first; i < pool->topology->devs_number; i += pool->nb_workers)
+		pool->per_device_op_done[i] = false;
+}
+
+/*
+ * no-OS specific
+ * Run one state of the worker's devices for one link, in the order of the
+ * serial FSM. Each device belongs to a single worker, so its
+ * per_device_op_done entry is only accessed by that worker.
+ */
+static void jesd204_fsm_job_run_link(struct jesd204_fsm_job *job,
+				     enum jesd204_dev_op op,
+				     enum jesd204_state_op_reason reason,
+				     unsigned int lnk_id, bool reverse)
+{
+	struct jesd204_fsm_pool *pool = job->pool;
+	struct jesd204_topology *topology = pool->topology;
+	struct jesd204_dev_top *jdev_top = topology->dev_top;
+	const struct jesd204_state_op *state_op;
+	struct jesd204_topology_dev *tdev;
+	unsigned int lnk_dev;
+	unsigned int dev;
+	unsigned int i, j;
+
+	for (i = job->first; i < topology->devs_number; i += pool->nb_workers) {
+		dev = jesd204_fsm_job_dev(job, i, reverse);
+		tdev = &topology->devs[dev];
+		state_op = &tdev->jdev->dev_data->state_ops[op];
+
+		for (j = 0; j < tdev->links_number; j++) {
+			lnk_dev = reverse ? tdev->links_number - 1 - j : j;
+			if (tdev->link_ids[lnk_dev] != jdev_top->link_ids[lnk_id])
+				continue;
+
+			if (state_op->per_device && !pool->per_device_op_done[i]) {
+				state_op->per_device(tdev->jdev, reason);
+				pool->per_device_op_done[i] = true;
+			}
+			if (state_op->per_link)
+				state_op->per_link(tdev->jdev, reason,
+						   &jdev_top->active_links[lnk_id].link);
+		}
+	}
+}
+
+/*
+ * no-OS specific
+ * Parallel jesd204_fsm_start(). States and links keep the serial order; for
+ * each link, the workers run the link's devices concurrently and meet on the
+ * barrier, then the caller (worker 0) runs the top device alone.
+ */
+static void jesd204_fsm_start_worker(void *arg)
+{
+	enum jesd204_state_op_reason reason = JESD204_STATE_OP_REASON_INIT;
+	struct jesd204_fsm_job *job = arg;
+	struct jesd204_fsm_pool *pool = job->pool;
+	struct jesd204_dev_top *jdev_top = pool->topology->dev_top;
+	const struct jesd204_state_op *state_op;
+	struct no_os_time start;
+	enum jesd204_dev_op op;
+	bool top = !job->first;
+	unsigned int lnk_id;
+
+	/* Nothing runs before all the workers are started. */
+	if (no_os_barrier_wait(pool->barrier))
+		return;
+
+	for (op = 0; op < __JESD204_MAX_OPS; op++) {
+		start = no_os_get_time();
+		state_op = &jdev_top->jdev->dev_data->state_ops[op];
+		jesd204_fsm_job_reset(job);
+
+		for (lnk_id = 0; lnk_id < jdev_top->num_links; lnk_id++) {
+			jesd204_fsm_job_run_link(job, op, reason, lnk_id, false);
+			if (no_os_barrier_wait(pool->barrier))
+				return;
+
+			if (top && state_op->per_link) {
+				state_op->per_link(jdev_top->jdev, reason,
+						   &jdev_top->active_links[lnk_id].link);
+				if (state_op->post_state_sysref)
+					jesd204_sysref_async(jdev_top->jdev);
+			}
+			if (no_os_barrier_wait(pool->barrier))
+				return;
+		}
+
+		if (top) {
+			if (state_op->per_device) {
+				state_op->per_device(jdev_top->jdev, reason);
+				if (state_op->post_state_sysref)
+					jesd204_sysref_async(jdev_top->jdev);
+			}
+			pool->topology->state_time_us[op] = jesd204_fsm_elapsed_us(start);
+		}
+		if (no_os_barrier_wait(pool->barrier))
+			return;
+	}
+}
+
+/*
+ * no-OS specific
+ * Parallel jesd204_fsm_stop(): the reverse of jesd204_fsm_start_worker(), the
+ * top device runs first for each link, then the link's devices.
+ */
+static void jesd204_fsm_stop_worker(void *arg)
+{
+	enum jesd204_state_op_reason reason = JESD204_STATE_OP_REASON_UNINIT;
+	struct jesd204_fsm_job *job = arg;
+	struct jesd204_fsm_pool *pool = job->pool;
+	struct jesd204_dev_top *jdev_top = pool->topology->dev_top;
+	const struct jesd204_state_op *state_op;
+	struct no_os_time start;
+	bool top = !job->first;
+	int lnk_id;
+	int op;
+
+	if (no_os_barrier_wait(pool->barrier))
+		return;
+
+	for (op = __JESD204_MAX_OPS - 1; op >= 0; op--) {
+		start = no_os_get_time();
+		state_op = &jdev_top->jdev->dev_data->state_ops[op];
+		jesd204_fsm_job_reset(job);
+
+		if (top && state_op->per_device)
+			state_op->per_device(jdev_top->jdev, reason);
+
+		for (lnk_id = jdev_top->num_links - 1; lnk_id >= 0; lnk_id--) {
+			if (top && state_op->per_link)
+				state_op->per_link(jdev_top->jdev, reason,
+						   &jdev_top->active_links[lnk_id].link);
+			if (no_os_barrier_wait(pool->barrier))
+				return;
+
+			jesd204_fsm_job_run_link(job, op, reason, lnk_id, true);
+			if (no_os_barrier_wait(pool->barrier))
+				return;
+		}
+
+		if (top)
+			pool->topology->state_time_us[op] = jesd204_fsm_elapsed_us(start);
+	}
+}
+
+/*
+ * no-OS specific
+ * Start the workers once for the whole FSM run and run worker 0 in the
+ * caller. If any of them cannot be started, the others are released through
+ * the barrier before running any state op and the error is returned, so the
+ * caller can run the serial FSM instead.
+ */
+static int jesd204_fsm_run_pool(struct jesd204_topology *topology,
+				void (*worker)(void *))
+{
+	struct jesd204_fsm_job jobs[JESD204_FSM_MAX_WORKERS];
+	void *threads[JESD204_FSM_MAX_WORKERS] = {0};
+	struct jesd204_fsm_pool pool = {
+		.topology = topology,
+	};
+	unsigned int w;
+	int ret;
+
+	pool.nb_workers = no_os_min(topology->nb_workers, topology->devs_number);
+	pool.nb_workers = no_os_min(pool.nb_workers, JESD204_FSM_MAX_WORKERS);
+	if (pool.nb_workers < 2)
+		return -ENOSYS;
+
+	pool.per_device_op_done = no_os_calloc(topology->devs_number,
+					       sizeof(*pool.per_device_op_done));
+	if (!pool.per_device_op_done)
+		return -ENOMEM;
+
+	ret = no_os_barrier_init(&pool.barrier, pool.nb_workers);
+	if (ret)
+		goto free_done;
+
+	for (w = 0; w < pool.nb_workers; w++) {
+		jobs[w].pool = &pool;
+		jobs[w].first = w;
+	}
+
+	for (w = 1; w < pool.nb_workers; w++) {
+		ret = no_os_thread_create(&threads[w], worker, &jobs[w]);
+		if (ret)
+			break;
+	}
+
+	if (ret)
+		no_os_barrier_abort(pool.barrier);
+	else
+		worker(&jobs[0]);
+
+	for (w = 1; w < pool.nb_workers && threads[w]; w++)
+		no_os_thread_join(threads[w]);
+
+	no_os_barrier_remove(pool.barrier);
+free_done:
+	no_os_free(pool.per_device_op_done);
+
+	return ret;
+}
+
+/* no-OS specific */
+int jesd204_topology_set_workers(struct jesd204_topology *topology,
+				 unsigned int nb_workers)
+{
+	if (!topology || nb_workers > JESD204_FSM_MAX_WORKERS)
+		return -EINVAL;
+
+	topology->nb_workers = nb_workers;
+
+	return 0;
+}
+
 /* no-OS specific */
 int jesd204_fsm_start(struct jesd204_topology *topology, unsigned int link_idx)
 {
 	enum jesd204_state_op_reason reason = JESD204_STATE_OP_REASON_INIT;
 	struct jesd204_dev_top *jdev_top = topology->dev_top;
-	bool per_device_op_done[16];
+	struct no_os_time start;
+	bool *per_device_op_done;
 	enum jesd204_dev_op op;
 	int lnk_dev;
 	int lnk_id;
 	int dev;
 
+	if (topology->nb_workers > 1 &&
+	    !jesd204_fsm_run_pool(topology, jesd204_fsm_start_worker))
+		return 0;
+
+	per_device_op_done = no_os_calloc(topology->devs_number + 1,
+					  sizeof(*per_device_op_done));
+	if (!per_device_op_done)
+		return -ENOMEM;
+
 	for (op = 0; op < __JESD204_MAX_OPS; op++) {
+		start = no_os_get_time();
 		for (dev = 0; dev < topology->devs_number; dev++)
 			per_device_op_done[dev] = false;
 
@@ -51,8 +317,11 @@ int jesd204_fsm_start(struct jesd204_topology *topology, unsigned int link_idx)
 			if (jdev_top->jdev->dev_data->state_ops[op].post_state_sysref)
 				jesd204_sysref_async(jdev_top->jdev);
 		}
+		topology->state_time_us[op] = jesd204_fsm_elapsed_us(start);
 	}
 
+	no_os_free(per_device_op_done);
+
 	return 0;
 }
 
@@ -61,13 +330,24 @@ int jesd204_fsm_stop(struct jesd204_topology *topology, unsigned int link_idx)
 {
 	enum jesd204_state_op_reason reason = JESD204_STATE_OP_REASON_UNINIT;
 	struct jesd204_dev_top *jdev_top = topology->dev_top;
-	bool per_device_op_done[16];
+	struct no_os_time start;
+	bool *per_device_op_done;
 	int lnk_dev;
 	int lnk_id;
 	int dev;
 	int op;
 
+	if (topology->nb_workers > 1 &&
+	    !jesd204_fsm_run_pool(topology, jesd204_fsm_stop_worker))
+		return 0;
+
+	per_device_op_done = no_os_calloc(topology->devs_number + 1,
+					  sizeof(*per_device_op_done));
+	if (!per_device_op_done)
+		return -ENOMEM;
+
 	for (op = __JESD204_MAX_OPS - 1; op >= 0; op--) {
+		start = no_os_get_time();
 		for (dev = topology->devs_number - 1; dev >= 0 ; dev--)
 			per_device_op_done[dev] = false;
 
@@ -95,7 +375,10 @@ int jesd204_fsm_stop(struct jesd204_topology *topology, unsigned int link_idx)
 				}
 			}
 		}
+		topology->state_time_us[op] = jesd204_fsm_elapsed_us(start);
 	}
 
+	no_os_free(per_device_op_done);
+
 	return 0;
 }
@@ -150,7 +150,11 @@ DRESULT disk_ioctl (
 	switch(pdrv) {
 	case DEV_SD:
 		switch (cmd){
-		case CTRL_SYNC: return RES_OK;
+		case CTRL_SYNC:
+			/* Commit the blocks of the open streaming write */
+			if (0 != sd_stream_close(sd_desc))
+				return RES_ERROR;
+			return RES_OK;
 		case GET_SECTOR_COUNT:
 			*(LBA_t *)buff = sd_desc->memory_size / DATA_BLOCK_LEN;
 			return RES_OK;
@@ -206,7 +210,16 @@ DRESULT SD_disk_write(BYTE *buff, LBA_t sector, UINT count)
 {
 	if (!sd_init_var)
 		return RES_NOTRDY;
-	if (0 != sd_write(sd_desc, buff, (uint64_t)sector * 512, (uint64_t)count * 512))
+	/*
+	 * Sequential writes continue the open multiple block write, so the
+	 * card is not given a new command for every cluster. A new session
+	 * pre-erases the blocks of the first write.
+	 */
+	if (sd_desc->stream_state == SD_STREAM_CLOSED ||
+	    sd_desc->stream_next != sector)
+		if (0 != sd_stream_open(sd_desc, (uint64_t)sector * 512, count))
+			return RES_ERROR;
+	if (0 != sd_stream_write(sd_desc, buff, count))
 		return RES_ERROR;
 
 	return RES_OK;
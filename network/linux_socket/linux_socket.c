@@ -128,7 +128,8 @@ static int32_t linux_socket_send(void *desc, uint32_t sock_id,
 	if (ret < 0)
 		return -errno;
 
-	return size;
+	/* The socket is non-blocking, the caller retries the rest */
+	return ret;
 }
 
 /** @brief See \ref network_interface.socket_recv */
@@ -241,12 +242,18 @@ static int32_t linux_socket_accept(void *desc, uint32_t sock_id,
 				   uint32_t *client_socket_id)
 {
 	int32_t ret;
+	int one = 1;
 
 	ret = accept4(sock_id, NULL, NULL, SOCK_NONBLOCK);
 
 	if (ret < 0)
 		return -errno;
 
+	/*
+	 * Replies are written in several small sends, don't let Nagle hold
+	 * them until the peer's delayed ACK.
+	 */
+	setsockopt(ret, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
 	*client_socket_id = ret;
 
 	return 0;
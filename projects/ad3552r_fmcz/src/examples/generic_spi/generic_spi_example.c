@@ -39,6 +39,7 @@
 #include "no_os_gpio.h"
 #include "no_os_util.h"
 #include "no_os_delay.h"
+#include "no_os_dds.h"
 #include "xilinx_spi.h"
 #include "xilinx_gpio.h"
 #include "ad3552r.h"
@@ -134,35 +135,54 @@ void set_power_up_success_led()
 	no_os_gpio_remove(gpio);
 }
 
-extern const uint16_t no_os_sine_lut_16[512];
+/* Samples generated at once by the DDS */
+#define EXAMPLE_BLOCK_SAMPLES	32
 
 int32_t run_example(struct ad3552r_desc *dac)
 {
 	const uint32_t time_between_samples_us = 100;
-	uint32_t nb_samples, i;
-	uint16_t samples[2];
+	/* 512 samples per period, channel 1 in phase opposition */
+	struct no_os_dds_init_param dds_param = {
+		.tuning_word = 1 << (32 - NO_OS_DDS_LUT_BITS),
+		.nb_channels = 2,
+		.channels = {
+			{0, NO_OS_DDS_FULL_SCALE},
+			{NO_OS_DDS_PHASE_DEG(180), NO_OS_DDS_FULL_SCALE},
+		},
+	};
+	uint16_t samples[EXAMPLE_BLOCK_SAMPLES * 2];
+	struct no_os_dds_desc *dds;
+	uint32_t i;
 	int32_t err;
 
-	nb_samples = NO_OS_ARRAY_SIZE(no_os_sine_lut_16);
+	err = no_os_dds_init(&dds, &dds_param);
+	if (NO_OS_IS_ERR_VALUE(err))
+		return err;
 
-	pr_debug("sending syn wave, %ld samples per period\n", nb_samples * 2);
+	pr_debug("sending syn wave, %d samples per period\n",
+		 1 << NO_OS_DDS_LUT_BITS);
 
-	i = 0;
+	i = EXAMPLE_BLOCK_SAMPLES;
 	do {
-		samples[0] = no_os_sine_lut_16[i];
-		samples[1] = no_os_sine_lut_16[(i + nb_samples / 2) % nb_samples];
-		err = ad3552r_write_samples(dac, samples, 1,
+		if (i == EXAMPLE_BLOCK_SAMPLES) {
+			no_os_dds_generate(dds, samples, EXAMPLE_BLOCK_SAMPLES);
+			i = 0;
+		}
+
+		err = ad3552r_write_samples(dac, &samples[i * 2], 1,
 					    AD3552R_MASK_ALL_CH,
 					    AD3552R_WRITE_INPUT_REGS);
 		if (NO_OS_IS_ERR_VALUE(err))
-			return err;
+			break;
 
 		no_os_udelay(time_between_samples_us);
 
-		i = (i + 1) % nb_samples;
+		i++;
 		err = ad3552r_ldac_trigger(dac, AD3552R_MASK_ALL_CH, false);
 	} while (!NO_OS_IS_ERR_VALUE(err));
 
+	no_os_dds_remove(dds);
+
 	return err;
 }
 
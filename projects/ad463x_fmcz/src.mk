@@ -23,6 +23,7 @@ INCS +=	$(PLATFORM_DRIVERS)/$(PLATFORM)_spi.h \
 	$(PLATFORM_DRIVERS)/$(PLATFORM)_gpio.h
 
 SRCS += $(NO-OS)/util/no_os_util.c \
+	$(NO-OS)/util/no_os_unpack.c \
 	$(NO-OS)/util/no_os_alloc.c \
 	$(NO-OS)/util/no_os_mutex.c \
 	$(NO-OS)/util/no_os_circular_buffer.c \
@@ -18,6 +18,11 @@ SRCS +=	$(PLATFORM_DRIVERS)/xilinx_axi_io.c \
 	$(PLATFORM_DRIVERS)/xilinx_spi.c \
 	$(PLATFORM_DRIVERS)/xilinx_delay.c \
 	$(NO-OS)/util/no_os_util.c \
+	$(NO-OS)/util/no_os_regmap.c \
+	$(NO-OS)/util/no_os_crc.c \
+	$(NO-OS)/util/no_os_crc8.c \
+	$(NO-OS)/util/no_os_crc16.c \
+	$(NO-OS)/util/no_os_crc24.c \
 	$(NO-OS)/util/no_os_alloc.c \
 	$(NO-OS)/util/no_os_mutex.c
 INCS += $(DRIVERS)/adc/ad7124/ad7124.h \
@@ -36,5 +41,10 @@ INCS +=	$(INCLUDE)/no_os_axi_io.h \
 	$(INCLUDE)/no_os_uart.h \
 	$(INCLUDE)/no_os_lf256fifo.h \
 	$(INCLUDE)/no_os_util.h \
+	$(INCLUDE)/no_os_crc.h \
+	$(INCLUDE)/no_os_crc8.h \
+	$(INCLUDE)/no_os_crc16.h \
+	$(INCLUDE)/no_os_crc24.h \
+	$(INCLUDE)/no_os_regmap.h \
 	$(INCLUDE)/no_os_alloc.h \
 	$(INCLUDE)/no_os_mutex.h
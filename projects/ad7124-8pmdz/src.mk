@@ -11,6 +11,11 @@ SRCS += $(NO-OS)/drivers/adc/ad7124/ad7124.c \
 	$(DRIVERS)/api/no_os_uart.c \
 	$(DRIVERS)/api/no_os_irq.c
 
+ifeq (y,$(strip $(IIO_TRIGGER)))
+CFLAGS += -DIIO_TRIGGER
+SRCS += $(NO-OS)/drivers/adc/ad7124/iio_ad7124_trig.c
+endif
+
 # Add to INCS inlcude files to be build in the porject
 INCS += $(NO-OS)/drivers/adc/ad7124/ad7124.h \
 	$(NO-OS)/drivers/adc/ad7124/iio_ad7124.h
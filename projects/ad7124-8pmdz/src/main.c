@@ -40,6 +40,9 @@
 #include "ad7124_regs.h"
 #include "iio_app.h"
 #include "parameters.h"
+#ifdef IIO_TRIGGER
+#include "iio_trigger.h"
+#endif
 
 #include <sys/platform.h>
 #include "adi_initialize.h"
@@ -154,10 +157,53 @@ int main(void)
 	if (status < 0)
 		return status;
 
+#ifdef IIO_TRIGGER
+	/* DOUT/RDY trigger, the device is captured in continuous read mode. */
+	struct iio_hw_trig *ad7124_trig_desc;
+	struct iio_hw_trig_init_param ad7124_gpio_trig_ip = {
+		.irq_id = AD7124_GPIO_TRIG_IRQ_ID,
+		.irq_trig_lvl = NO_OS_IRQ_EDGE_FALLING,
+		.cb_info = {
+			.event = NO_OS_EVT_GPIO,
+			.peripheral = NO_OS_GPIO_IRQ,
+		},
+		.name = AD7124_GPIO_TRIG_NAME,
+	};
+
+	irq_init_param = (struct no_os_irq_init_param) {
+		.irq_ctrl_id = GPIO_IRQ_ID,
+		.platform_ops = GPIO_IRQ_OPS,
+	};
+
+	status = no_os_irq_ctrl_init(&irq_desc, &irq_init_param);
+	if (status)
+		return status;
+
+	ad7124_gpio_trig_ip.irq_ctrl = irq_desc;
+
+	status = iio_hw_trig_init(&ad7124_trig_desc, &ad7124_gpio_trig_ip);
+	if (status)
+		return status;
+
+	struct iio_trigger_init trigs[] = {
+		IIO_APP_TRIGGER(AD7124_GPIO_TRIG_NAME, ad7124_trig_desc,
+				&ad7124_iio_trig_desc)
+	};
+
+	struct iio_app_device devices[] = {
+		IIO_APP_DEVICE("ad7124-8", ad7124_device, &iio_ad7124_trig_device,
+			       &iio_ad7124_read_buff, NULL, "trigger0")
+	};
+
+	app_init_param.trigs = trigs;
+	app_init_param.nb_trigs = NO_OS_ARRAY_SIZE(trigs);
+	app_init_param.irq_desc = irq_desc;
+#else
 	struct iio_app_device devices[] = {
 		IIO_APP_DEVICE("ad7124-8", ad7124_device, &iio_ad7124_device,
 			       &iio_ad7124_read_buff, NULL, NULL)
 	};
+#endif
 
 	app_init_param.devices = devices;
 	app_init_param.nb_devices = NUMBER_OF_DEVICES;
@@ -167,6 +213,10 @@ int main(void)
 	if (status)
 		return status;
 
+#ifdef IIO_TRIGGER
+	ad7124_trig_desc->iio_desc = app->iio_desc;
+#endif
+
 	return iio_app_run(app);
 }
 
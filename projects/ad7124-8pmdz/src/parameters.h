@@ -86,6 +86,17 @@
 #define UART_BAUDRATE	115200
 #define UART_OPS        &aducm_uart_ops
 
+#ifdef IIO_TRIGGER
+#include "aducm3029_gpio_irq.h"
+
+#define GPIO_IRQ_ID		ADUCM_XINT_SOFT_CTRL
+#define GPIO_IRQ_OPS		&aducm_gpio_irq_ops
+/* The PMOD has no separate RDY line: DOUT/RDY must also be wired to XINT1
+ * (pin 16 of EVAL-ADICUP3029) and CS held low while capturing. */
+#define AD7124_GPIO_TRIG_IRQ_ID	ADI_XINT_EVENT_INT1
+#define AD7124_GPIO_TRIG_NAME	"ad7124-8-dev0"
+#endif
+
 #endif //ADUCM_PLATFORM
 
 #define WIFI_SSID	"RouterSSID"
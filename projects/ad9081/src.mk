@@ -39,6 +39,7 @@ SRCS += $(PROJECT)/src/app.c \
 	$(NO-OS)/util/no_os_util.c \
 	$(NO-OS)/util/no_os_alloc.c \
 	$(NO-OS)/util/no_os_mutex.c \
+	$(NO-OS)/util/no_os_thread.c \
 	$(NO-OS)/jesd204/jesd204-core.c \
 	$(NO-OS)/jesd204/jesd204-fsm.c
 ifeq (y,$(strip $(QUAD_MXFE)))
@@ -102,6 +103,7 @@ INCS +=	$(PROJECT)/src/app_clock.h \
 	$(INCLUDE)/no_os_alloc.h \
 	$(INCLUDE)/no_os_uart.h \
 	$(INCLUDE)/no_os_mutex.h \
+	$(INCLUDE)/no_os_thread.h \
 	$(INCLUDE)/no_os_lf256fifo.h \
 	$(INCLUDE)/jesd204.h \
 	$(NO-OS)/jesd204/jesd204-priv.h
@@ -32,6 +32,7 @@ SRCS += $(DRIVERS)/axi_core/axi_adc_core/axi_adc_core.c \
         $(NO-OS)/util/no_os_util.c \
         $(NO-OS)/util/no_os_alloc.c \
 	$(NO-OS)/util/no_os_mutex.c \
+	$(NO-OS)/util/no_os_thread.c \
 	$(NO-OS)/jesd204/jesd204-core.c \
 	$(NO-OS)/jesd204/jesd204-fsm.c
 ifeq (y,$(strip $(IIOD)))
@@ -71,6 +72,7 @@ INCS +=	$(INCLUDE)/no_os_axi_io.h \
         $(INCLUDE)/no_os_print_log.h \
         $(INCLUDE)/no_os_alloc.h \
         $(INCLUDE)/no_os_mutex.h \
+        $(INCLUDE)/no_os_thread.h \
 	$(INCLUDE)/jesd204.h \
 	$(NO-OS)/jesd204/jesd204-priv.h
 ifeq (y,$(strip $(IIOD)))
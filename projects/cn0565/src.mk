@@ -90,6 +90,7 @@ ifeq (y,$(strip $(IIOD)))
 LIBRARIES += iio
 SRC_DIRS += $(NO-OS)/iio/iio_app
 SRCS += $(DRIVERS)/afe/ad5940/iio_ad5940.c \
+	$(DRIVERS)/afe/ad5940/iio_ad5940_trig.c \
 	$(DRIVERS)/switch/adg2128/iio_adg2128.c
 INCS += $(DRIVERS)/afe/ad5940/iio_ad5940.h \
 	$(DRIVERS)/switch/adg2128/iio_adg2128.h
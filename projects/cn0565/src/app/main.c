@@ -67,6 +67,7 @@
 #include "iio_ad5940.h"
 #include "iio_adg2128.h"
 #include "iio_app.h"
+#include "iio_trigger.h"
 #endif
 
 struct no_os_spi_desc *spi;
@@ -216,16 +217,6 @@ int main(void)
 		.reset_gpio_init = reset_gip,
 		.gp0_gpio_init = gp0_gip,
 	};
-#ifndef IIO_SUPPORT
-	/* interrupt controller  */
-	struct no_os_irq_init_param nvic_ip = {
-		.irq_ctrl_id = INTC_DEVICE_ID,
-		.platform_ops = IRQ_OPS,
-	};
-	struct no_os_irq_ctrl_desc *nvic;
-	ret = no_os_irq_ctrl_init(&nvic, &nvic_ip);
-	if (ret < 0)
-		return ret;
 
 	/* gpio interrupt controller  */
 #if defined(STM32_PLATFORM)
@@ -244,6 +235,17 @@ int main(void)
 		.extra = &gic_xip,
 #endif
 	};
+#ifndef IIO_SUPPORT
+	/* interrupt controller  */
+	struct no_os_irq_init_param nvic_ip = {
+		.irq_ctrl_id = INTC_DEVICE_ID,
+		.platform_ops = IRQ_OPS,
+	};
+	struct no_os_irq_ctrl_desc *nvic;
+	ret = no_os_irq_ctrl_init(&nvic, &nvic_ip);
+	if (ret < 0)
+		return ret;
+
 	struct no_os_irq_ctrl_desc *gic;
 	ret = no_os_irq_ctrl_init(&gic, &gic_ip);
 	if (ret < 0)
@@ -297,11 +299,34 @@ int main(void)
 	struct ad5940_iio_dev *ad5940_iio = NULL;
 	struct ad5940_iio_init_param ad5940_iio_ip = {
 		.ad5940_init = &ad5940_ip,
+		.fifo_batch = AD5940_FIFO_BATCH,
+		.seq_cache_entries = AD5940_SEQ_CACHE_ENTRIES,
 	};
 	ret = ad5940_iio_init(&ad5940_iio, &ad5940_iio_ip);
 	if (ret < 0)
 		goto error;
 
+	/* GP0 falls when the DFT data FIFO reaches its threshold */
+	struct no_os_irq_ctrl_desc *gic;
+	ret = no_os_irq_ctrl_init(&gic, &gic_ip);
+	if (ret < 0)
+		goto error;
+
+	struct iio_hw_trig *ad5940_trig;
+	struct iio_hw_trig_init_param ad5940_trig_ip = {
+		.irq_ctrl = gic,
+		.irq_id = INT_IRQn,
+		.irq_trig_lvl = NO_OS_IRQ_EDGE_FALLING,
+		.cb_info = {
+			.event = NO_OS_EVT_GPIO,
+			.peripheral = NO_OS_GPIO_IRQ,
+		},
+		.name = AD5940_TRIG_NAME,
+	};
+	ret = iio_hw_trig_init(&ad5940_trig, &ad5940_trig_ip);
+	if (ret < 0)
+		goto error;
+
 	struct adg2128_iio_dev *adg2128_iio = NULL;
 	ret = adg2128_iio_init(&adg2128_iio, i2c);
 	if (ret < 0)
@@ -313,7 +338,8 @@ int main(void)
 			.dev = ad5940_iio,
 			.dev_descriptor = ad5940_iio->iio,
 			.read_buff = NULL,
-			.write_buff = NULL
+			.write_buff = NULL,
+			.default_trigger_id = "trigger0",
 		},
 		{
 			.name = "adg2128",
@@ -322,14 +348,22 @@ int main(void)
 		},
 	};
 
+	struct iio_trigger_init trigs[] = {
+		IIO_APP_TRIGGER(AD5940_TRIG_NAME, ad5940_trig, &ad5940_iio_trig_desc)
+	};
+
 	app_init_param.devices = devices;
 	app_init_param.nb_devices = NO_OS_ARRAY_SIZE(devices);
+	app_init_param.trigs = trigs;
+	app_init_param.nb_trigs = NO_OS_ARRAY_SIZE(trigs);
 	app_init_param.uart_init_params = iio_uart_ip;
 
 	ret = iio_app_init(&app, app_init_param);
 	if (ret)
 		return ret;
 
+	ad5940_trig->iio_desc = app->iio_desc;
+
 	return iio_app_run(app);
 #endif
 
@@ -77,4 +77,10 @@ extern UART_HandleTypeDef 	huart5;
 #define GP0_PIN			7 // G.7
 #endif
 
+#define AD5940_TRIG_NAME	"ad5940-gp0"
+/* DFT results read per GP0 interrupt while buffering */
+#define AD5940_FIFO_BATCH	4
+/* Init and measurement sequences of 4 configurations */
+#define AD5940_SEQ_CACHE_ENTRIES	8
+
 #endif // __PARAMETERS_H__
@@ -63,3 +63,17 @@ SRCS += $(PROJECT)/src/platform/platform.c
 # ADE9000 driver files
 INCS += $(DRIVERS)/meter/ade9000/ade9000.h
 SRCS += $(DRIVERS)/meter/ade9000/ade9000.c
+INCS += $(DRIVERS)/meter/common/ade9xxx_wfb.h
+SRCS += $(DRIVERS)/meter/common/ade9xxx_wfb.c
+
+ifeq (y,$(strip $(IIOD)))
+SRCS += $(PROJECT)/src/iio_example.c
+INCS += $(PROJECT)/src/iio_example.h
+
+# ADE9000 IIO driver files
+INCS += $(DRIVERS)/meter/ade9000/iio_ade9000.h \
+	$(DRIVERS)/meter/common/iio_ade9xxx_wfb.h
+SRCS += $(DRIVERS)/meter/ade9000/iio_ade9000.c \
+	$(DRIVERS)/meter/common/iio_ade9xxx_wfb.c \
+	$(DRIVERS)/meter/common/iio_ade9xxx_wfb_trig.c
+endif
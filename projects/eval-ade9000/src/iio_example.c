@@ -0,0 +1,158 @@
+/***************************************************************************//**
+ *   @file   iio_example.c
+ *   @brief  IIO example of the ADE9000 waveform buffer streaming.
+********************************************************************************
+ * Copyright 2026(c) Analog Devices, Inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Analog Devices, Inc. nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ANALOG DEVICES, INC. “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL ANALOG DEVICES, INC. BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+#include "iio_example.h"
+#include "iio_ade9000.h"
+#include "iio_app.h"
+#include "no_os_irq.h"
+#include "no_os_print_log.h"
+#include "platform.h"
+
+/* Sample sets kept in the IIO buffer, 4 blocks of 8 pages */
+#define DATA_BUFFER_SIZE	(4 * ADE9XXX_WFB_MAX_SETS)
+
+static uint8_t iio_data_buffer[DATA_BUFFER_SIZE * ADE9XXX_WFB_NB_CHANNELS *
+						sizeof(int32_t)];
+
+/*******************************************************************************
+ * @brief IIO example main execution. The IA, VA, IB, VB, IC, VC and IN
+ * waveforms are streamed at 8 kSPS, a block of 4 pages being read on each
+ * IRQ0 falling edge.
+ *
+ * @return ret - Result of the example execution. If working correctly, will
+ *               execute continuously function iio_app_run and will not return.
+*******************************************************************************/
+int iio_example_main(void)
+{
+	int ret;
+	struct ade9000_iio_desc *ade9000_iio_dev;
+	struct ade9000_iio_desc_init_param ade9000_iio_ip = {
+		.ade9000_init_param = {
+			.spi_init = &ade9000_spi_ip,
+			.temp_en = ENABLE,
+		},
+		.wfb_config = {
+			.src = ADE9XXX_WFB_SRC_SINC4_IIR,
+			.in_en = true,
+			.pages_per_irq = 4,
+		},
+	};
+	struct no_os_gpio_desc *ade9000_irq0_desc;
+	struct no_os_irq_ctrl_desc *ade9000_nvic_desc;
+	struct no_os_irq_init_param ade9000_nvic_ip = {
+		.platform_ops = &max_irq_ops,
+	};
+	struct no_os_irq_ctrl_desc *ade9000_irq_desc;
+	struct iio_hw_trig *ade9000_trig_desc;
+	struct iio_app_desc *app;
+	struct iio_app_init_param app_init_param = {0};
+	struct iio_data_buffer data_buff = {
+		.buff = (void *)iio_data_buffer,
+		.size = sizeof(iio_data_buffer),
+	};
+
+	ret = ade9000_iio_init(&ade9000_iio_dev, &ade9000_iio_ip);
+	if (ret)
+		return ret;
+
+	ret = no_os_gpio_get(&ade9000_irq0_desc, &ade9000_gpio_irq0_ip);
+	if (ret)
+		goto remove_iio;
+
+	ret = no_os_gpio_direction_input(ade9000_irq0_desc);
+	if (ret)
+		goto remove_gpio;
+
+	/* The IRQ0 trigger needs the GPIO port interrupt */
+	ret = no_os_irq_ctrl_init(&ade9000_nvic_desc, &ade9000_nvic_ip);
+	if (ret)
+		goto remove_gpio;
+
+	ret = no_os_irq_enable(ade9000_nvic_desc, NVIC_GPIO_IRQ);
+	if (ret)
+		goto remove_nvic;
+
+	ret = no_os_irq_ctrl_init(&ade9000_irq_desc, &ade9000_gpio_irq_ip);
+	if (ret)
+		goto remove_nvic;
+
+	ade9000_gpio_trig_ip.irq_ctrl = ade9000_irq_desc;
+
+	ret = iio_hw_trig_init(&ade9000_trig_desc, &ade9000_gpio_trig_ip);
+	if (ret)
+		goto remove_irq;
+
+	struct iio_app_device iio_devices[] = {
+		{
+			.name = "ade9000",
+			.dev = ade9000_iio_dev,
+			.dev_descriptor = ade9000_iio_dev->iio_dev,
+			.read_buff = &data_buff,
+			.default_trigger_id = "trigger0",
+		},
+	};
+
+	struct iio_trigger_init trigs[] = {
+		IIO_APP_TRIGGER(ADE9000_GPIO_TRIG_NAME, ade9000_trig_desc,
+				&ade9xxx_wfb_iio_trig_desc)
+	};
+
+	app_init_param.devices = iio_devices;
+	app_init_param.nb_devices = NO_OS_ARRAY_SIZE(iio_devices);
+	app_init_param.uart_init_params = uart_ip;
+	app_init_param.trigs = trigs;
+	app_init_param.nb_trigs = NO_OS_ARRAY_SIZE(trigs);
+	app_init_param.irq_desc = ade9000_irq_desc;
+
+	ret = iio_app_init(&app, app_init_param);
+	if (ret)
+		goto remove_trig;
+
+	ade9000_trig_desc->iio_desc = app->iio_desc;
+
+	ret = iio_app_run(app);
+	if (ret)
+		pr_info("Error: iio_app_run: %d\r\n", ret);
+
+	iio_app_remove(app);
+remove_trig:
+	iio_hw_trig_remove(ade9000_trig_desc);
+remove_irq:
+	no_os_irq_ctrl_remove(ade9000_irq_desc);
+remove_nvic:
+	no_os_irq_ctrl_remove(ade9000_nvic_desc);
+remove_gpio:
+	no_os_gpio_remove(ade9000_irq0_desc);
+remove_iio:
+	ade9000_iio_remove(ade9000_iio_dev);
+	return ret;
+}
@@ -47,6 +47,9 @@
 #include "maxim_spi.h"
 #include "ade9000.h"
 #include "platform.h"
+#ifdef IIO_SUPPORT
+#include "iio_example.h"
+#endif
 
 int main(void)
 {
@@ -62,6 +65,11 @@ int main(void)
 	// gpio descriptor
 	struct no_os_gpio_desc *gpio_desc;
 
+#ifdef IIO_SUPPORT
+	/* the IIO application owns the UART */
+	return iio_example_main();
+#endif
+
 	ret = no_os_uart_init(&uart_desc, &uart_ip);
 	if (ret)
 		goto error;
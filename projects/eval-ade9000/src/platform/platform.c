@@ -102,3 +102,33 @@ int interface_toggle_led(struct no_os_gpio_desc *gpio_led_desc)
 
 	return no_os_gpio_set_value(gpio_led_desc, val);
 }
+
+#ifdef IIO_SUPPORT
+// IRQ0 pin
+struct no_os_gpio_init_param ade9000_gpio_irq0_ip = {
+	.port = GPIO_IRQ0_PORT,
+	.number = GPIO_IRQ0_PIN,
+	.pull = NO_OS_PULL_UP,
+	.platform_ops = &max_gpio_ops,
+	.extra = &ade9000_gpio_extra_ip,
+};
+
+// IRQ0 GPIO interrupt controller
+struct no_os_irq_init_param ade9000_gpio_irq_ip = {
+	.irq_ctrl_id = GPIO_IRQ0_PORT,
+	.platform_ops = GPIO_IRQ_OPS,
+	.extra = GPIO_IRQ_EXTRA,
+};
+
+// IRQ0 trigger, fired each time a block of waveform buffer pages is filled
+struct iio_hw_trig_init_param ade9000_gpio_trig_ip = {
+	.irq_id = GPIO_IRQ0_PIN,
+	.irq_trig_lvl = NO_OS_IRQ_EDGE_FALLING,
+	.cb_info = {
+		.event = NO_OS_EVT_GPIO,
+		.peripheral = NO_OS_GPIO_IRQ,
+		.handle = MXC_GPIO_GET_GPIO(GPIO_IRQ0_PORT),
+	},
+	.name = ADE9000_GPIO_TRIG_NAME,
+};
+#endif
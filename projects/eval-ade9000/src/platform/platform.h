@@ -49,6 +49,10 @@
 #include "maxim_pwm.h"
 #include "maxim_spi.h"
 #include "maxim_irq.h"
+#ifdef IIO_SUPPORT
+#include "maxim_gpio_irq.h"
+#include "iio_trigger.h"
+#endif
 
 // UART init params
 extern struct no_os_uart_init_param uart_ip;
@@ -56,6 +60,14 @@ extern struct no_os_uart_init_param uart_ip;
 extern struct no_os_gpio_init_param gpio_led1_ip;
 // SPI init params
 extern struct no_os_spi_init_param ade9000_spi_ip ;
+#ifdef IIO_SUPPORT
+// IRQ0 GPIO init params
+extern struct no_os_gpio_init_param ade9000_gpio_irq0_ip;
+// IRQ0 GPIO interrupt controller init params
+extern struct no_os_irq_init_param ade9000_gpio_irq_ip;
+// IRQ0 trigger init params
+extern struct iio_hw_trig_init_param ade9000_gpio_trig_ip;
+#endif
 
 /* Configuration for AD-APARD32690-SL */
 // Port and Pin for user LED
@@ -65,12 +77,33 @@ extern struct no_os_spi_init_param ade9000_spi_ip ;
 #define GPIO_EXTRA                  &ade9000_gpio_extra_ip
 // SPI config
 #define SPI_DEVICE_ID               1
+#ifdef IIO_SUPPORT
+// Waveform buffer bursts at up to 8 kSPS sample sets of 32 bytes
+#define SPI_BAUDRATE                10000000
+#else
 #define SPI_BAUDRATE                1000000
+#endif
 #define SPI_CS                      0
 #define SPI_SLAVE_NUM               1
 // UART config
 #define UART_DEV_ID                 0
+#ifdef IIO_SUPPORT
+// IIO client link, carrying a few waveform buffer channels at 8 kSPS
+#define UART_BAUD                   921600
+#else
 #define UART_BAUD                   115200
+#endif
+
+#ifdef IIO_SUPPORT
+// IRQ0 port and pin, driven low by the waveform buffer PAGE_FULL interrupt
+#define GPIO_IRQ0_PORT              2
+#define GPIO_IRQ0_PIN               9
+// IRQ config
+#define GPIO_IRQ_OPS                &max_gpio_irq_ops
+#define GPIO_IRQ_EXTRA              &ade9000_gpio_extra_ip
+#define NVIC_GPIO_IRQ               GPIO2_IRQn
+#define ADE9000_GPIO_TRIG_NAME      "ade9000-dev0"
+#endif
 
 #define RESET_TIME                  500
 // Read data interval in ms
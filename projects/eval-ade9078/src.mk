@@ -63,3 +63,5 @@ SRCS += $(PROJECT)/src/platform/platform.c
 # ADE9000 driver files
 INCS += $(DRIVERS)/meter/ade9078/ade9078.h
 SRCS += $(DRIVERS)/meter/ade9078/ade9078.c
+INCS += $(DRIVERS)/meter/common/ade9xxx_wfb.h
+SRCS += $(DRIVERS)/meter/common/ade9xxx_wfb.c
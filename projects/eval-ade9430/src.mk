@@ -23,6 +23,7 @@ INCS += $(INCLUDE)/no_os_delay.h     \
 	$(INCLUDE)/no_os_rtc.h \
 	$(DRIVERS)/rtc/pcf85263/pcf85263.h \
 	$(DRIVERS)/meter/ade9430/ade9430.h \
+	$(DRIVERS)/meter/common/ade9xxx_wfb.h \
 	$(DRIVERS)/display/nhd_c12832a1z/nhd_c12832a1z.h \
 
 INCS += $(PLATFORM_DRIVERS)/$(PLATFORM)_gpio.h      \
@@ -38,6 +39,7 @@ INCS += $(PLATFORM_DRIVERS)/$(PLATFORM)_gpio.h      \
 
 SRCS += $(DRIVERS)/api/no_os_gpio.c \
 	$(DRIVERS)/meter/ade9430/ade9430.c \
+	$(DRIVERS)/meter/common/ade9xxx_wfb.c \
 	$(DRIVERS)/rtc/pcf85263/pcf85263.c \
 	$(DRIVERS)/api/no_os_i2c.c  \
 	$(NO-OS)/util/no_os_lf256fifo.c \
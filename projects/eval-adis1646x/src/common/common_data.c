@@ -70,6 +70,7 @@ struct adis_init_param adis1646x_ip = {
 	.gpio_reset = &adis1646x_gpio_reset_ip,
 	.sync_mode = ADIS_SYNC_OUTPUT,
 	.dev_id = ADIS16465_1,
+	.reg_cache = true,
 };
 
 #ifdef IIO_TRIGGER_EXAMPLE
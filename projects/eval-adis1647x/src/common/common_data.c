@@ -70,6 +70,7 @@ struct adis_init_param adis1647x_ip = {
 	.gpio_reset = &adis1647x_gpio_reset_ip,
 	.sync_mode = ADIS_SYNC_OUTPUT,
 	.dev_id = ADIS16477_1,
+	.reg_cache = true,
 };
 
 #ifdef IIO_TRIGGER_EXAMPLE
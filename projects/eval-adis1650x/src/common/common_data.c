@@ -70,6 +70,7 @@ struct adis_init_param adis1650x_ip = {
 	.gpio_reset = &adis1650x_gpio_reset_ip,
 	.sync_mode = ADIS_SYNC_OUTPUT,
 	.dev_id = ADIS16505_2,
+	.reg_cache = true,
 };
 
 #ifdef IIO_TRIGGER_EXAMPLE
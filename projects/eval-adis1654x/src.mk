@@ -24,6 +24,7 @@ INCS += $(INCLUDE)/no_os_delay.h             \
 		$(INCLUDE)/no_os_uart.h      \
 		$(INCLUDE)/no_os_lf256fifo.h \
 		$(INCLUDE)/no_os_util.h      \
+		$(INCLUDE)/no_os_regmap.h    \
 		$(INCLUDE)/no_os_units.h     \
 		$(INCLUDE)/no_os_crc8.h      \
 		$(INCLUDE)/no_os_alloc.h     \
@@ -40,6 +41,7 @@ SRCS += $(DRIVERS)/api/no_os_gpio.c             \
 		$(DRIVERS)/api/no_os_uart.c     \
 		$(NO-OS)/util/no_os_crc8.c      \
 		$(NO-OS)/util/no_os_util.c      \
+		$(NO-OS)/util/no_os_regmap.c    \
 		$(NO-OS)/util/no_os_alloc.c     \
 		$(NO-OS)/util/no_os_mutex.c
 
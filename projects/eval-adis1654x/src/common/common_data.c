@@ -70,6 +70,7 @@ struct adis_init_param adis1654x_ip = {
 	.gpio_reset = &adis1654x_gpio_reset_ip,
 	.sync_mode = ADIS_SYNC_DEFAULT,
 	.dev_id = ADIS16545_3,
+	.reg_cache = true,
 };
 
 #ifdef IIO_TRIGGER_EXAMPLE
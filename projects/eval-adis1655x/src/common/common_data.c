@@ -70,6 +70,7 @@ struct adis_init_param adis1655x_ip = {
 	.gpio_reset = &adis1655x_gpio_reset_ip,
 	.sync_mode = ADIS_SYNC_DEFAULT,
 	.dev_id = ADIS16550,
+	.reg_cache = true,
 };
 
 #ifdef IIO_TRIGGER_EXAMPLE
@@ -70,6 +70,7 @@ struct adis_init_param adis1657x_ip = {
 	.gpio_reset = &adis1657x_gpio_reset_ip,
 	.sync_mode = ADIS_SYNC_OUTPUT,
 	.dev_id = ADIS16577_3,
+	.reg_cache = true,
 };
 
 #ifdef IIO_TRIGGER_EXAMPLE
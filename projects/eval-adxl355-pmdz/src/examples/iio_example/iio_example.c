@@ -52,7 +52,7 @@ int example_main()
 {
 	int ret;
 	struct adxl355_iio_dev *adxl355_iio_desc;
-	struct adxl355_iio_dev_init_param adxl355_iio_ip;
+	struct adxl355_iio_dev_init_param adxl355_iio_ip = { 0 };
 	struct iio_app_desc *app;
 	struct iio_data_buffer accel_buff = {
 		.buff = (void *)iio_data_buffer,
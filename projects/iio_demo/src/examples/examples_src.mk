@@ -29,6 +29,20 @@ SRCS += $(DRIVERS)/adc/adc_demo/iio_adc_demo_trig.c
 SRCS += $(DRIVERS)/dac/dac_demo/iio_dac_demo_trig.c
 endif
 
+ifeq (y,$(strip $(IIO_BENCHMARK)))
+CFLAGS += -DIIO_BENCHMARK
+# Optional overrides: make IIO_BENCH_CONNECTIONS=4 IIO_BENCH_SAMPLES=8192 ...
+$(foreach p,CHANNEL_MASK SAMPLES CONNECTIONS BUFFER_OPS ATTR_OPS,\
+	$(if $(IIO_BENCH_$(p)),$(eval CFLAGS += -DIIO_BENCH_$(p)=$(IIO_BENCH_$(p)))))
+
+SRCS += $(PROJECT)/src/examples/iio_benchmark/iio_benchmark.c
+INCS += $(PROJECT)/src/examples/iio_benchmark/iio_benchmark.h
+
+SRCS += $(NO-OS)/util/no_os_thread.c \
+	$(DRIVERS)/platform/linux/linux_thread.c
+INCS += $(INCLUDE)/no_os_thread.h
+endif
+
 IIOD=y
 
 SRC_DIRS += $(NO-OS)/iio/iio_app
@@ -0,0 +1,844 @@
+/***************************************************************************//**
+ *   @file   iio_benchmark.c
+ *   @brief  IIO throughput benchmark for iio_demo project
+********************************************************************************
+ * Copyright 2026(c) Analog Devices, Inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Analog Devices, Inc. nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ANALOG DEVICES, INC. “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL ANALOG DEVICES, INC. BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include "iio_benchmark.h"
+#include "iio.h"
+#include "iio_adc_demo.h"
+#include "iio_dac_demo.h"
+#include "common_data.h"
+#include "linux_socket.h"
+#include "tcp_socket.h"
+#include "no_os_alloc.h"
+#include "no_os_error.h"
+#include "no_os_thread.h"
+#include "no_os_util.h"
+
+/* Port iiod listens on */
+#define IIO_BENCH_PORT			30431
+#define IIO_BENCH_MAX_CONNECTIONS	8
+/* Size of the byte queues between the client and the local backend */
+#define IIO_BENCH_QUEUE_SIZE		0x10000
+#define IIO_BENCH_CONN_BUF_SIZE		0x1000
+/* iio_step() calls without an answer before the local client gives up */
+#define IIO_BENCH_MAX_IDLE_STEPS	1000000
+#define IIO_BENCH_ATTR			"adc_global_attr"
+#define IIO_BENCH_ATTR_VAL		"3333"
+
+enum iio_bench_phase {
+	IIO_BENCH_READBUF,
+	IIO_BENCH_WRITEBUF,
+	IIO_BENCH_ATTR_RW,
+	IIO_BENCH_NB_PHASES
+};
+
+static const char * const iio_bench_phase_names[] = {
+	[IIO_BENCH_READBUF] = "READBUF",
+	[IIO_BENCH_WRITEBUF] = "WRITEBUF",
+	[IIO_BENCH_ATTR_RW] = "attr r/w",
+};
+
+/* Byte queue between the local backend client and iiod */
+struct iio_bench_queue {
+	uint8_t buf[IIO_BENCH_QUEUE_SIZE];
+	uint32_t head;
+	uint32_t tail;
+};
+
+/* One iiod client, on the local backend or on a TCP connection */
+struct iio_bench_client {
+	int (*send)(struct iio_bench_client *client, const void *buf,
+		    uint32_t len);
+	/* Receive at least one and at most len bytes */
+	int (*recv)(struct iio_bench_client *client, void *buf, uint32_t len);
+	/* TCP socket */
+	int fd;
+	/* IIO instance stepped by the local backend client */
+	struct iio_desc *iio;
+	char adc[16];
+	char dac[16];
+	/* Received bytes not consumed yet */
+	uint8_t rx[IIO_BENCH_CONN_BUF_SIZE];
+	uint32_t rx_idx;
+	uint32_t rx_len;
+	/* Buffer payload */
+	uint8_t *data;
+	uint32_t data_len;
+	enum iio_bench_phase phase;
+	/* Latency of each command of the phase */
+	uint32_t *lat_ns;
+	uint32_t nb_lat;
+	uint64_t bytes;
+	int err;
+};
+
+struct iio_bench_result {
+	uint64_t wall_ns;
+	uint64_t cpu_ns;
+	uint64_t bytes;
+	uint32_t ops;
+	uint32_t p50_ns;
+	uint32_t p99_ns;
+};
+
+static struct iio_bench_queue iio_bench_to_iio;
+static struct iio_bench_queue iio_bench_from_iio;
+static volatile bool iio_bench_stop;
+
+static uint64_t iio_bench_ns(clockid_t clock)
+{
+	struct timespec ts;
+
+	clock_gettime(clock, &ts);
+
+	return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+static uint32_t iio_bench_queue_push(struct iio_bench_queue *q,
+				     const void *buf, uint32_t len)
+{
+	if (q->tail == IIO_BENCH_QUEUE_SIZE && q->head) {
+		memmove(q->buf, q->buf + q->head, q->tail - q->head);
+		q->tail -= q->head;
+		q->head = 0;
+	}
+
+	len = no_os_min(len, IIO_BENCH_QUEUE_SIZE - q->tail);
+	memcpy(q->buf + q->tail, buf, len);
+	q->tail += len;
+
+	return len;
+}
+
+static uint32_t iio_bench_queue_pop(struct iio_bench_queue *q, void *buf,
+				    uint32_t len)
+{
+	len = no_os_min(len, q->tail - q->head);
+	memcpy(buf, q->buf + q->head, len);
+	q->head += len;
+	if (q->head == q->tail) {
+		q->head = 0;
+		q->tail = 0;
+	}
+
+	return len;
+}
+
+/* Local backend callbacks, called by iiod. */
+static int iio_bench_local_event_read(void *conn, uint8_t *buf, uint32_t len)
+{
+	uint32_t n = iio_bench_queue_pop(&iio_bench_to_iio, buf, len);
+
+	if (!n)
+		return -EAGAIN;
+
+	return n;
+}
+
+static int iio_bench_local_event_write(void *conn, uint8_t *buf, uint32_t len)
+{
+	return iio_bench_queue_push(&iio_bench_from_iio, buf, len);
+}
+
+/* Local backend client transport. iiod runs in the client context. */
+static int iio_bench_local_send(struct iio_bench_client *client,
+				const void *buf, uint32_t len)
+{
+	const uint8_t *p = buf;
+	uint32_t idle = 0;
+	uint32_t n;
+
+	while (len) {
+		n = iio_bench_queue_push(&iio_bench_to_iio, p, len);
+		p += n;
+		len -= n;
+		if (n)
+			continue;
+		if (++idle > IIO_BENCH_MAX_IDLE_STEPS)
+			return -ETIMEDOUT;
+		iio_step(client->iio);
+	}
+
+	return 0;
+}
+
+static int iio_bench_local_recv(struct iio_bench_client *client, void *buf,
+				uint32_t len)
+{
+	uint32_t idle = 0;
+	uint32_t n;
+
+	while (!(n = iio_bench_queue_pop(&iio_bench_from_iio, buf, len))) {
+		if (++idle > IIO_BENCH_MAX_IDLE_STEPS)
+			return -ETIMEDOUT;
+		iio_step(client->iio);
+	}
+
+	return n;
+}
+
+/* TCP client transport. */
+static int iio_bench_tcp_send(struct iio_bench_client *client,
+			      const void *buf, uint32_t len)
+{
+	const uint8_t *p = buf;
+	ssize_t ret;
+
+	while (len) {
+		ret = send(client->fd, p, len, MSG_NOSIGNAL);
+		if (ret <= 0)
+			return -EIO;
+		p += ret;
+		len -= ret;
+	}
+
+	return 0;
+}
+
+static int iio_bench_tcp_recv(struct iio_bench_client *client, void *buf,
+			      uint32_t len)
+{
+	ssize_t ret;
+
+	ret = recv(client->fd, buf, len, 0);
+	if (ret <= 0)
+		return -EIO;
+
+	return ret;
+}
+
+static int iio_bench_tcp_connect(struct iio_bench_client *client)
+{
+	struct sockaddr_in addr = {
+		.sin_family = AF_INET,
+		.sin_port = htons(IIO_BENCH_PORT),
+		.sin_addr.s_addr = htonl(INADDR_LOOPBACK),
+	};
+	int one = 1;
+
+	client->fd = socket(AF_INET, SOCK_STREAM, 0);
+	if (client->fd < 0)
+		return -errno;
+
+	setsockopt(client->fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+	if (connect(client->fd, (struct sockaddr *)&addr, sizeof(addr))) {
+		close(client->fd);
+		return -errno;
+	}
+
+	client->send = iio_bench_tcp_send;
+	client->recv = iio_bench_tcp_recv;
+
+	return 0;
+}
+
+/* Client side of the iiod protocol. */
+static int iio_bench_read(struct iio_bench_client *client, void *buf,
+			  uint32_t len)
+{
+	uint8_t *p = buf;
+	uint32_t n;
+	int ret;
+
+	n = no_os_min(len, client->rx_len - client->rx_idx);
+	memcpy(p, client->rx + client->rx_idx, n);
+	client->rx_idx += n;
+
+	/* Payloads go straight to their destination */
+	for (p += n, len -= n; len; p += ret, len -= ret) {
+		ret = client->recv(client, p, len);
+		if (ret < 0)
+			return ret;
+	}
+
+	return 0;
+}
+
+static int iio_bench_read_line(struct iio_bench_client *client, char *line,
+			       uint32_t size)
+{
+	uint32_t i = 0;
+	int ret;
+
+	while (i < size - 1) {
+		if (client->rx_idx == client->rx_len) {
+			ret = client->recv(client, client->rx,
+					   sizeof(client->rx));
+			if (ret < 0)
+				return ret;
+			client->rx_idx = 0;
+			client->rx_len = ret;
+		}
+
+		line[i] = client->rx[client->rx_idx++];
+		if (line[i] == '\n')
+			break;
+		i++;
+	}
+	line[i] = '\0';
+
+	return 0;
+}
+
+static int iio_bench_read_int(struct iio_bench_client *client, int32_t *val)
+{
+	char line[32];
+	int ret;
+
+	ret = iio_bench_read_line(client, line, sizeof(line));
+	if (ret)
+		return ret;
+
+	*val = strtol(line, NULL, 10);
+
+	return 0;
+}
+
+static int iio_bench_cmd(struct iio_bench_client *client, int32_t *val,
+			 const char *fmt, ...)
+{
+	char line[80];
+	va_list args;
+	int len;
+	int ret;
+
+	va_start(args, fmt);
+	len = vsnprintf(line, sizeof(line), fmt, args);
+	va_end(args);
+
+	ret = client->send(client, line, len);
+	if (ret || !val)
+		return ret;
+
+	return iio_bench_read_int(client, val);
+}
+
+static int iio_bench_open(struct iio_bench_client *client, const char *dev)
+{
+	int32_t val;
+	int ret;
+
+	ret = iio_bench_cmd(client, &val, "OPEN %s %u %08x\r\n", dev,
+			    IIO_BENCH_SAMPLES, IIO_BENCH_CHANNEL_MASK);
+	if (ret)
+		return ret;
+
+	return val;
+}
+
+static int iio_bench_close(struct iio_bench_client *client, const char *dev)
+{
+	int32_t val;
+	int ret;
+
+	ret = iio_bench_cmd(client, &val, "CLOSE %s\r\n", dev);
+	if (ret)
+		return ret;
+
+	return val;
+}
+
+static int iio_bench_readbuf(struct iio_bench_client *client)
+{
+	char mask[16];
+	uint64_t start;
+	int32_t val;
+	uint32_t i;
+	int ret;
+
+	ret = iio_bench_open(client, client->adc);
+	if (ret)
+		return ret;
+
+	for (i = 0; i < IIO_BENCH_BUFFER_OPS; i++) {
+		start = iio_bench_ns(CLOCK_MONOTONIC);
+		ret = iio_bench_cmd(client, &val, "READBUF %s %u\r\n",
+				    client->adc, client->data_len);
+		if (ret)
+			return ret;
+		if (val != (int32_t)client->data_len)
+			return val < 0 ? val : -EIO;
+
+		ret = iio_bench_read_line(client, mask, sizeof(mask));
+		if (ret)
+			return ret;
+
+		ret = iio_bench_read(client, client->data, client->data_len);
+		if (ret)
+			return ret;
+
+		client->lat_ns[client->nb_lat++] =
+			iio_bench_ns(CLOCK_MONOTONIC) - start;
+		client->bytes += client->data_len;
+	}
+
+	return iio_bench_close(client, client->adc);
+}
+
+static int iio_bench_writebuf(struct iio_bench_client *client)
+{
+	uint64_t start;
+	int32_t val;
+	uint32_t i;
+	int ret;
+
+	ret = iio_bench_open(client, client->dac);
+	if (ret)
+		return ret;
+
+	for (i = 0; i < IIO_BENCH_BUFFER_OPS; i++) {
+		start = iio_bench_ns(CLOCK_MONOTONIC);
+		ret = iio_bench_cmd(client, &val, "WRITEBUF %s %u\r\n",
+				    client->dac, client->data_len);
+		if (ret)
+			return ret;
+		if (val != (int32_t)client->data_len)
+			return val < 0 ? val : -EIO;
+
+		ret = client->send(client, client->data, client->data_len);
+		if (ret)
+			return ret;
+
+		/* Result of the buffer push, the count is not meaningful */
+		ret = iio_bench_read_int(client, &val);
+		if (ret)
+			return ret;
+		if (val < 0)
+			return val;
+
+		client->lat_ns[client->nb_lat++] =
+			iio_bench_ns(CLOCK_MONOTONIC) - start;
+		client->bytes += client->data_len;
+	}
+
+	return iio_bench_close(client, client->dac);
+}
+
+static int iio_bench_attr_rw(struct iio_bench_client *client)
+{
+	char value[32];
+	uint64_t start;
+	int32_t val;
+	uint32_t i;
+	int ret;
+
+	for (i = 0; i < IIO_BENCH_ATTR_OPS; i++) {
+		start = iio_bench_ns(CLOCK_MONOTONIC);
+		if (i % 2) {
+			ret = iio_bench_cmd(client, &val, "WRITE %s %s %u\r\n%s",
+					    client->adc, IIO_BENCH_ATTR,
+					    strlen(IIO_BENCH_ATTR_VAL),
+					    IIO_BENCH_ATTR_VAL);
+		} else {
+			ret = iio_bench_cmd(client, &val, "READ %s %s\r\n",
+					    client->adc, IIO_BENCH_ATTR);
+			if (!ret && val >= 0)
+				ret = iio_bench_read_line(client, value,
+							  sizeof(value));
+		}
+		if (ret)
+			return ret;
+		if (val < 0)
+			return val;
+
+		client->lat_ns[client->nb_lat++] =
+			iio_bench_ns(CLOCK_MONOTONIC) - start;
+	}
+
+	return 0;
+}
+
+static void iio_bench_client_run(void *arg)
+{
+	struct iio_bench_client *client = arg;
+
+	client->nb_lat = 0;
+	client->bytes = 0;
+
+	switch (client->phase) {
+	case IIO_BENCH_READBUF:
+		client->err = iio_bench_readbuf(client);
+		break;
+	case IIO_BENCH_WRITEBUF:
+		client->err = iio_bench_writebuf(client);
+		break;
+	default:
+		client->err = iio_bench_attr_rw(client);
+		break;
+	}
+}
+
+static void iio_bench_server_run(void *arg)
+{
+	struct iio_desc *iio = arg;
+
+	while (!iio_bench_stop)
+		iio_step(iio);
+}
+
+static int iio_bench_cmp(const void *a, const void *b)
+{
+	uint32_t x = *(const uint32_t *)a;
+	uint32_t y = *(const uint32_t *)b;
+
+	return (x > y) - (x < y);
+}
+
+/* Run one phase on all the clients at once and collect the results. */
+static int iio_bench_phase(struct iio_bench_client *clients,
+			   uint32_t nb_clients, enum iio_bench_phase phase,
+			   struct iio_bench_result *res)
+{
+	void *threads[IIO_BENCH_MAX_CONNECTIONS] = {0};
+	uint64_t wall, cpu;
+	uint32_t *lat;
+	uint32_t i;
+	int ret;
+
+	memset(res, 0, sizeof(*res));
+
+	wall = iio_bench_ns(CLOCK_MONOTONIC);
+	cpu = iio_bench_ns(CLOCK_PROCESS_CPUTIME_ID);
+
+	for (i = 0; i < nb_clients; i++) {
+		clients[i].phase = phase;
+		if (nb_clients == 1) {
+			iio_bench_client_run(&clients[i]);
+			continue;
+		}
+		ret = no_os_thread_create(&threads[i], iio_bench_client_run,
+					  &clients[i]);
+		if (ret)
+			return ret;
+	}
+	for (i = 0; i < nb_clients; i++)
+		if (threads[i])
+			no_os_thread_join(threads[i]);
+
+	res->wall_ns = iio_bench_ns(CLOCK_MONOTONIC) - wall;
+	res->cpu_ns = iio_bench_ns(CLOCK_PROCESS_CPUTIME_ID) - cpu;
+
+	for (i = 0; i < nb_clients; i++) {
+		if (clients[i].err)
+			return clients[i].err;
+		res->bytes += clients[i].bytes;
+		res->ops += clients[i].nb_lat;
+	}
+
+	lat = no_os_calloc(res->ops, sizeof(*lat));
+	if (!lat)
+		return -ENOMEM;
+
+	for (res->ops = 0, i = 0; i < nb_clients; i++) {
+		memcpy(lat + res->ops, clients[i].lat_ns,
+		       clients[i].nb_lat * sizeof(*lat));
+		res->ops += clients[i].nb_lat;
+	}
+
+	qsort(lat, res->ops, sizeof(*lat), iio_bench_cmp);
+	res->p50_ns = lat[res->ops / 2];
+	res->p99_ns = lat[(uint64_t)res->ops * 99 / 100];
+	no_os_free(lat);
+
+	return 0;
+}
+
+static void iio_bench_report(const char *transport, uint32_t nb_clients,
+			     enum iio_bench_phase phase,
+			     struct iio_bench_result *res)
+{
+	double wall_s = res->wall_ns / 1e9;
+
+	printf("%-6s %-9s conns %u: %9.2f MB/s %10.0f ops/s  p50 %8.1f us  p99 %8.1f us  ",
+	       transport, iio_bench_phase_names[phase], nb_clients,
+	       res->bytes / wall_s / 1e6, res->ops / wall_s,
+	       res->p50_ns / 1e3, res->p99_ns / 1e3);
+
+	if (res->bytes)
+		printf("%.2f CPU ns/byte\n", (double)res->cpu_ns / res->bytes);
+	else
+		printf("%.2f CPU us/op\n", res->cpu_ns / 1e3 / res->ops);
+}
+
+/* Create nb_pairs adc_demo/dac_demo pairs and the IIO instance serving them. */
+static int iio_bench_iio_init(struct iio_desc **iio,
+			      struct iio_init_param *param,
+			      struct adc_demo_desc **adcs,
+			      struct dac_demo_desc **dacs, uint32_t nb_pairs)
+{
+	struct iio_device_init devs[2 * IIO_BENCH_MAX_CONNECTIONS] = {0};
+	uint32_t i;
+	int ret;
+
+	for (i = 0; i < nb_pairs; i++) {
+		ret = adc_demo_init(&adcs[i], &adc_init_par);
+		if (ret)
+			return ret;
+
+		ret = dac_demo_init(&dacs[i], &dac_init_par);
+		if (ret)
+			return ret;
+
+		devs[2 * i].name = "adc_demo";
+		devs[2 * i].dev = adcs[i];
+		devs[2 * i].dev_descriptor = &adc_demo_iio_descriptor;
+		devs[2 * i + 1].name = "dac_demo";
+		devs[2 * i + 1].dev = dacs[i];
+		devs[2 * i + 1].dev_descriptor = &dac_demo_iio_descriptor;
+	}
+
+	param->devs = devs;
+	param->nb_devs = 2 * nb_pairs;
+
+	return iio_init(iio, param);
+}
+
+static void iio_bench_iio_remove(struct iio_desc *iio,
+				 struct adc_demo_desc **adcs,
+				 struct dac_demo_desc **dacs, uint32_t nb_pairs)
+{
+	uint32_t i;
+
+	iio_remove(iio);
+	for (i = 0; i < nb_pairs; i++) {
+		adc_demo_remove(adcs[i]);
+		dac_demo_remove(dacs[i]);
+	}
+}
+
+static int iio_bench_clients_init(struct iio_bench_client *clients,
+				  uint32_t nb_clients)
+{
+	uint32_t bytes_per_scan;
+	uint32_t nb_lat;
+	uint32_t i;
+
+	bytes_per_scan = no_os_hweight32(IIO_BENCH_CHANNEL_MASK) *
+			 sizeof(uint16_t);
+	nb_lat = no_os_max(IIO_BENCH_BUFFER_OPS, IIO_BENCH_ATTR_OPS);
+
+	for (i = 0; i < nb_clients; i++) {
+		memset(&clients[i], 0, sizeof(clients[i]));
+		snprintf(clients[i].adc, sizeof(clients[i].adc),
+			 "iio:device%u", 2 * i);
+		snprintf(clients[i].dac, sizeof(clients[i].dac),
+			 "iio:device%u", 2 * i + 1);
+		clients[i].fd = -1;
+		clients[i].data_len = IIO_BENCH_SAMPLES * bytes_per_scan;
+		clients[i].data = no_os_calloc(1, clients[i].data_len);
+		clients[i].lat_ns = no_os_calloc(nb_lat, sizeof(uint32_t));
+		if (!clients[i].data || !clients[i].lat_ns)
+			return -ENOMEM;
+	}
+
+	return 0;
+}
+
+static void iio_bench_clients_remove(struct iio_bench_client *clients,
+				     uint32_t nb_clients)
+{
+	uint32_t i;
+
+	for (i = 0; i < nb_clients; i++) {
+		if (clients[i].fd >= 0)
+			close(clients[i].fd);
+		no_os_free(clients[i].data);
+		no_os_free(clients[i].lat_ns);
+	}
+}
+
+/* Run all the phases with one client on the local backend. */
+static int iio_bench_local(void)
+{
+	struct iio_local_backend local = {
+		.local_backend_event_read = iio_bench_local_event_read,
+		.local_backend_event_write = iio_bench_local_event_write,
+		.local_backend_buff_len = IIO_BENCH_CONN_BUF_SIZE,
+	};
+	struct iio_init_param param = {
+		.phy_type = USE_LOCAL_BACKEND,
+		.local_backend = &local,
+	};
+	struct adc_demo_desc *adc;
+	struct dac_demo_desc *dac;
+	struct iio_bench_client client;
+	struct iio_bench_result res;
+	enum iio_bench_phase phase;
+	int ret;
+
+	ret = iio_bench_clients_init(&client, 1);
+	if (ret)
+		goto free_clients;
+
+	/* Freed by iio_remove() */
+	local.local_backend_buff = no_os_calloc(1, IIO_BENCH_CONN_BUF_SIZE);
+	if (!local.local_backend_buff) {
+		ret = -ENOMEM;
+		goto free_clients;
+	}
+
+	ret = iio_bench_iio_init(&client.iio, &param, &adc, &dac, 1);
+	if (ret)
+		goto free_clients;
+
+	client.send = iio_bench_local_send;
+	client.recv = iio_bench_local_recv;
+
+	for (phase = 0; phase < IIO_BENCH_NB_PHASES; phase++) {
+		ret = iio_bench_phase(&client, 1, phase, &res);
+		if (ret)
+			break;
+		iio_bench_report("local", 1, phase, &res);
+	}
+
+	iio_bench_iio_remove(client.iio, &adc, &dac, 1);
+free_clients:
+	iio_bench_clients_remove(&client, 1);
+
+	return ret;
+}
+
+/* Run all the phases with IIO_BENCH_CONNECTIONS clients over loopback TCP. */
+static int iio_bench_tcp(void)
+{
+	struct tcp_socket_init_param socket_param = {
+		.net = &linux_net,
+	};
+	struct iio_init_param param = {
+		.phy_type = USE_NETWORK,
+		.tcp_socket_init_param = &socket_param,
+	};
+	struct adc_demo_desc *adcs[IIO_BENCH_MAX_CONNECTIONS];
+	struct dac_demo_desc *dacs[IIO_BENCH_MAX_CONNECTIONS];
+	struct iio_bench_client *clients;
+	struct iio_bench_result res;
+	enum iio_bench_phase phase;
+	struct iio_desc *iio;
+	void *server;
+	uint32_t i;
+	int ret;
+
+	clients = no_os_calloc(IIO_BENCH_CONNECTIONS, sizeof(*clients));
+	if (!clients)
+		return -ENOMEM;
+
+	ret = iio_bench_clients_init(clients, IIO_BENCH_CONNECTIONS);
+	if (ret)
+		goto free_clients;
+
+	ret = iio_bench_iio_init(&iio, &param, adcs, dacs,
+				 IIO_BENCH_CONNECTIONS);
+	if (ret)
+		goto free_clients;
+
+	iio_bench_stop = false;
+	ret = no_os_thread_create(&server, iio_bench_server_run, iio);
+	if (ret)
+		goto free_iio;
+
+	for (i = 0; i < IIO_BENCH_CONNECTIONS; i++) {
+		ret = iio_bench_tcp_connect(&clients[i]);
+		if (ret)
+			goto stop_server;
+	}
+
+	for (phase = 0; phase < IIO_BENCH_NB_PHASES; phase++) {
+		ret = iio_bench_phase(clients, IIO_BENCH_CONNECTIONS, phase,
+				      &res);
+		if (ret)
+			break;
+		iio_bench_report("tcp", IIO_BENCH_CONNECTIONS, phase, &res);
+	}
+
+stop_server:
+	/* Close from the client side, so the port is not left in TIME_WAIT */
+	for (i = 0; i < IIO_BENCH_CONNECTIONS; i++) {
+		if (clients[i].fd >= 0)
+			close(clients[i].fd);
+		clients[i].fd = -1;
+	}
+	iio_bench_stop = true;
+	no_os_thread_join(server);
+free_iio:
+	iio_bench_iio_remove(iio, adcs, dacs, IIO_BENCH_CONNECTIONS);
+free_clients:
+	iio_bench_clients_remove(clients, IIO_BENCH_CONNECTIONS);
+	no_os_free(clients);
+
+	return ret;
+}
+
+/***************************************************************************//**
+ * @brief IIO benchmark main execution. Drives READBUF, WRITEBUF and attribute
+ * read/write storms against the adc_demo and dac_demo devices, first on the
+ * local backend, then over loopback TCP, and prints throughput, latency
+ * percentiles and CPU time per byte. The TCP server polls, so its CPU time is
+ * included in the TCP figures.
+ *
+ * @return ret - 0 if all the phases completed, negative error code otherwise.
+*******************************************************************************/
+int iio_benchmark_main()
+{
+	int ret;
+
+	if (IIO_BENCH_CONNECTIONS < 1 ||
+	    IIO_BENCH_CONNECTIONS > IIO_BENCH_MAX_CONNECTIONS ||
+	    !IIO_BENCH_CHANNEL_MASK ||
+	    IIO_BENCH_CHANNEL_MASK >> TOTAL_ADC_CHANNELS ||
+	    IIO_BENCH_CHANNEL_MASK >> TOTAL_DAC_CHANNELS)
+		return -EINVAL;
+
+	printf("IIO benchmark: mask 0x%x, %u samples, %u buffer ops, %u attribute ops\n",
+	       IIO_BENCH_CHANNEL_MASK, IIO_BENCH_SAMPLES, IIO_BENCH_BUFFER_OPS,
+	       IIO_BENCH_ATTR_OPS);
+
+	ret = iio_bench_local();
+	if (ret) {
+		printf("local backend benchmark failed: %d\n", ret);
+		return ret;
+	}
+
+	ret = iio_bench_tcp();
+	if (ret)
+		printf("TCP benchmark failed: %d\n", ret);
+
+	return ret;
+}
@@ -0,0 +1,64 @@
+/***************************************************************************//**
+ *   @file   iio_benchmark.h
+ *   @brief  IIO throughput benchmark header for iio_demo project
+********************************************************************************
+ * Copyright 2026(c) Analog Devices, Inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Analog Devices, Inc. nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ANALOG DEVICES, INC. “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL ANALOG DEVICES, INC. BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+#ifndef __IIO_BENCHMARK_H__
+#define __IIO_BENCHMARK_H__
+
+/* The defaults below can be changed from the make command line. */
+
+/* Channels enabled in the buffers of the adc_demo and dac_demo devices */
+#ifndef IIO_BENCH_CHANNEL_MASK
+#define IIO_BENCH_CHANNEL_MASK		0x3
+#endif
+
+/* Samples per buffer */
+#ifndef IIO_BENCH_SAMPLES
+#define IIO_BENCH_SAMPLES		4096
+#endif
+
+/* Concurrent TCP connections, each on its own pair of devices */
+#ifndef IIO_BENCH_CONNECTIONS
+#define IIO_BENCH_CONNECTIONS		1
+#endif
+
+/* READBUF and WRITEBUF commands per connection */
+#ifndef IIO_BENCH_BUFFER_OPS
+#define IIO_BENCH_BUFFER_OPS		1000
+#endif
+
+/* Attribute reads and writes per connection */
+#ifndef IIO_BENCH_ATTR_OPS
+#define IIO_BENCH_ATTR_OPS		10000
+#endif
+
+int iio_benchmark_main();
+
+#endif /* __IIO_BENCHMARK_H__ */
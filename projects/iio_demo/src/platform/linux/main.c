@@ -43,6 +43,10 @@
 #include "iio_sw_trigger_example.h"
 #endif
 
+#ifdef IIO_BENCHMARK
+#include "iio_benchmark.h"
+#endif
+
 /***************************************************************************//**
  * @brief Main function execution for linux platform.
  *
@@ -60,13 +64,17 @@ int main()
 	ret = iio_sw_trigger_example_main();
 #endif
 
+#ifdef IIO_BENCHMARK
+	ret = iio_benchmark_main();
+#endif
+
 #ifdef IIO_TIMER_TRIGGER_EXAMPLE
 #error Timer trigger example is not supported on linux platform.
 #endif
 
-#if (IIO_EXAMPLE + IIO_SW_TRIGGER_EXAMPLE == 0)
+#if (IIO_EXAMPLE + IIO_SW_TRIGGER_EXAMPLE + IIO_BENCHMARK == 0)
 #error At least one example has to be selected using y value in Makefile.
-#elif (IIO_EXAMPLE + IIO_SW_TRIGGER_EXAMPLE > 1)
+#elif (IIO_EXAMPLE + IIO_SW_TRIGGER_EXAMPLE + IIO_BENCHMARK > 1)
 #error Selected example projects cannot be enabled at the same time. \
 Please enable only one example and rebuild the project.
 #endif
@@ -62,9 +62,37 @@ const struct no_os_gpio_init_param ltc2983_gpio_rstn = {
 	.extra = GPIO_EXTRA,
 };
 
+struct no_os_gpio_init_param ltc2983_gpio_intr = {
+	.port = GPIO_INTR_PORT_NUM,
+	.number = GPIO_INTR_PIN_NUM,
+	.pull = NO_OS_PULL_NONE,
+	.platform_ops = GPIO_OPS,
+	.extra = GPIO_EXTRA,
+};
+
+#ifdef IIO_SUPPORT
+struct no_os_irq_init_param ltc2983_gpio_irq_ip = {
+	.irq_ctrl_id = GPIO_IRQ_ID,
+	.platform_ops = GPIO_IRQ_OPS,
+	.extra = GPIO_IRQ_EXTRA,
+};
+
+struct iio_hw_trig_init_param ltc2983_gpio_trig_ip = {
+	.irq_id = LTC2983_GPIO_TRIG_IRQ_ID,
+	.irq_trig_lvl = NO_OS_IRQ_EDGE_RISING,
+	.cb_info = {
+		.event = NO_OS_EVT_GPIO,
+		.peripheral = NO_OS_GPIO_IRQ,
+		.handle = LTC2983_GPIO_CB_HANDLE,
+	},
+	.name = LTC2983_GPIO_TRIG_NAME,
+};
+#endif
+
 struct ltc2983_init_param ltc2983_ip = {
 	.spi_init = ltc2983_spi_ip,
 	.gpio_rstn = ltc2983_gpio_rstn,
+	.gpio_intr = &ltc2983_gpio_intr,
 	.mux_delay_config_us = 1000,
 	.filter_notch_freq = 0,
 	.sensors[0] = NULL,
@@ -37,14 +37,23 @@
 #include "ltc2983.h"
 #ifdef IIO_SUPPORT
 #include "iio_ltc2983.h"
+#include "iio_trigger.h"
+
+#define LTC2983_GPIO_TRIG_NAME "ltc2983-dev0"
 #endif
 
 extern struct no_os_uart_init_param uip;
 
 extern const struct no_os_spi_init_param ltc2983_spi_ip;
 extern const struct no_os_gpio_init_param ltc2983_gpio_rstn;
+extern struct no_os_gpio_init_param ltc2983_gpio_intr;
 extern struct ltc2983_init_param ltc2983_ip;
 
+#ifdef IIO_SUPPORT
+extern struct no_os_irq_init_param ltc2983_gpio_irq_ip;
+extern struct iio_hw_trig_init_param ltc2983_gpio_trig_ip;
+#endif
+
 /** DC2214A Sensors */
 extern struct ltc2983_rsense ltc2983_rsense_2;
 extern struct ltc2983_thermistor ltc2983_thermistor_8;
@@ -14,7 +14,8 @@ endif
 ifeq (y,$(strip $(IIOD)))
 SRC_DIRS += $(NO-OS)/iio/iio_app
 INCS += $(DRIVERS)/temperature/ltc2983/iio_ltc2983.h
-SRCS += $(DRIVERS)/temperature/ltc2983/iio_ltc2983.c
+SRCS += $(DRIVERS)/temperature/ltc2983/iio_ltc2983.c \
+	$(DRIVERS)/temperature/ltc2983/iio_ltc2983_trig.c
 
 INCS += $(INCLUDE)/no_os_list.h \
 		$(PLATFORM_DRIVERS)/$(PLATFORM)_uart.h
@@ -35,6 +35,11 @@
 #include "common_data.h"
 #include "no_os_print_log.h"
 
+#define DATA_BUFFER_SIZE 400
+
+static uint8_t iio_data_buffer[DATA_BUFFER_SIZE * LTC2983_MAX_CHANNELS_NR *
+						 sizeof(int32_t)];
+
 /*******************************************************************************
  * @brief IIO example main execution.
  *
@@ -45,37 +50,70 @@ int iio_example_main()
 {
 	int ret;
 	struct ltc2983_iio_desc *ltc2983_iio_dev;
-	struct ltc2983_iio_desc_init_param ltc2983_iio_ip;
+	struct ltc2983_iio_desc_init_param ltc2983_iio_ip = {0};
+	struct iio_hw_trig *ltc2983_trig_desc;
+	struct no_os_irq_ctrl_desc *ltc2983_irq_desc;
 	struct iio_app_desc *app;
 	struct iio_app_init_param app_init_param = {0};
+	struct iio_data_buffer data_buff = {
+		.buff = (void *)iio_data_buffer,
+		.size = sizeof(iio_data_buffer),
+	};
 
+	/* Back to back scans, paced by the INTERRUPT pin */
 	ltc2983_iio_ip.ltc2983_desc_init_param = &ltc2983_ip;
 	ret = ltc2983_iio_init(&ltc2983_iio_dev, &ltc2983_iio_ip);
 	if (ret)
 		return ret;
 
+	ret = no_os_irq_ctrl_init(&ltc2983_irq_desc, &ltc2983_gpio_irq_ip);
+	if (ret)
+		goto remove_iio;
+
+	ltc2983_gpio_trig_ip.irq_ctrl = ltc2983_irq_desc;
+
+	ret = iio_hw_trig_init(&ltc2983_trig_desc, &ltc2983_gpio_trig_ip);
+	if (ret)
+		goto remove_irq;
+
 	struct iio_app_device iio_devices[] = {
 		{
 			.name = "ltc2983",
 			.dev = ltc2983_iio_dev,
 			.dev_descriptor = ltc2983_iio_dev->iio_dev,
+			.read_buff = &data_buff,
+			.default_trigger_id = "trigger0",
 		},
 	};
 
+	struct iio_trigger_init trigs[] = {
+		IIO_APP_TRIGGER(LTC2983_GPIO_TRIG_NAME, ltc2983_trig_desc,
+				&ltc2983_iio_trig_desc)
+	};
+
 	app_init_param.devices = iio_devices;
 	app_init_param.nb_devices = NO_OS_ARRAY_SIZE(iio_devices);
 	app_init_param.uart_init_params = uip;
+	app_init_param.trigs = trigs;
+	app_init_param.nb_trigs = NO_OS_ARRAY_SIZE(trigs);
+	app_init_param.irq_desc = ltc2983_irq_desc;
 
 	ret = iio_app_init(&app, app_init_param);
 	if (ret)
-		goto error;
+		goto remove_trig;
+
+	ltc2983_trig_desc->iio_desc = app->iio_desc;
 
 	ret = iio_app_run(app);
 	if (ret)
 		pr_info("Error: iio_app_run: %d\r\n", ret);
 
 	iio_app_remove(app);
-error:
+remove_trig:
+	iio_hw_trig_remove(ltc2983_trig_desc);
+remove_irq:
+	no_os_irq_ctrl_remove(ltc2983_irq_desc);
+remove_iio:
 	ltc2983_iio_remove(ltc2983_iio_dev);
 	return ret;
 }
@@ -64,7 +64,24 @@ int main()
 #endif
 
 #ifdef IIO_EXAMPLE
-	return iio_example_main();
+	struct no_os_irq_ctrl_desc *nvic_desc;
+	struct no_os_irq_init_param nvic_ip = {
+		.platform_ops = &max_irq_ops,
+	};
+	int ret;
+
+	/* The INTERRUPT pin trigger needs the GPIO port interrupt */
+	ret = no_os_irq_ctrl_init(&nvic_desc, &nvic_ip);
+	if (ret)
+		return ret;
+
+	ret = no_os_irq_enable(nvic_desc, NVIC_GPIO_IRQ);
+	if (!ret)
+		ret = iio_example_main();
+
+	no_os_irq_ctrl_remove(nvic_desc);
+
+	return ret;
 #endif
 
 #if (IIO_EXAMPLE + BASIC_EXAMPLE != 1)
@@ -36,6 +36,8 @@
 #include "maxim_uart_stdio.h"
 #include "maxim_spi.h"
 #include "maxim_gpio.h"
+#include "maxim_gpio_irq.h"
+#include "maxim_irq.h"
 
 #ifdef IIO_SUPPORT
 #define INTC_DEVICE_ID	0
@@ -66,9 +68,22 @@
 
 #define GPIO_RSTN_PORT_NUM	0
 #define GPIO_RSTN_PIN_NUM	27
+#define GPIO_INTR_PORT_NUM	0
+#define GPIO_INTR_PIN_NUM	26
 #define GPIO_OPS	&max_gpio_ops
 #define GPIO_EXTRA 	&max_gpio_extra
 
+#ifdef IIO_SUPPORT
+/* INTERRUPT pin trigger, fired at the end of each scan */
+#define NVIC_GPIO_IRQ	GPIO0_IRQn
+#define GPIO_IRQ_ID	GPIO_INTR_PORT_NUM
+#define GPIO_IRQ_OPS	&max_gpio_irq_ops
+#define GPIO_IRQ_EXTRA	&max_gpio_extra
+
+#define LTC2983_GPIO_TRIG_IRQ_ID	GPIO_INTR_PIN_NUM
+#define LTC2983_GPIO_CB_HANDLE		MXC_GPIO_GET_GPIO(GPIO_INTR_PORT_NUM)
+#endif
+
 extern struct max_uart_init_param max_uart_extra;
 extern struct max_spi_init_param max_spi_extra;
 extern struct max_gpio_init_param max_gpio_extra;
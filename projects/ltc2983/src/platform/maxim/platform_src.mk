@@ -2,6 +2,7 @@ INCS +=	$(PLATFORM_DRIVERS)/maxim_gpio.h      \
 		$(PLATFORM_DRIVERS)/maxim_spi.h       \
 		$(PLATFORM_DRIVERS)/../common/maxim_dma.h       \
 		$(PLATFORM_DRIVERS)/maxim_irq.h      \
+		$(PLATFORM_DRIVERS)/maxim_gpio_irq.h      \
 		$(PLATFORM_DRIVERS)/maxim_uart.h      \
 		$(PLATFORM_DRIVERS)/maxim_uart_stdio.h
 
@@ -10,5 +11,6 @@ SRCS += $(PLATFORM_DRIVERS)/maxim_delay.c     \
 		$(PLATFORM_DRIVERS)/maxim_spi.c       \
 		$(PLATFORM_DRIVERS)/../common/maxim_dma.c       \
 		$(PLATFORM_DRIVERS)/maxim_irq.c      \
+		$(PLATFORM_DRIVERS)/maxim_gpio_irq.c      \
 		$(PLATFORM_DRIVERS)/maxim_uart.c      \
 		$(PLATFORM_DRIVERS)/maxim_uart_stdio.c
@@ -16,6 +16,10 @@ INCS += $(INCLUDE)/no_os_delay.h		\
 	$(INCLUDE)/no_os_alloc.h		\
 	$(INCLUDE)/no_os_irq.h			\
 	$(INCLUDE)/no_os_list.h			\
+	$(INCLUDE)/no_os_crc.h		\
+	$(INCLUDE)/no_os_crc8.h		\
+	$(INCLUDE)/no_os_crc16.h		\
+	$(INCLUDE)/no_os_crc24.h		\
 	$(INCLUDE)/no_os_dma.h			\
 	$(INCLUDE)/no_os_uart.h			\
 	$(INCLUDE)/no_os_lf256fifo.h		\
@@ -29,6 +33,10 @@ SRCS += $(DRIVERS)/api/no_os_spi.c		\
 	$(DRIVERS)/api/no_os_gpio.c		\
 	$(DRIVERS)/api/no_os_dma.c		\
 	$(NO-OS)/util/no_os_list.c		\
+	$(NO-OS)/util/no_os_crc.c		\
+	$(NO-OS)/util/no_os_crc8.c		\
+	$(NO-OS)/util/no_os_crc16.c		\
+	$(NO-OS)/util/no_os_crc24.c		\
 	$(NO-OS)/util/no_os_alloc.c		\
 	$(NO-OS)/util/no_os_lf256fifo.c		\
 	$(NO-OS)/util/no_os_mutex.c		\
@@ -28,7 +28,10 @@ INCS += $(INCLUDE)/no_os_delay.h     \
 		$(INCLUDE)/no_os_list.h      \
 		$(INCLUDE)/no_os_dma.h      \
 		$(INCLUDE)/no_os_mutex.h      \
+		$(INCLUDE)/no_os_crc.h      \
 		$(INCLUDE)/no_os_crc8.h      \
+		$(INCLUDE)/no_os_crc16.h      \
+		$(INCLUDE)/no_os_crc24.h      \
 		$(INCLUDE)/no_os_uart.h      \
 		$(INCLUDE)/no_os_mutex.h      \
 		$(INCLUDE)/no_os_i2c.h      \
@@ -49,7 +52,10 @@ SRCS += $(DRIVERS)/api/no_os_gpio.c \
 		$(DRIVERS)/api/no_os_mdio.c \
 		$(DRIVERS)/api/no_os_dma.c \
 		$(NO-OS)/util/no_os_list.c \
+		$(NO-OS)/util/no_os_crc.c \
 		$(NO-OS)/util/no_os_crc8.c \
+		$(NO-OS)/util/no_os_crc16.c \
+		$(NO-OS)/util/no_os_crc24.c \
 		$(NO-OS)/util/no_os_util.c \
 		$(NO-OS)/util/no_os_mutex.c \
 		$(NO-OS)/util/no_os_alloc.c
@@ -44,6 +44,7 @@
 #include "mock_no_os_gpio.h"
 #include "mock_no_os_spi.h"
 #include "mock_no_os_alloc.h"
+#include "mock_no_os_regmap.h"
 #include <errno.h>
 
 /*******************************************************************************
@@ -3972,6 +3973,77 @@ void test_adis_read_burst_data_6(void)
 	TEST_ASSERT_EQUAL_INT(-EINVAL, retval);
 }
 
+/**
+ * @brief Test adis_read_burst_data_fifo with invalid number of samples.
+ */
+void test_adis_read_burst_data_fifo_1(void)
+{
+	device_alloc.info = adis_chip_info;
+	struct adis_burst_data data[ADIS_FIFO_BURST_MAX_FRAMES];
+	uint16_t nb_samples = 0;
+
+	retval = adis_read_burst_data_fifo(&device_alloc, data, &nb_samples,
+					   device_alloc.burst32, device_alloc.burst_sel, true);
+	TEST_ASSERT_EQUAL_INT(-EINVAL, retval);
+
+	nb_samples = ADIS_FIFO_BURST_MAX_FRAMES + 1;
+	retval = adis_read_burst_data_fifo(&device_alloc, data, &nb_samples,
+					   device_alloc.burst32, device_alloc.burst_sel, true);
+	TEST_ASSERT_EQUAL_INT(-EINVAL, retval);
+}
+
+/**
+ * @brief Test adis_read_burst_data_fifo for device without fifo.
+ */
+void test_adis_read_burst_data_fifo_2(void)
+{
+	device_alloc.info = adis_chip_info;
+	struct adis_burst_data data[ADIS_FIFO_BURST_MAX_FRAMES];
+	uint16_t nb_samples = ADIS_FIFO_BURST_MAX_FRAMES;
+
+	retval = adis_read_burst_data_fifo(&device_alloc, data, &nb_samples,
+					   device_alloc.burst32, device_alloc.burst_sel, true);
+	TEST_ASSERT_EQUAL_INT(-EINVAL, retval);
+}
+
+/**
+ * @brief Test adis_read_burst_data_fifo with invalid spi transfer.
+ */
+void test_adis_read_burst_data_fifo_3(void)
+{
+	device_alloc.info = adis_chip_info;
+	struct adis_burst_data data[ADIS_FIFO_BURST_MAX_FRAMES];
+	uint16_t nb_samples = ADIS_FIFO_BURST_MAX_FRAMES;
+
+	device_alloc.burst32 = 0;
+	device_alloc.burst_sel = 0;
+
+	no_os_spi_transfer_dma_IgnoreAndReturn(-ENOSYS);
+	no_os_spi_transfer_IgnoreAndReturn(-1);
+	retval = adis_read_burst_data_fifo(&device_alloc, data, &nb_samples,
+					   device_alloc.burst32, device_alloc.burst_sel, true);
+	TEST_ASSERT_EQUAL_INT(-1, retval);
+}
+
+/**
+ * @brief Test adis_read_burst_data_fifo with empty fifo.
+ */
+void test_adis_read_burst_data_fifo_4(void)
+{
+	device_alloc.info = adis_chip_info;
+	struct adis_burst_data data[ADIS_FIFO_BURST_MAX_FRAMES];
+	uint16_t nb_samples = ADIS_FIFO_BURST_MAX_FRAMES;
+
+	device_alloc.burst32 = 0;
+	device_alloc.burst_sel = 0;
+
+	no_os_spi_transfer_dma_IgnoreAndReturn(0);
+	retval = adis_read_burst_data_fifo(&device_alloc, data, &nb_samples,
+					   device_alloc.burst32, device_alloc.burst_sel, true);
+	TEST_ASSERT_EQUAL_INT(-EAGAIN, retval);
+	TEST_ASSERT_EQUAL_INT(0, nb_samples);
+}
+
 /**
  * @brief Test adis_update_ext_clk_freq with unsuccessful SPI read for
  * sync mode.
@@ -45,6 +45,7 @@
 #include "mock_no_os_gpio.h"
 #include "mock_no_os_spi.h"
 #include "mock_no_os_alloc.h"
+#include "mock_no_os_regmap.h"
 #include <errno.h>
 
 /*******************************************************************************
@@ -572,6 +573,12 @@ void test_adis1650x_read_burst_data(void)
 	test_adis_read_burst_data_6();
 }
 
+void test_adis1650x_read_burst_data_fifo(void)
+{
+	test_adis_read_burst_data_fifo_1();
+	test_adis_read_burst_data_fifo_2();
+}
+
 void test_adis1650x_update_ext_clk_freq(void)
 {
 	test_adis_update_ext_clk_freq_1();
@@ -45,6 +45,7 @@
 #include "mock_no_os_gpio.h"
 #include "mock_no_os_spi.h"
 #include "mock_no_os_alloc.h"
+#include "mock_no_os_regmap.h"
 #include <errno.h>
 
 /*******************************************************************************
@@ -797,6 +798,13 @@ void test_adis1657x_read_burst_data(void)
 	test_adis_read_burst_data_6();
 }
 
+void test_adis1657x_read_burst_data_fifo(void)
+{
+	test_adis_read_burst_data_fifo_1();
+	test_adis_read_burst_data_fifo_3();
+	test_adis_read_burst_data_fifo_4();
+}
+
 void test_adis1657x_update_ext_clk_freq(void)
 {
 	test_adis_update_ext_clk_freq_1();
@@ -0,0 +1,179 @@
+/***************************************************************************//**
+ *   @file   test_adis_burst.c
+ *   @brief  Bulk burst frame decoding tests for adis driver.
+ *******************************************************************************
+ * Copyright 2026(c) Analog Devices, Inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Analog Devices, Inc. nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ANALOG DEVICES, INC. “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL ANALOG DEVICES, INC. BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+
+/*******************************************************************************
+ *    INCLUDED FILES
+ ******************************************************************************/
+
+#include "unity.h"
+#include "adis.h"
+#include "adis_internals.h"
+#include "no_os_util.h"
+#include "mock_no_os_delay.h"
+#include "mock_no_os_gpio.h"
+#include "mock_no_os_spi.h"
+#include "mock_no_os_alloc.h"
+#include "mock_no_os_regmap.h"
+#include <string.h>
+
+/*******************************************************************************
+ *    PRIVATE DATA
+ ******************************************************************************/
+
+/* Burst frame sizes, without command bytes, as captured from adis1657x. */
+#define BURST_FRAME_SIZE_16	20
+#define BURST_FRAME_SIZE_32	34
+#define BURST_CHECKSUM_IDX	2
+#define BURST_NB_FRAMES		512
+
+static uint8_t frames[BURST_NB_FRAMES][BURST_FRAME_SIZE_32];
+
+/*******************************************************************************
+ *    PRIVATE FUNCTIONS
+ ******************************************************************************/
+
+/**
+ * @brief Byte-wise reference implementation of the burst checksum check.
+ */
+static bool ref_validate_checksum(uint8_t *buffer, uint8_t size, uint8_t idx)
+{
+	uint16_t checksum = (buffer[size - 2] << 8) | buffer[size - 1];
+	uint8_t i;
+
+	for (i = idx; i < size - 2; i++)
+		checksum -= buffer[i];
+
+	return checksum == 0;
+}
+
+/**
+ * @brief Fill the burst frames with pseudo-random sensor data, an incrementing
+ * data counter and a valid checksum.
+ */
+static void fill_frames(uint8_t size)
+{
+	uint32_t seed = 0x12345678;
+	uint16_t checksum;
+	uint32_t i;
+	uint8_t j;
+
+	for (i = 0; i < BURST_NB_FRAMES; i++) {
+		for (j = 0; j < size - 2; j++) {
+			seed = seed * 1103515245 + 12345;
+			frames[i][j] = seed >> 16;
+		}
+		no_os_put_unaligned_be16(i + 1, &frames[i][size - 4]);
+
+		checksum = 0;
+		for (j = BURST_CHECKSUM_IDX; j < size - 2; j++)
+			checksum += frames[i][j];
+		no_os_put_unaligned_be16(checksum, &frames[i][size - 2]);
+	}
+}
+
+/*******************************************************************************
+ *    SETUP, TEARDOWN
+ ******************************************************************************/
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+/*******************************************************************************
+ *    TESTS
+ ******************************************************************************/
+
+/**
+ * @brief Test adis_validate_checksum against the byte-wise implementation, for
+ * valid and corrupted frames of both burst sizes.
+ */
+void test_adis_validate_checksum_bulk(void)
+{
+	uint8_t sizes[] = {BURST_FRAME_SIZE_16, BURST_FRAME_SIZE_32};
+	uint32_t i;
+	uint8_t k;
+
+	for (k = 0; k < NO_OS_ARRAY_SIZE(sizes); k++) {
+		fill_frames(sizes[k]);
+		for (i = 0; i < BURST_NB_FRAMES; i++) {
+			TEST_ASSERT_TRUE(adis_validate_checksum(frames[i], sizes[k],
+								BURST_CHECKSUM_IDX));
+			frames[i][i % (sizes[k] - 2)] ^= 0x10;
+			TEST_ASSERT_EQUAL(ref_validate_checksum(frames[i], sizes[k],
+								BURST_CHECKSUM_IDX),
+					  adis_validate_checksum(frames[i], sizes[k],
+							  BURST_CHECKSUM_IDX));
+		}
+	}
+}
+
+/**
+ * @brief Test adis_burst_data_pack with a word map including padding.
+ */
+void test_adis_burst_data_pack(void)
+{
+	const uint8_t word_map[] = {
+		ADIS_BURST_DATA_WORD(x_gyro_msb),
+		ADIS_BURST_DATA_WORD(x_gyro_lsb),
+		ADIS_BURST_DATA_WORD(temp_lsb),
+		ADIS_BURST_SCAN_PAD,
+		ADIS_BURST_DATA_WORD(z_accel_msb),
+		ADIS_BURST_DATA_WORD(z_accel_lsb),
+	};
+	struct adis_burst_data data[2];
+	uint16_t out[2 * NO_OS_ARRAY_SIZE(word_map)];
+	uint8_t i;
+
+	for (i = 0; i < 2; i++) {
+		memset(&data[i], 0xFF, sizeof(data[i]));
+		data[i].x_gyro_msb = 0x100 + i;
+		data[i].x_gyro_lsb = 0x200 + i;
+		data[i].temp_lsb = 0x300 + i;
+		data[i].z_accel_msb = 0x400 + i;
+		data[i].z_accel_lsb = 0x500 + i;
+	}
+
+	adis_burst_data_pack(data, 2, word_map, NO_OS_ARRAY_SIZE(word_map), out);
+
+	for (i = 0; i < 2; i++) {
+		TEST_ASSERT_EQUAL_HEX16(0x100 + i, out[i * 6]);
+		TEST_ASSERT_EQUAL_HEX16(0x200 + i, out[i * 6 + 1]);
+		TEST_ASSERT_EQUAL_HEX16(0x300 + i, out[i * 6 + 2]);
+		TEST_ASSERT_EQUAL_HEX16(0, out[i * 6 + 3]);
+		TEST_ASSERT_EQUAL_HEX16(0x400 + i, out[i * 6 + 4]);
+		TEST_ASSERT_EQUAL_HEX16(0x500 + i, out[i * 6 + 5]);
+	}
+}
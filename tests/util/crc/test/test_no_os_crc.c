@@ -0,0 +1,205 @@
+/***************************************************************************//**
+ *   @file   test_no_os_crc.c
+ *   @brief  CRC engine tests.
+ *******************************************************************************
+ * Copyright 2026(c) Analog Devices, Inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Analog Devices, Inc. nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ANALOG DEVICES, INC. “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL ANALOG DEVICES, INC. BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+
+/*******************************************************************************
+ *    INCLUDED FILES
+ ******************************************************************************/
+
+#include "unity.h"
+#include "no_os_crc.h"
+#include "no_os_error.h"
+#include "no_os_util.h"
+#include <string.h>
+
+/*******************************************************************************
+ *    PRIVATE DATA
+ ******************************************************************************/
+
+#define CRC_BUF_SIZE		4096
+#define CRC_NB_LENGTHS		300
+
+static uint8_t buf[CRC_BUF_SIZE];
+static uint32_t table[NO_OS_CRC_TABLE_WORDS(24, 8)];
+
+/* Polynomials used by no-OS drivers, msb first without the x^width term. */
+static const struct {
+	uint8_t width;
+	uint32_t polynomial;
+} crcs[] = {
+	{5, 0x15},		/* max149x6 */
+	{8, 0x07},		/* ad7124, ad74413r */
+	{8, 0x31},		/* max22017 */
+	{16, 0x755B},		/* ad7606 */
+	{24, 0x5D6DCB},		/* adas1000 */
+};
+
+/*******************************************************************************
+ *    PRIVATE FUNCTIONS
+ ******************************************************************************/
+
+/**
+ * @brief Bit by bit reference implementation of an msb-first CRC.
+ */
+static uint32_t ref_crc(uint8_t width, uint32_t polynomial,
+			const uint8_t *pdata, size_t nbytes, uint32_t crc)
+{
+	uint32_t mask = (1UL << width) - 1;
+	uint32_t top = 1UL << (width - 1);
+	bool bit;
+	int8_t i;
+
+	while (nbytes--) {
+		for (i = 7; i >= 0; i--) {
+			bit = !!(crc & top) ^ ((*pdata >> i) & 1);
+			crc = (crc << 1) & mask;
+			if (bit)
+				crc ^= polynomial;
+		}
+		pdata++;
+	}
+
+	return crc;
+}
+
+/**
+ * @brief Fill the data buffer with pseudo-random bytes.
+ */
+static void fill_buf(void)
+{
+	uint32_t seed = 0x12345678;
+	uint32_t i;
+
+	for (i = 0; i < CRC_BUF_SIZE; i++) {
+		seed = seed * 1103515245 + 12345;
+		buf[i] = seed >> 16;
+	}
+}
+
+/*******************************************************************************
+ *    SETUP, TEARDOWN
+ ******************************************************************************/
+
+void setUp(void)
+{
+	fill_buf();
+}
+
+void tearDown(void)
+{
+}
+
+/*******************************************************************************
+ *    TESTS
+ ******************************************************************************/
+
+/**
+ * @brief Test the slicing tables against the byte-wise tables.
+ */
+void test_no_os_crc_slice(void)
+{
+	static uint8_t t8[8][NO_OS_CRC8_TABLE_SIZE];
+	static uint16_t t16[8][NO_OS_CRC16_TABLE_SIZE];
+	static uint32_t t24[4][NO_OS_CRC24_TABLE_SIZE];
+	uint32_t n;
+
+	no_os_crc8_populate_slice_msb(t8, 8, 0x07);
+	no_os_crc16_populate_slice_msb(t16, 8, 0x755B);
+	no_os_crc24_populate_slice_msb(t24, 4, 0x5D6DCB);
+
+	for (n = 0; n < CRC_NB_LENGTHS; n++) {
+		TEST_ASSERT_EQUAL_HEX8(no_os_crc8(t8[0], buf + n, n, 0xA5),
+				       no_os_crc8_slice((const uint8_t (*)[NO_OS_CRC8_TABLE_SIZE])t8,
+						       8, buf + n, n, 0xA5));
+		TEST_ASSERT_EQUAL_HEX16(no_os_crc16(t16[0], buf + n, n, 0x1234),
+					no_os_crc16_slice((const uint16_t (*)[NO_OS_CRC16_TABLE_SIZE])t16,
+							8, buf + n, n, 0x1234));
+		TEST_ASSERT_EQUAL_HEX32(no_os_crc24(t24[0], buf + n, n, 0x123456),
+					no_os_crc24_slice((const uint32_t (*)[NO_OS_CRC24_TABLE_SIZE])t24,
+							4, buf + n, n, 0x123456));
+	}
+}
+
+/**
+ * @brief Test every engine configuration against the bitwise reference, for
+ * all lengths around the folding thresholds and unaligned buffers.
+ */
+void test_no_os_crc_engine(void)
+{
+	const uint8_t slices[] = {1, 4, 8};
+	struct no_os_crc_engine engine;
+	uint32_t init;
+	uint32_t n;
+	uint8_t c, s, impl;
+
+	for (c = 0; c < NO_OS_ARRAY_SIZE(crcs); c++) {
+		for (s = 0; s < NO_OS_ARRAY_SIZE(slices); s++) {
+			for (impl = NO_OS_CRC_IMPL_AUTO; impl <= NO_OS_CRC_IMPL_TABLE; impl++) {
+				memset(&engine, 0, sizeof(engine));
+				engine.width = crcs[c].width;
+				engine.polynomial = crcs[c].polynomial;
+				engine.nb_slices = slices[s];
+				engine.impl = impl;
+				engine.table = table;
+
+				for (n = 0; n < CRC_NB_LENGTHS; n++) {
+					init = (n * 0x9E3779B9) & ((1UL << crcs[c].width) - 1);
+					TEST_ASSERT_EQUAL_HEX32(ref_crc(crcs[c].width,
+									crcs[c].polynomial,
+									buf + (n & 7), n, init),
+								no_os_crc_compute(&engine, buf + (n & 7),
+										n, init));
+				}
+			}
+		}
+	}
+}
+
+/**
+ * @brief Test the engine parameter validation.
+ */
+void test_no_os_crc_engine_setup(void)
+{
+	struct no_os_crc_engine engine = {
+		.width = 25,
+		.polynomial = 0x1,
+		.nb_slices = 1,
+		.table = table,
+	};
+
+	TEST_ASSERT_EQUAL_INT(-EINVAL, no_os_crc_engine_setup(&engine));
+	engine.width = 8;
+	engine.nb_slices = 2;
+	TEST_ASSERT_EQUAL_INT(-EINVAL, no_os_crc_engine_setup(&engine));
+	engine.nb_slices = 4;
+	TEST_ASSERT_EQUAL_INT(0, no_os_crc_engine_setup(&engine));
+	TEST_ASSERT_TRUE(engine.ready);
+}
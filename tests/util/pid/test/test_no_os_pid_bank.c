@@ -0,0 +1,238 @@
+/***************************************************************************//**
+ *   @file   test_no_os_pid_bank.c
+ *   @brief  Unit tests and benchmark for the PID controller bank.
+ *******************************************************************************
+ * Copyright 2026(c) Analog Devices, Inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Analog Devices, Inc. nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ANALOG DEVICES, INC. “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL ANALOG DEVICES, INC. BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+
+/*******************************************************************************
+ *    INCLUDED FILES
+ ******************************************************************************/
+
+#include "unity.h"
+#include "no_os_pid.h"
+#include "no_os_error.h"
+#include "no_os_util.h"
+#include <stdio.h>
+#include <time.h>
+
+/*******************************************************************************
+ *    PRIVATE DATA
+ ******************************************************************************/
+
+#define NB_LOOPS		48
+#define NB_STEPS		2000
+#define BENCH_STEPS		20000
+
+static struct no_os_pid_config configs[NB_LOOPS];
+static struct no_os_pid *pids[NB_LOOPS];
+static int sp[NB_LOOPS];
+static int pv[NB_LOOPS];
+static int out_ref[NB_LOOPS];
+static int out_bank[NB_LOOPS];
+static uint32_t seed;
+
+/*******************************************************************************
+ *    PRIVATE FUNCTIONS
+ ******************************************************************************/
+
+static uint32_t rand_next(void)
+{
+	seed = seed * 1103515245 + 12345;
+
+	return seed >> 8;
+}
+
+/**
+ * @brief Fill the configurations with gains the bank represents exactly
+ * (multiples of 15625 micro-units), with and without clipping and hysteresis.
+ */
+static void fill_configs(void)
+{
+	unsigned int n;
+
+	seed = 0xC0FFEE;
+	for (n = 0; n < NB_LOOPS; n++) {
+		configs[n].Kp = 15625 * (rand_next() % 256);
+		configs[n].Ki = 15625 * (rand_next() % 64);
+		configs[n].Kd = 15625 * (rand_next() % 32);
+		configs[n].hysteresis = n % 3 ? rand_next() % 8 : 0;
+		configs[n].i_clip.high = n % 2 ? 500 : 0;
+		configs[n].i_clip.low = n % 2 ? -500 : 0;
+		configs[n].output_clip.high = n % 4 ? 4095 : 0;
+		configs[n].output_clip.low = 0;
+		configs[n].initial = n * 10;
+	}
+}
+
+/**
+ * @brief Plant model shared by both controllers: the process variable follows
+ * the output with a gain, a clamp and noise, so both see identical inputs as long as
+ * their outputs match.
+ */
+static void plant_step(const int *out)
+{
+	unsigned int n;
+
+	for (n = 0; n < NB_LOOPS; n++) {
+		if (!(rand_next() % 64))
+			sp[n] = rand_next() % 2048;
+		pv[n] = no_os_clamp(out[n] / 2, -4096, 4096) +
+			(int)(rand_next() % 16) - 8;
+	}
+}
+
+static uint32_t elapsed_us(clock_t start)
+{
+	return (uint32_t)((clock() - start) * 1000000.0 / CLOCKS_PER_SEC);
+}
+
+/*******************************************************************************
+ *    SETUP, TEARDOWN
+ ******************************************************************************/
+
+void setUp(void)
+{
+	fill_configs();
+}
+
+void tearDown(void)
+{
+}
+
+/*******************************************************************************
+ *    TESTS
+ ******************************************************************************/
+
+/**
+ * @brief Test that the bank produces the same outputs as independent
+ * no_os_pid controllers over a closed loop run.
+ */
+void test_no_os_pid_bank_matches_scalar(void)
+{
+	struct no_os_pid_bank *bank;
+	unsigned int step;
+	unsigned int n;
+
+	TEST_ASSERT_EQUAL_INT(0, no_os_pid_bank_init(&bank, configs, NB_LOOPS));
+	for (n = 0; n < NB_LOOPS; n++) {
+		TEST_ASSERT_EQUAL_INT(0, no_os_pid_init(&pids[n], configs[n]));
+		sp[n] = 1000;
+		pv[n] = 0;
+	}
+
+	for (step = 0; step < NB_STEPS; step++) {
+		for (n = 0; n < NB_LOOPS; n++)
+			no_os_pid_control(pids[n], sp[n], pv[n], &out_ref[n]);
+		TEST_ASSERT_EQUAL_INT(0, no_os_pid_bank_control(bank, sp, pv,
+					 out_bank));
+		TEST_ASSERT_EQUAL_INT_ARRAY(out_ref, out_bank, NB_LOOPS);
+
+		if (step == NB_STEPS / 2) {
+			for (n = 0; n < NB_LOOPS; n++) {
+				no_os_pid_reset(pids[n]);
+				no_os_pid_hysteresis(pids[n], 4);
+				no_os_pid_bank_hysteresis(bank, n, 4);
+			}
+			no_os_pid_bank_reset(bank);
+		}
+
+		plant_step(out_ref);
+	}
+
+	for (n = 0; n < NB_LOOPS; n++)
+		no_os_pid_remove(pids[n]);
+	no_os_pid_bank_remove(bank);
+}
+
+/**
+ * @brief Test the parameter checks of the bank API.
+ */
+void test_no_os_pid_bank_invalid(void)
+{
+	struct no_os_pid_bank *bank;
+
+	TEST_ASSERT_EQUAL_INT(-EINVAL, no_os_pid_bank_init(NULL, configs, 1));
+	TEST_ASSERT_EQUAL_INT(-EINVAL, no_os_pid_bank_init(&bank, configs, 0));
+	configs[1].output_clip.low = 10;
+	configs[1].output_clip.high = 0;
+	TEST_ASSERT_EQUAL_INT(-EINVAL, no_os_pid_bank_init(&bank, configs, 2));
+
+	TEST_ASSERT_EQUAL_INT(0, no_os_pid_bank_init(&bank, configs, 1));
+	TEST_ASSERT_EQUAL_INT(-EINVAL, no_os_pid_bank_control(bank, NULL, pv,
+			      out_bank));
+	TEST_ASSERT_EQUAL_INT(-EINVAL, no_os_pid_bank_hysteresis(bank, 1, 0));
+	TEST_ASSERT_EQUAL_INT(0, no_os_pid_bank_remove(bank));
+}
+
+/**
+ * @brief Benchmark the bank against stepping the scalar controllers in turn.
+ */
+void test_no_os_pid_bank_benchmark(void)
+{
+	struct no_os_pid_bank *bank;
+	uint32_t scalar_us;
+	uint32_t bank_us;
+	clock_t start;
+	unsigned int step;
+	unsigned int n;
+	char msg[128];
+
+	TEST_ASSERT_EQUAL_INT(0, no_os_pid_bank_init(&bank, configs, NB_LOOPS));
+	for (n = 0; n < NB_LOOPS; n++) {
+		TEST_ASSERT_EQUAL_INT(0, no_os_pid_init(&pids[n], configs[n]));
+		sp[n] = 1000 + n;
+		pv[n] = n;
+	}
+
+	start = clock();
+	for (step = 0; step < BENCH_STEPS; step++) {
+		for (n = 0; n < NB_LOOPS; n++)
+			no_os_pid_control(pids[n], sp[n], pv[n] + (step & 63),
+					  &out_ref[n]);
+	}
+	scalar_us = elapsed_us(start);
+
+	start = clock();
+	for (step = 0; step < BENCH_STEPS; step++) {
+		for (n = 0; n < NB_LOOPS; n++)
+			pv[n] = n + (step & 63);
+		no_os_pid_bank_control(bank, sp, pv, out_bank);
+	}
+	bank_us = elapsed_us(start);
+
+	TEST_ASSERT_EQUAL_INT_ARRAY(out_ref, out_bank, NB_LOOPS);
+
+	snprintf(msg, sizeof(msg), "%u loops x %u steps: scalar %u us, bank %u us",
+		 NB_LOOPS, BENCH_STEPS, scalar_us, bank_us);
+	TEST_MESSAGE(msg);
+
+	for (n = 0; n < NB_LOOPS; n++)
+		no_os_pid_remove(pids[n]);
+	no_os_pid_bank_remove(bank);
+}
@@ -0,0 +1,325 @@
+/***************************************************************************//**
+ *   @file   test_no_os_regmap.c
+ *   @brief  Unit tests for the register map cache.
+ *******************************************************************************
+ * Copyright 2026(c) Analog Devices, Inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Analog Devices, Inc. nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ANALOG DEVICES, INC. “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL ANALOG DEVICES, INC. BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+
+/*******************************************************************************
+ *    INCLUDED FILES
+ ******************************************************************************/
+
+#include "unity.h"
+#include "no_os_regmap.h"
+#include "no_os_alloc.h"
+#include "no_os_error.h"
+#include "no_os_util.h"
+#include <string.h>
+
+/*******************************************************************************
+ *    PRIVATE DATA
+ ******************************************************************************/
+
+#define NB_REGS			16
+#define VOLATILE_REG		0
+
+/* Register file of the emulated device and its bus access counters. */
+static uint32_t regs[NB_REGS];
+static uint32_t nb_reads;
+static uint32_t nb_writes;
+static uint32_t nb_bulk_writes;
+static uint32_t bulk_lens;
+
+static struct no_os_regmap *map;
+
+/*******************************************************************************
+ *    PRIVATE FUNCTIONS
+ ******************************************************************************/
+
+static int bus_read(void *ctx, uint32_t reg, uint32_t *val)
+{
+	*val = regs[reg];
+	nb_reads++;
+
+	return 0;
+}
+
+static int bus_write(void *ctx, uint32_t reg, uint32_t val)
+{
+	regs[reg] = val;
+	nb_writes++;
+
+	return 0;
+}
+
+static int bus_bulk_write(void *ctx, uint32_t reg, const uint32_t *vals,
+			  uint32_t nb)
+{
+	memcpy(&regs[reg], vals, nb * sizeof(*vals));
+	nb_bulk_writes++;
+	bulk_lens += nb;
+
+	return 0;
+}
+
+static bool volatile_reg(void *ctx, uint32_t reg)
+{
+	return reg == VOLATILE_REG;
+}
+
+static const struct no_os_regmap_bus bus = {
+	.reg_read = bus_read,
+	.reg_write = bus_write,
+	.bulk_write = bus_bulk_write,
+};
+
+static void map_init(enum no_os_regmap_cache_type cache_type,
+		     uint32_t max_burst)
+{
+	struct no_os_regmap_init_param ip = {
+		.bus = &bus,
+		.nb_regs = NB_REGS,
+		.cache_type = cache_type,
+		.max_burst = max_burst,
+		.volatile_reg = volatile_reg,
+	};
+
+	TEST_ASSERT_EQUAL_INT(0, no_os_regmap_init(&map, &ip));
+}
+
+/*******************************************************************************
+ *    SETUP, TEARDOWN
+ ******************************************************************************/
+
+void setUp(void)
+{
+	uint32_t i;
+
+	for (i = 0; i < NB_REGS; i++)
+		regs[i] = 0x100 + i;
+	nb_reads = 0;
+	nb_writes = 0;
+	nb_bulk_writes = 0;
+	bulk_lens = 0;
+	map = NULL;
+}
+
+void tearDown(void)
+{
+	no_os_regmap_remove(map);
+}
+
+/*******************************************************************************
+ *    TESTS
+ ******************************************************************************/
+
+/**
+ * @brief Write-through: reads are cached, writes reach the device right away
+ * and update_bits skips writes which would not change the register.
+ */
+void test_no_os_regmap_write_through(void)
+{
+	const uint32_t burst[] = {1, 2, 3, 4, 5, 6};
+	uint32_t val;
+
+	map_init(NO_OS_REGMAP_CACHE_WRITE_THROUGH, 0);
+
+	TEST_ASSERT_EQUAL_INT(0, no_os_regmap_read(map, 3, &val));
+	TEST_ASSERT_EQUAL_HEX32(0x103, val);
+	TEST_ASSERT_EQUAL_INT(0, no_os_regmap_read(map, 3, &val));
+	TEST_ASSERT_EQUAL_HEX32(0x103, val);
+	TEST_ASSERT_EQUAL_UINT32(1, nb_reads);
+	TEST_ASSERT_EQUAL_UINT32(1, map->stats.cache_hits);
+
+	TEST_ASSERT_EQUAL_INT(0, no_os_regmap_write(map, 3, 0xAA));
+	TEST_ASSERT_EQUAL_HEX32(0xAA, regs[3]);
+	TEST_ASSERT_EQUAL_UINT32(1, nb_writes);
+	TEST_ASSERT_EQUAL_INT(0, no_os_regmap_read(map, 3, &val));
+	TEST_ASSERT_EQUAL_HEX32(0xAA, val);
+	TEST_ASSERT_EQUAL_UINT32(1, nb_reads);
+
+	TEST_ASSERT_EQUAL_INT(0, no_os_regmap_update_bits(map, 3, 0xF0, 0xA0));
+	TEST_ASSERT_EQUAL_UINT32(1, nb_writes);
+	TEST_ASSERT_EQUAL_UINT32(1, map->stats.writes_skipped);
+	TEST_ASSERT_EQUAL_INT(0, no_os_regmap_field_write(map, 3, 0xF0, 0x5));
+	TEST_ASSERT_EQUAL_HEX32(0x5A, regs[3]);
+	TEST_ASSERT_EQUAL_UINT32(2, nb_writes);
+	TEST_ASSERT_EQUAL_INT(0, no_os_regmap_field_read(map, 3, 0x0F, &val));
+	TEST_ASSERT_EQUAL_HEX32(0xA, val);
+	TEST_ASSERT_EQUAL_UINT32(1, nb_reads);
+
+	/* Consecutive writes go out as bulk writes of at most max_burst. */
+	map->max_burst = 4;
+	TEST_ASSERT_EQUAL_INT(0, no_os_regmap_bulk_write(map, 4, burst, 6));
+	TEST_ASSERT_EQUAL_UINT32(2, nb_bulk_writes);
+	TEST_ASSERT_EQUAL_UINT32(6, bulk_lens);
+	TEST_ASSERT_EQUAL_HEX32(6, regs[9]);
+}
+
+/**
+ * @brief Write-back: writes stay in the cache until no_os_regmap_sync(), which
+ * sends each run of dirty registers in bursts of at most max_burst.
+ */
+void test_no_os_regmap_write_back(void)
+{
+	uint32_t val;
+
+	map_init(NO_OS_REGMAP_CACHE_WRITE_BACK, 2);
+
+	TEST_ASSERT_EQUAL_INT(0, no_os_regmap_write(map, 1, 0x11));
+	TEST_ASSERT_EQUAL_INT(0, no_os_regmap_write(map, 2, 0x22));
+	TEST_ASSERT_EQUAL_INT(0, no_os_regmap_write(map, 3, 0x33));
+	TEST_ASSERT_EQUAL_INT(0, no_os_regmap_write(map, 5, 0x55));
+	TEST_ASSERT_EQUAL_INT(0, no_os_regmap_write(map, 5, 0x56));
+	TEST_ASSERT_EQUAL_UINT32(0, nb_writes + nb_bulk_writes);
+	TEST_ASSERT_EQUAL_UINT32(4, map->nb_dirty);
+	TEST_ASSERT_EQUAL_HEX32(0x101, regs[1]);
+
+	TEST_ASSERT_EQUAL_INT(0, no_os_regmap_read(map, 5, &val));
+	TEST_ASSERT_EQUAL_HEX32(0x56, val);
+	TEST_ASSERT_EQUAL_UINT32(0, nb_reads);
+
+	TEST_ASSERT_EQUAL_INT(0, no_os_regmap_sync(map));
+	TEST_ASSERT_EQUAL_UINT32(0, map->nb_dirty);
+	TEST_ASSERT_EQUAL_UINT32(1, nb_bulk_writes);
+	TEST_ASSERT_EQUAL_UINT32(2, nb_writes);
+	TEST_ASSERT_EQUAL_HEX32(0x11, regs[1]);
+	TEST_ASSERT_EQUAL_HEX32(0x22, regs[2]);
+	TEST_ASSERT_EQUAL_HEX32(0x33, regs[3]);
+	TEST_ASSERT_EQUAL_HEX32(0x104, regs[4]);
+	TEST_ASSERT_EQUAL_HEX32(0x56, regs[5]);
+
+	/* Nothing left to flush. */
+	TEST_ASSERT_EQUAL_INT(0, no_os_regmap_sync(map));
+	TEST_ASSERT_EQUAL_UINT32(2, nb_writes);
+
+	/* Leaving write-back flushes the pending writes. */
+	TEST_ASSERT_EQUAL_INT(0, no_os_regmap_write(map, 7, 0x77));
+	TEST_ASSERT_EQUAL_INT(0, no_os_regmap_set_cache_type(map,
+			      NO_OS_REGMAP_CACHE_WRITE_THROUGH));
+	TEST_ASSERT_EQUAL_HEX32(0x77, regs[7]);
+	TEST_ASSERT_EQUAL_UINT32(0, map->nb_dirty);
+}
+
+/**
+ * @brief Volatile registers always go to the device, also in write-back mode,
+ * and can be switched at run time.
+ */
+void test_no_os_regmap_volatile(void)
+{
+	uint32_t val;
+
+	map_init(NO_OS_REGMAP_CACHE_WRITE_BACK, 0);
+
+	TEST_ASSERT_TRUE(no_os_regmap_is_volatile(map, VOLATILE_REG));
+	TEST_ASSERT_FALSE(no_os_regmap_is_volatile(map, 1));
+	TEST_ASSERT_TRUE(no_os_regmap_is_volatile(map, NB_REGS));
+	TEST_ASSERT_TRUE(no_os_regmap_is_volatile(NULL, 1));
+
+	TEST_ASSERT_EQUAL_INT(0, no_os_regmap_read(map, VOLATILE_REG, &val));
+	regs[VOLATILE_REG] = 0xBEEF;
+	TEST_ASSERT_EQUAL_INT(0, no_os_regmap_read(map, VOLATILE_REG, &val));
+	TEST_ASSERT_EQUAL_HEX32(0xBEEF, val);
+	TEST_ASSERT_EQUAL_UINT32(2, nb_reads);
+
+	TEST_ASSERT_EQUAL_INT(0, no_os_regmap_write(map, VOLATILE_REG, 0x1));
+	TEST_ASSERT_EQUAL_HEX32(0x1, regs[VOLATILE_REG]);
+	TEST_ASSERT_EQUAL_UINT32(0, map->nb_dirty);
+
+	/* A dirty register is written out before it becomes volatile. */
+	TEST_ASSERT_EQUAL_INT(0, no_os_regmap_write(map, 2, 0x22));
+	TEST_ASSERT_EQUAL_UINT32(1, map->nb_dirty);
+	TEST_ASSERT_EQUAL_INT(0, no_os_regmap_set_volatile(map, 2, true));
+	TEST_ASSERT_EQUAL_HEX32(0x22, regs[2]);
+	TEST_ASSERT_TRUE(no_os_regmap_is_volatile(map, 2));
+
+	TEST_ASSERT_EQUAL_INT(0, no_os_regmap_set_volatile(map, VOLATILE_REG,
+			      false));
+	TEST_ASSERT_FALSE(no_os_regmap_is_volatile(map, VOLATILE_REG));
+	TEST_ASSERT_EQUAL_INT(0, no_os_regmap_read(map, VOLATILE_REG, &val));
+	TEST_ASSERT_EQUAL_INT(0, no_os_regmap_read(map, VOLATILE_REG, &val));
+	TEST_ASSERT_EQUAL_UINT32(3, nb_reads);
+}
+
+/**
+ * @brief Invalidated registers are read again from the device and pending
+ * writes in the invalidated range are dropped.
+ */
+void test_no_os_regmap_invalidate(void)
+{
+	uint32_t vals[4];
+
+	map_init(NO_OS_REGMAP_CACHE_WRITE_BACK, 0);
+
+	TEST_ASSERT_EQUAL_INT(0, no_os_regmap_bulk_read(map, 4, vals, 4));
+	TEST_ASSERT_EQUAL_UINT32(4, nb_reads);
+	TEST_ASSERT_EQUAL_INT(0, no_os_regmap_write(map, 6, 0x66));
+	TEST_ASSERT_EQUAL_UINT32(1, map->nb_dirty);
+
+	/* The device was reset behind the cache. */
+	regs[4] = 0;
+	regs[5] = 0;
+	no_os_regmap_cache_invalidate(map, 5, 6);
+	TEST_ASSERT_EQUAL_UINT32(0, map->nb_dirty);
+	TEST_ASSERT_TRUE(no_os_regmap_is_volatile(map, VOLATILE_REG));
+
+	TEST_ASSERT_EQUAL_INT(0, no_os_regmap_bulk_read(map, 4, vals, 4));
+	TEST_ASSERT_EQUAL_HEX32(0x104, vals[0]);
+	TEST_ASSERT_EQUAL_HEX32(0, vals[1]);
+	TEST_ASSERT_EQUAL_HEX32(0x106, vals[2]);
+	TEST_ASSERT_EQUAL_HEX32(0x107, vals[3]);
+	TEST_ASSERT_EQUAL_UINT32(6, nb_reads);
+
+	TEST_ASSERT_EQUAL_INT(0, no_os_regmap_sync(map));
+	TEST_ASSERT_EQUAL_UINT32(0, nb_writes + nb_bulk_writes);
+}
+
+/**
+ * @brief Test the parameter checks.
+ */
+void test_no_os_regmap_invalid(void)
+{
+	struct no_os_regmap_init_param ip = {
+		.bus = &bus,
+	};
+	uint32_t vals[2];
+
+	TEST_ASSERT_EQUAL_INT(-EINVAL, no_os_regmap_init(&map, &ip));
+	TEST_ASSERT_EQUAL_INT(-EINVAL, no_os_regmap_init(NULL, &ip));
+
+	map_init(NO_OS_REGMAP_CACHE_WRITE_THROUGH, 0);
+	TEST_ASSERT_EQUAL_INT(-EINVAL, no_os_regmap_read(map, NB_REGS, vals));
+	TEST_ASSERT_EQUAL_INT(-EINVAL, no_os_regmap_write(map, NB_REGS, 0));
+	TEST_ASSERT_EQUAL_INT(-EINVAL, no_os_regmap_bulk_read(map, NB_REGS - 1,
+			      vals, 2));
+	TEST_ASSERT_EQUAL_INT(-EINVAL, no_os_regmap_field_write(map, 1, 0xF0,
+			      0x10));
+	TEST_ASSERT_EQUAL_INT(-EINVAL, no_os_regmap_set_volatile(map, NB_REGS,
+			      true));
+	TEST_ASSERT_EQUAL_UINT32(0, nb_reads + nb_writes);
+}
@@ -0,0 +1,194 @@
+/***************************************************************************//**
+ *   @file   test_no_os_unpack.c
+ *   @brief  Unit tests for the packed sample unpacking library.
+ *******************************************************************************
+ * Copyright 2026(c) Analog Devices, Inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Analog Devices, Inc. nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ANALOG DEVICES, INC. “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL ANALOG DEVICES, INC. BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+
+/*******************************************************************************
+ *    INCLUDED FILES
+ ******************************************************************************/
+
+#include "unity.h"
+#include "no_os_unpack.h"
+#include "no_os_error.h"
+#include "no_os_util.h"
+#include <string.h>
+
+/*******************************************************************************
+ *    PRIVATE DATA
+ ******************************************************************************/
+
+#define NB_SAMPLES		1027
+
+static uint8_t packed[NB_SAMPLES * 4 + 16];
+static int32_t ref32[NB_SAMPLES];
+static int32_t out32[NB_SAMPLES];
+static int16_t out16[NB_SAMPLES];
+
+/*******************************************************************************
+ *    PRIVATE FUNCTIONS
+ ******************************************************************************/
+
+static void fill_random(uint8_t *buf, uint32_t len)
+{
+	uint32_t seed = 0x2468ACE1;
+	uint32_t i;
+
+	for (i = 0; i < len; i++) {
+		seed = seed * 1103515245 + 12345;
+		buf[i] = seed >> 16;
+	}
+}
+
+/**
+ * @brief Bit by bit reference implementation.
+ */
+static int32_t ref_unpack(const struct no_os_unpack_fmt *fmt,
+			  const uint8_t *src, uint32_t idx)
+{
+	uint32_t bytes = fmt->word_bits / 8;
+	uint32_t word = 0;
+	uint32_t bit;
+	uint32_t val;
+	uint8_t i;
+
+	for (i = 0; i < fmt->word_bits; i++) {
+		if (fmt->little_endian)
+			bit = (idx * bytes + bytes - 1 - i / 8) * 8 + i % 8;
+		else
+			bit = idx * fmt->word_bits + i;
+		word = (word << 1) | ((src[bit / 8] >> (7 - bit % 8)) & 1);
+	}
+
+	val = (word >> fmt->shift) & (0xFFFFFFFFu >> (32 - fmt->data_bits));
+	if (fmt->is_signed && (val & (1u << (fmt->data_bits - 1))))
+		val |= ~(0xFFFFFFFFu >> (32 - fmt->data_bits));
+
+	return (int32_t)val;
+}
+
+/*******************************************************************************
+ *    SETUP, TEARDOWN
+ ******************************************************************************/
+
+void setUp(void)
+{
+	fill_random(packed, sizeof(packed));
+}
+
+void tearDown(void)
+{
+}
+
+/*******************************************************************************
+ *    TESTS
+ ******************************************************************************/
+
+/**
+ * @brief Compare every supported layout with the bit by bit reference, with a
+ * sample count which leaves a tail after the vector loops.
+ */
+void test_no_os_unpack_bit_exact(void)
+{
+	const uint8_t widths[] = {12, 14, 16, 18, 20, 24, 26, 32};
+	struct no_os_unpack_fmt fmt;
+	uint32_t i;
+	uint8_t w;
+	uint8_t k;
+
+	for (w = 0; w < sizeof(widths); w++) {
+		for (k = 0; k < 8; k++) {
+			fmt.word_bits = widths[w];
+			fmt.shift = (k & 1) ? (widths[w] > 16 ? 8 : 2) : 0;
+			fmt.data_bits = widths[w] - fmt.shift - ((k & 2) ? 1 : 0);
+			fmt.little_endian = (k & 4) && !(widths[w] % 8);
+			fmt.is_signed = k & 2;
+
+			TEST_ASSERT_EQUAL_INT(0, no_os_unpack_s32(&fmt, packed,
+					      NB_SAMPLES, out32));
+			for (i = 0; i < NB_SAMPLES; i++)
+				ref32[i] = ref_unpack(&fmt, packed, i);
+			TEST_ASSERT_EQUAL_INT32_ARRAY(ref32, out32, NB_SAMPLES);
+
+			if (fmt.data_bits > 16)
+				continue;
+
+			TEST_ASSERT_EQUAL_INT(0, no_os_unpack_s16(&fmt, packed,
+					      NB_SAMPLES, out16));
+			for (i = 0; i < NB_SAMPLES; i++)
+				TEST_ASSERT_EQUAL_INT16(ref32[i], out16[i]);
+		}
+	}
+}
+
+/**
+ * @brief 32-bit words may be unpacked in place.
+ */
+void test_no_os_unpack_in_place(void)
+{
+	struct no_os_unpack_fmt fmt = {
+		.word_bits = 32,
+		.data_bits = 20,
+		.shift = 12,
+		.is_signed = true,
+	};
+	uint32_t i;
+
+	for (i = 0; i < NB_SAMPLES; i++)
+		ref32[i] = ref_unpack(&fmt, packed, i);
+
+	TEST_ASSERT_EQUAL_INT(0, no_os_unpack_s32(&fmt, packed, NB_SAMPLES,
+			      (int32_t *)packed));
+	TEST_ASSERT_EQUAL_MEMORY(ref32, packed, NB_SAMPLES * sizeof(int32_t));
+}
+
+/**
+ * @brief Invalid layouts are rejected.
+ */
+void test_no_os_unpack_invalid(void)
+{
+	struct no_os_unpack_fmt fmt = {
+		.word_bits = 18,
+		.data_bits = 18,
+	};
+
+	TEST_ASSERT_EQUAL_INT(-EINVAL, no_os_unpack_s32(NULL, packed, 1, out32));
+	TEST_ASSERT_EQUAL_INT(-EINVAL, no_os_unpack_s16(&fmt, packed, 1, out16));
+
+	fmt.little_endian = true;
+	TEST_ASSERT_EQUAL_INT(-EINVAL, no_os_unpack_s32(&fmt, packed, 1, out32));
+
+	fmt.little_endian = false;
+	fmt.shift = 1;
+	TEST_ASSERT_EQUAL_INT(-EINVAL, no_os_unpack_s32(&fmt, packed, 1, out32));
+
+	fmt.word_bits = 33;
+	fmt.shift = 0;
+	TEST_ASSERT_EQUAL_INT(-EINVAL, no_os_unpack_s32(&fmt, packed, 1, out32));
+}
@@ -33,6 +33,7 @@ INCS += $(RTOS_INCS)
 SRCS += $(NO-OS)/drivers/platform/freeRTOS/freertos_alloc.c \
         $(NO-OS)/drivers/platform/freeRTOS/freertos_mutex.c \
         $(NO-OS)/drivers/platform/freeRTOS/freertos_semaphore.c \
+        $(NO-OS)/drivers/platform/freeRTOS/freertos_thread.c \
         $(NO-OS)/drivers/platform/freeRTOS/freertos_delay.c
 
 # Include FreeRTOS specific configurations
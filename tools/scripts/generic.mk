@@ -182,6 +182,15 @@ ifeq (y,$(strip $(DISABLE_SECURE_SOCKET)))
 CFLAGS += -DDISABLE_SECURE_SOCKET
 endif
 
+# SPI/I2C/DMA transfer statistics, see no_os_bus_stats.h
+ifeq (y,$(strip $(BUS_STATS)))
+CFLAGS += -DNO_OS_BUS_STATS
+SRCS += $(NO-OS)/util/no_os_bus_stats.c \
+	$(DRIVERS)/api/no_os_timer.c
+INCS += $(INCLUDE)/no_os_bus_stats.h \
+	$(INCLUDE)/no_os_timer.h
+endif
+
 # Mbed also has an INC_DIRS variable, so this needs to be NO_OS_INC_DIRS
 NO_OS_INC_DIRS := $(patsubst %/,%,$(NO_OS_INC_DIRS))
 SRC_DIRS := $(patsubst %/,%,$(SRC_DIRS))
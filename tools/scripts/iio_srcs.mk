@@ -2,6 +2,7 @@ SRCS += $(NO-OS)/iio/iio.c
 SRCS += $(NO-OS)/iio/iiod.c
 SRCS += $(NO-OS)/iio/iio_trigger.c
 SRCS += $(NO-OS)/iio/iio_app/iio_app.c
+SRCS += $(DRIVERS)/api/no_os_timer.c
 
 NO_OS_INC_DIRS += $(NO-OS)/iio \
 		  $(NO-OS)/iio/iio_app \
@@ -12,3 +13,8 @@ ifeq (y,$(strip $(NETWORKING)))
 DISABLE_SECURE_SOCKET ?= y
 SRC_DIRS += $(NO-OS)/network
 endif
+
+ifneq ($(if $(findstring fatfs, $(LIBRARIES)), 1),)
+SRCS += $(NO-OS)/iio/iio_recorder/iio_recorder.c
+NO_OS_INC_DIRS += $(NO-OS)/iio/iio_recorder
+endif
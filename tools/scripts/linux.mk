@@ -8,6 +8,8 @@ PROJECT_BUILD = $(BUILD_DIR)/app
 CFLAGS +=  -g3 \
 		-DLINUX_PLATFORM \
 
+LDFLAGS += -pthread
+
 $(PLATFORM)_project:
 	$(call mk_dir, $(BUILD_DIR)) $(HIDE)
 
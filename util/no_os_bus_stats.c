@@ -0,0 +1,195 @@
+/***************************************************************************//**
+ *   @file   no_os_bus_stats.c
+ *   @brief  Implementation of the bus transfer statistics.
+********************************************************************************
+ * Copyright 2026(c) Analog Devices, Inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Analog Devices, Inc. nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ANALOG DEVICES, INC. “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL ANALOG DEVICES, INC. BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+#include <inttypes.h>
+#include <stdio.h>
+#include "no_os_bus_stats.h"
+#include "no_os_timer.h"
+#include "no_os_error.h"
+
+/*
+ * Projects building every file in util/ only get the statistics, and the
+ * no_os_timer.c dependency, with BUS_STATS=y.
+ */
+#ifdef NO_OS_BUS_STATS
+
+static struct no_os_timer_desc *bus_stats_timer;
+static uint32_t bus_stats_freq_hz;
+
+/**
+ * @brief Select the timer used to timestamp the transfers.
+ * @param timer - Running timer, or NULL to stop timestamping.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+int no_os_bus_stats_set_timer(struct no_os_timer_desc *timer)
+{
+	uint32_t freq_hz;
+	int ret;
+
+	if (!timer) {
+		bus_stats_timer = NULL;
+		return 0;
+	}
+
+	ret = no_os_timer_count_clk_get(timer, &freq_hz);
+	if (ret)
+		freq_hz = timer->freq_hz;
+	if (!freq_hz)
+		return -EINVAL;
+
+	bus_stats_freq_hz = freq_hz;
+	bus_stats_timer = timer;
+
+	return 0;
+}
+
+/**
+ * @brief Get the current timestamp.
+ * @return Counter of the selected timer, 0 if there is none.
+ */
+uint32_t no_os_bus_stats_now(void)
+{
+	uint32_t counter = 0;
+
+	if (bus_stats_timer)
+		no_os_timer_counter_get(bus_stats_timer, &counter);
+
+	return counter;
+}
+
+/**
+ * @brief Ticks elapsed between two timestamps, accounting for one counter
+ * wrap.
+ * @param from - Older timestamp.
+ * @param to - Newer timestamp.
+ * @return Number of ticks.
+ */
+static uint32_t no_os_bus_stats_elapsed(uint32_t from, uint32_t to)
+{
+	if (to < from && bus_stats_timer && bus_stats_timer->ticks_count)
+		return to + bus_stats_timer->ticks_count - from;
+
+	return to - from;
+}
+
+/**
+ * @brief Account a transfer. Called at the end of the transfer, with the bus
+ * lock still held.
+ * @param stats - Counters of the bus.
+ * @param start - Timestamp taken before waiting for the bus lock.
+ * @param locked - Timestamp taken once the bus lock was acquired.
+ * @param bytes - Number of bytes transferred.
+ * @param ret - Transfer result.
+ */
+void no_os_bus_stats_add(struct no_os_bus_stats *stats, uint32_t start,
+			 uint32_t locked, uint32_t bytes, int ret)
+{
+	uint32_t wait;
+	uint32_t xfer;
+	uint32_t bin;
+
+	stats->xfers++;
+	if (ret < 0)
+		stats->errors++;
+	stats->bytes += bytes;
+
+	if (!bus_stats_timer)
+		return;
+
+	wait = no_os_bus_stats_elapsed(start, locked);
+	xfer = no_os_bus_stats_elapsed(locked, no_os_bus_stats_now());
+
+	stats->wait_ticks += wait;
+	if (wait > stats->max_wait_ticks)
+		stats->max_wait_ticks = wait;
+	stats->xfer_ticks += xfer;
+	if (xfer > stats->max_xfer_ticks)
+		stats->max_xfer_ticks = xfer;
+
+	bin = xfer ? 32 - __builtin_clz(xfer) : 0;
+	if (bin >= NO_OS_BUS_STATS_HIST_BINS)
+		bin = NO_OS_BUS_STATS_HIST_BINS - 1;
+	stats->hist[bin]++;
+}
+
+/**
+ * @brief Convert timer ticks to nanoseconds.
+ * @param ticks - Number of ticks of the selected timer.
+ * @return Duration in nanoseconds, 0 if no timer is selected.
+ */
+uint64_t no_os_bus_stats_ticks_to_ns(uint64_t ticks)
+{
+	if (!bus_stats_freq_hz)
+		return 0;
+
+	return ticks / bus_stats_freq_hz * 1000000000 +
+	       ticks % bus_stats_freq_hz * 1000000000 / bus_stats_freq_hz;
+}
+
+/**
+ * @brief Print the counters of a bus.
+ * @param name - Name of the bus, printed before the counters.
+ * @param stats - Counters of the bus.
+ */
+void no_os_bus_stats_dump(const char *name,
+			  const struct no_os_bus_stats *stats)
+{
+	uint32_t i;
+
+	printf("%s: %"PRIu32" transfers, %"PRIu32" errors, %"PRIu64" bytes\n",
+	       name, stats->xfers, stats->errors, stats->bytes);
+
+	if (!stats->xfers || !bus_stats_timer)
+		return;
+
+	printf("  lock wait %"PRIu64" ns (max %"PRIu64" ns), transfer %"PRIu64
+	       " ns (max %"PRIu64" ns)\n",
+	       no_os_bus_stats_ticks_to_ns(stats->wait_ticks),
+	       no_os_bus_stats_ticks_to_ns(stats->max_wait_ticks),
+	       no_os_bus_stats_ticks_to_ns(stats->xfer_ticks),
+	       no_os_bus_stats_ticks_to_ns(stats->max_xfer_ticks));
+
+	for (i = 0; i < NO_OS_BUS_STATS_HIST_BINS; i++) {
+		if (!stats->hist[i])
+			continue;
+		if (i == NO_OS_BUS_STATS_HIST_BINS - 1)
+			printf("  >= %"PRIu64" ns: %"PRIu32"\n",
+			       no_os_bus_stats_ticks_to_ns(1ULL << (i - 1)),
+			       stats->hist[i]);
+		else
+			printf("  < %"PRIu64" ns: %"PRIu32"\n",
+			       no_os_bus_stats_ticks_to_ns(1ULL << i),
+			       stats->hist[i]);
+	}
+}
+
+#endif /* NO_OS_BUS_STATS */
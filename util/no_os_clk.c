@@ -34,6 +34,7 @@
 /******************************************************************************/
 /***************************** Include Files **********************************/
 /******************************************************************************/
+#include <stdbool.h>
 #include "no_os_alloc.h"
 #include "no_os_error.h"
 #include "no_os_clk.h"
@@ -41,6 +42,58 @@
 /******************************************************************************/
 /************************** Functions Implementation **************************/
 /******************************************************************************/
+/**
+ * Remove the clock from the children list of its parent.
+ * @param desc - The clock descriptor.
+ */
+static void no_os_clk_unlink(struct no_os_clk_desc *desc)
+{
+	struct no_os_clk_desc **pos;
+
+	if (!desc->parent)
+		return;
+
+	for (pos = &desc->parent->child; *pos; pos = &(*pos)->sibling) {
+		if (*pos == desc) {
+			*pos = desc->sibling;
+			break;
+		}
+	}
+
+	desc->parent = NULL;
+	desc->sibling = NULL;
+}
+
+/**
+ * Add the clock to the children list of a parent.
+ * @param desc - The clock descriptor.
+ * @param parent - The parent clock descriptor.
+ */
+static void no_os_clk_link(struct no_os_clk_desc *desc,
+			   struct no_os_clk_desc *parent)
+{
+	desc->parent = parent;
+	desc->sibling = parent->child;
+	parent->child = desc;
+}
+
+/**
+ * Get the number of ancestors of the clock.
+ * @param desc - The clock descriptor.
+ * @return The depth of the clock in the tree, 0 for a root clock.
+ */
+static uint32_t no_os_clk_depth(struct no_os_clk_desc *desc)
+{
+	uint32_t depth = 0;
+
+	while (desc->parent) {
+		desc = desc->parent;
+		depth++;
+	}
+
+	return depth;
+}
+
 /**
  * Initialize clock.
  * @param desc - CLK descriptor.
@@ -64,6 +117,9 @@ int32_t no_os_clk_init(struct no_os_clk_desc **desc,
 	clk->hw_ch_num = param->hw_ch_num;
 	clk->dev_desc = param->dev_desc;
 	clk->platform_ops = param->platform_ops;
+	clk->flags = param->flags & NO_OS_CLK_F_CACHE_RATE;
+	if (param->parent)
+		no_os_clk_link(clk, param->parent);
 
 	if (param->platform_ops->init) {
 		ret = param->platform_ops->init(desc, param);
@@ -76,6 +132,7 @@ int32_t no_os_clk_init(struct no_os_clk_desc **desc,
 	return 0;
 
 error:
+	no_os_clk_unlink(clk);
 	no_os_free(clk);
 
 	return ret;
@@ -88,11 +145,20 @@ error:
  */
 int32_t no_os_clk_remove(struct no_os_clk_desc *desc)
 {
+	struct no_os_clk_desc *child;
 	int ret;
 
 	if (!desc || !desc->platform_ops)
 		return -EINVAL;
 
+	no_os_clk_unlink(desc);
+	while (desc->child) {
+		child = desc->child;
+		desc->child = child->sibling;
+		child->parent = NULL;
+		child->sibling = NULL;
+	}
+
 	if (desc->platform_ops->remove) {
 		ret = desc->platform_ops->remove(desc);
 		if (ret)
@@ -137,7 +203,9 @@ int32_t no_os_clk_disable(struct no_os_clk_desc *desc)
 }
 
 /**
- * Get the current frequency of the clock.
+ * Get the current frequency of the clock. Clocks created with
+ * NO_OS_CLK_F_CACHE_RATE cache the rate until the clock or one of its parents
+ * is changed through no_os_clk, the others always ask the provider.
  * @param clk - The clock descriptor.
  * @param rate - The current frequency.
  * @return 0 in case of success, negative error code otherwise.
@@ -145,13 +213,28 @@ int32_t no_os_clk_disable(struct no_os_clk_desc *desc)
 int32_t no_os_clk_recalc_rate(struct no_os_clk_desc *desc,
 			      uint64_t *rate)
 {
+	int32_t ret;
+
 	if (!desc || !desc->platform_ops || !rate)
 		return -EINVAL;
 
+	if ((desc->flags & NO_OS_CLK_F_CACHE_RATE) &&
+	    (desc->flags & NO_OS_CLK_F_RATE_VALID)) {
+		*rate = desc->rate;
+		return 0;
+	}
+
 	if (!desc->platform_ops->clk_recalc_rate)
 		return -ENOSYS;
 
-	return desc->platform_ops->clk_recalc_rate(desc, rate);
+	ret = desc->platform_ops->clk_recalc_rate(desc, rate);
+	if (ret)
+		return ret;
+
+	desc->rate = *rate;
+	desc->flags |= NO_OS_CLK_F_RATE_VALID;
+
+	return 0;
 }
 
 /**
@@ -183,11 +266,241 @@ int32_t no_os_clk_round_rate(struct no_os_clk_desc *desc,
 int32_t no_os_clk_set_rate(struct no_os_clk_desc *desc,
 			   uint64_t rate)
 {
+	int32_t ret;
+
 	if (!desc || !desc->platform_ops)
 		return -EINVAL;
 
 	if (!desc->platform_ops->clk_set_rate)
 		return -ENOSYS;
 
-	return desc->platform_ops->clk_set_rate(desc, rate);
+	ret = desc->platform_ops->clk_set_rate(desc, rate);
+	no_os_clk_invalidate(desc);
+
+	return ret;
+}
+
+/**
+ * Link the clock to a new parent clock.
+ * @param desc - The clock descriptor.
+ * @param parent - The parent clock descriptor, NULL to make it a root clock.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+int32_t no_os_clk_set_parent(struct no_os_clk_desc *desc,
+			     struct no_os_clk_desc *parent)
+{
+	struct no_os_clk_desc *clk;
+
+	if (!desc)
+		return -EINVAL;
+
+	/* A clock cannot be its own ancestor. */
+	for (clk = parent; clk; clk = clk->parent)
+		if (clk == desc)
+			return -EINVAL;
+
+	no_os_clk_unlink(desc);
+	if (parent)
+		no_os_clk_link(desc, parent);
+
+	no_os_clk_invalidate(desc);
+
+	return 0;
+}
+
+/**
+ * Get the parent of the clock.
+ * @param desc - The clock descriptor.
+ * @return The parent clock descriptor, NULL for a root clock.
+ */
+struct no_os_clk_desc *no_os_clk_get_parent(struct no_os_clk_desc *desc)
+{
+	return desc ? desc->parent : NULL;
+}
+
+/**
+ * Drop the cached rate of the clock and of all its children. Providers call
+ * this when a rate changes without going through no_os_clk_set_rate().
+ * @param desc - The clock descriptor.
+ */
+void no_os_clk_invalidate(struct no_os_clk_desc *desc)
+{
+	struct no_os_clk_desc *child;
+
+	if (!desc)
+		return;
+
+	desc->flags &= ~NO_OS_CLK_F_RATE_VALID;
+	for (child = desc->child; child; child = child->sibling)
+		no_os_clk_invalidate(child);
+}
+
+/**
+ * Check if the clock can be left untouched by a transaction: its cached rate
+ * is the rounded rate and none of its ancestors is about to be programmed in
+ * the same group. Ancestors programmed earlier already dropped the cache.
+ * @param req - The rate change of the clock.
+ * @param group - The clocks of the group being built.
+ * @param nb - Number of clocks in the group.
+ * @return true if the clock does not need to be programmed.
+ */
+static bool no_os_clk_transaction_skip(struct no_os_clk_rate_req *req,
+				       struct no_os_clk_desc **group,
+				       uint32_t nb)
+{
+	struct no_os_clk_desc *clk;
+	uint32_t i;
+
+	if (!(req->clk->flags & NO_OS_CLK_F_CACHE_RATE) ||
+	    !(req->clk->flags & NO_OS_CLK_F_RATE_VALID) ||
+	    req->clk->rate != req->rounded_rate)
+		return false;
+
+	for (clk = req->clk->parent; clk; clk = clk->parent)
+		for (i = 0; i < nb; i++)
+			if (group[i] == clk)
+				return false;
+
+	return true;
+}
+
+/**
+ * Start an empty rate change transaction.
+ * @param tr - The transaction.
+ */
+void no_os_clk_transaction_init(struct no_os_clk_transaction *tr)
+{
+	if (tr)
+		tr->nb_req = 0;
+}
+
+/**
+ * Add a rate change to the transaction. A clock added twice keeps the last
+ * requested rate.
+ * @param tr - The transaction.
+ * @param desc - The clock descriptor.
+ * @param rate - The desired frequency.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+int32_t no_os_clk_transaction_add(struct no_os_clk_transaction *tr,
+				  struct no_os_clk_desc *desc,
+				  uint64_t rate)
+{
+	uint32_t i;
+
+	if (!tr || !desc || !desc->platform_ops)
+		return -EINVAL;
+
+	for (i = 0; i < tr->nb_req; i++) {
+		if (tr->req[i].clk == desc) {
+			tr->req[i].rate = rate;
+			return 0;
+		}
+	}
+
+	if (tr->nb_req == NO_OS_CLK_TRANSACTION_SIZE)
+		return -ENOMEM;
+
+	tr->req[tr->nb_req].clk = desc;
+	tr->req[tr->nb_req].rate = rate;
+	tr->req[tr->nb_req].rounded_rate = rate;
+	tr->nb_req++;
+
+	return 0;
+}
+
+/**
+ * Compute all the rates of the transaction, then program them.
+ *
+ * All rates are rounded by their providers first, so an unsupported rate
+ * fails the transaction before any device is touched. Clocks are then
+ * programmed parents first. Clocks of the same device are programmed together
+ * through clk_set_rates when the provider implements it, and clocks already
+ * running at the rounded rate are skipped.
+ * @param tr - The transaction.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+int32_t no_os_clk_transaction_commit(struct no_os_clk_transaction *tr)
+{
+	struct no_os_clk_desc *descs[NO_OS_CLK_TRANSACTION_SIZE];
+	uint32_t depth[NO_OS_CLK_TRANSACTION_SIZE];
+	uint64_t rates[NO_OS_CLK_TRANSACTION_SIZE];
+	bool done[NO_OS_CLK_TRANSACTION_SIZE] = {0};
+	const struct no_os_clk_platform_ops *ops;
+	struct no_os_clk_rate_req *req, tmp;
+	uint32_t i, j, nb, tmp_depth;
+	int32_t ret;
+
+	if (!tr)
+		return -EINVAL;
+
+	for (i = 0; i < tr->nb_req; i++) {
+		req = &tr->req[i];
+		ops = req->clk->platform_ops;
+
+		if (!ops->clk_set_rate && !ops->clk_set_rates)
+			return -ENOSYS;
+
+		req->rounded_rate = req->rate;
+		if (ops->clk_round_rate) {
+			ret = ops->clk_round_rate(req->clk, req->rate,
+						  &req->rounded_rate);
+			if (ret)
+				return ret;
+		}
+
+		depth[i] = no_os_clk_depth(req->clk);
+	}
+
+	/* Parents first, so children recompute from the new parent rates. */
+	for (i = 1; i < tr->nb_req; i++) {
+		tmp = tr->req[i];
+		tmp_depth = depth[i];
+		for (j = i; j > 0 && depth[j - 1] > tmp_depth; j--) {
+			tr->req[j] = tr->req[j - 1];
+			depth[j] = depth[j - 1];
+		}
+		tr->req[j] = tmp;
+		depth[j] = tmp_depth;
+	}
+
+	for (i = 0; i < tr->nb_req; i++) {
+		if (done[i])
+			continue;
+
+		ops = tr->req[i].clk->platform_ops;
+		nb = 0;
+		for (j = i; j < tr->nb_req; j++) {
+			req = &tr->req[j];
+			if (done[j] || req->clk->platform_ops != ops ||
+			    req->clk->dev_desc != tr->req[i].clk->dev_desc)
+				continue;
+
+			done[j] = true;
+			if (no_os_clk_transaction_skip(req, descs, nb))
+				continue;
+
+			descs[nb] = req->clk;
+			rates[nb] = req->rate;
+			nb++;
+			if (!ops->clk_set_rates)
+				break;
+		}
+
+		if (!nb)
+			continue;
+
+		if (ops->clk_set_rates)
+			ret = ops->clk_set_rates(descs, rates, nb);
+		else
+			ret = ops->clk_set_rate(descs[0], rates[0]);
+
+		for (j = 0; j < nb; j++)
+			no_os_clk_invalidate(descs[j]);
+
+		if (ret)
+			return ret;
+	}
+
+	return 0;
 }
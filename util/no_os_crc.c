@@ -0,0 +1,270 @@
+/***************************************************************************//**
+ *   @file   no_os_crc.c
+ *   @brief  Source file of the CRC engine.
+********************************************************************************
+ * Copyright 2026(c) Analog Devices, Inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Analog Devices, Inc. nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ANALOG DEVICES, INC. “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL ANALOG DEVICES, INC. BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+#include "no_os_crc.h"
+#include "no_os_error.h"
+
+#if defined(__x86_64__) && defined(__GNUC__)
+#include <immintrin.h>
+#define NO_OS_CRC_HAVE_CLMUL
+#endif
+
+/***************************************************************************//**
+ * @brief Computes the CRC over a buffer of data using the lookup tables.
+ *
+ * Widths below 8, 16 or 24 bits use the next table size with the polynomial
+ * and the CRC shifted to the msb.
+ *
+ * @param engine - CRC engine.
+ * @param pdata  - Pointer to data buffer.
+ * @param nbytes - Number of bytes to compute the CRC over.
+ * @param crc    - Initial value for the CRC computation.
+ *
+ * @return Computed CRC value.
+*******************************************************************************/
+static uint32_t no_os_crc_table_compute(struct no_os_crc_engine *engine,
+					const uint8_t *pdata, size_t nbytes,
+					uint32_t crc)
+{
+	uint8_t shift;
+
+	if (engine->width <= 8) {
+		shift = 8 - engine->width;
+		crc = no_os_crc8_slice((const uint8_t (*)[NO_OS_CRC8_TABLE_SIZE])
+				       engine->table, engine->nb_slices, pdata,
+				       nbytes, crc << shift);
+	} else if (engine->width <= 16) {
+		shift = 16 - engine->width;
+		crc = no_os_crc16_slice((const uint16_t (*)[NO_OS_CRC16_TABLE_SIZE])
+					engine->table, engine->nb_slices, pdata,
+					nbytes, crc << shift);
+	} else {
+		shift = 24 - engine->width;
+		crc = no_os_crc24_slice((const uint32_t (*)[NO_OS_CRC24_TABLE_SIZE])
+					engine->table, engine->nb_slices, pdata,
+					nbytes, crc << shift);
+	}
+
+	return crc >> shift;
+}
+
+#ifdef NO_OS_CRC_HAVE_CLMUL
+/***************************************************************************//**
+ * @brief Computes x^n modulo x^32 + poly.
+ *
+ * @param n    - Power of x.
+ * @param poly - Low 32 bits of the polynomial.
+ *
+ * @return x^n mod (x^32 + poly).
+*******************************************************************************/
+static uint32_t no_os_crc_xpow_mod(uint32_t n, uint32_t poly)
+{
+	uint32_t r = 1;
+
+	while (n--)
+		r = (r & 0x80000000) ? (r << 1) ^ poly : r << 1;
+
+	return r;
+}
+
+/***************************************************************************//**
+ * @brief Folds a 128-bit remainder d bits forward.
+ *
+ * @param acc - Remainder, x^127 in the msb.
+ * @param k   - x^(d + 64) mod P in the high, x^d mod P in the low qword.
+ *
+ * @return A 128-bit value congruent to acc * x^d modulo P.
+*******************************************************************************/
+__attribute__((target("pclmul,ssse3")))
+static inline __m128i no_os_crc_fold(__m128i acc, __m128i k)
+{
+	return _mm_xor_si128(_mm_clmulepi64_si128(acc, k, 0x11),
+			     _mm_clmulepi64_si128(acc, k, 0x00));
+}
+
+/***************************************************************************//**
+ * @brief Computes the CRC over a buffer of data using carry-less multiply.
+ *
+ * The data is folded 64 bytes per iteration, in four independent 128-bit
+ * remainders modulo P = poly * x^(32 - width), then the remainders are folded
+ * into one. Since P is a multiple of the CRC polynomial, the CRC of the
+ * remaining 16 bytes and of the tail is the CRC of the whole buffer.
+ *
+ * @param engine - CRC engine.
+ * @param pdata  - Pointer to data buffer, at least 64 bytes.
+ * @param nbytes - Number of bytes to compute the CRC over.
+ * @param crc    - Initial value for the CRC computation.
+ *
+ * @return Computed CRC value.
+*******************************************************************************/
+__attribute__((target("pclmul,ssse3")))
+static uint32_t no_os_crc_clmul_compute(struct no_os_crc_engine *engine,
+					const uint8_t *pdata, size_t nbytes,
+					uint32_t crc)
+{
+	const __m128i bswap = _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11,
+					   12, 13, 14, 15);
+	__m128i k128 = _mm_set_epi64x(engine->fold[0][0], engine->fold[0][1]);
+	__m128i k256 = _mm_set_epi64x(engine->fold[1][0], engine->fold[1][1]);
+	__m128i k384 = _mm_set_epi64x(engine->fold[2][0], engine->fold[2][1]);
+	__m128i k512 = _mm_set_epi64x(engine->fold[3][0], engine->fold[3][1]);
+	__m128i acc[4];
+	uint8_t rem[16];
+	uint8_t i;
+
+	for (i = 0; i < 4; i++)
+		acc[i] = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)
+						  (pdata + 16 * i)), bswap);
+	/* The initial value is added to the first bits of the message. */
+	acc[0] = _mm_xor_si128(acc[0],
+			       _mm_set_epi32(crc << (32 - engine->width), 0, 0, 0));
+	pdata += 64;
+	nbytes -= 64;
+
+	while (nbytes >= 64) {
+		for (i = 0; i < 4; i++)
+			acc[i] = _mm_xor_si128(no_os_crc_fold(acc[i], k512),
+					       _mm_shuffle_epi8(_mm_loadu_si128(
+							       (const __m128i *)(pdata + 16 * i)),
+							       bswap));
+		pdata += 64;
+		nbytes -= 64;
+	}
+
+	acc[3] = _mm_xor_si128(acc[3], no_os_crc_fold(acc[0], k384));
+	acc[3] = _mm_xor_si128(acc[3], no_os_crc_fold(acc[1], k256));
+	acc[3] = _mm_xor_si128(acc[3], no_os_crc_fold(acc[2], k128));
+
+	while (nbytes >= 16) {
+		acc[3] = _mm_xor_si128(no_os_crc_fold(acc[3], k128),
+				       _mm_shuffle_epi8(_mm_loadu_si128(
+						       (const __m128i *)pdata), bswap));
+		pdata += 16;
+		nbytes -= 16;
+	}
+
+	_mm_storeu_si128((__m128i *)rem, _mm_shuffle_epi8(acc[3], bswap));
+	crc = no_os_crc_table_compute(engine, rem, sizeof(rem), 0);
+
+	return no_os_crc_table_compute(engine, pdata, nbytes, crc);
+}
+#endif
+
+/***************************************************************************//**
+ * @brief Populates the lookup tables and selects the implementation of a CRC
+ *        engine. Called by no_os_crc_compute() on first use.
+ *
+ * @param engine - CRC engine.
+ *
+ * @return 0 in case of success, negative error code otherwise.
+*******************************************************************************/
+int no_os_crc_engine_setup(struct no_os_crc_engine *engine)
+{
+	uint32_t poly;
+	uint8_t shift;
+
+	if (!engine || !engine->table || !engine->width || engine->width > 24)
+		return -EINVAL;
+
+	if (engine->nb_slices != 1 && engine->nb_slices != 4 &&
+	    engine->nb_slices != 8)
+		return -EINVAL;
+
+	poly = engine->polynomial & ((1UL << engine->width) - 1);
+
+	if (engine->width <= 8) {
+		shift = 8 - engine->width;
+		no_os_crc8_populate_slice_msb((uint8_t (*)[NO_OS_CRC8_TABLE_SIZE])
+					      engine->table, engine->nb_slices,
+					      poly << shift);
+	} else if (engine->width <= 16) {
+		shift = 16 - engine->width;
+		no_os_crc16_populate_slice_msb((uint16_t (*)[NO_OS_CRC16_TABLE_SIZE])
+					       engine->table, engine->nb_slices,
+					       poly << shift);
+	} else {
+		shift = 24 - engine->width;
+		no_os_crc24_populate_slice_msb((uint32_t (*)[NO_OS_CRC24_TABLE_SIZE])
+					       engine->table, engine->nb_slices,
+					       poly << shift);
+	}
+
+	engine->clmul = false;
+#ifdef NO_OS_CRC_HAVE_CLMUL
+	if (engine->impl == NO_OS_CRC_IMPL_AUTO) {
+		__builtin_cpu_init();
+		engine->clmul = __builtin_cpu_supports("pclmul") &&
+				__builtin_cpu_supports("ssse3");
+	}
+
+	if (engine->clmul) {
+		poly <<= 32 - engine->width;
+		for (uint8_t i = 0; i < 4; i++) {
+			engine->fold[i][0] = no_os_crc_xpow_mod(128 * (i + 1) + 64,
+								poly);
+			engine->fold[i][1] = no_os_crc_xpow_mod(128 * (i + 1), poly);
+		}
+	}
+#endif
+
+	engine->ready = true;
+
+	return 0;
+}
+
+/***************************************************************************//**
+ * @brief Computes an msb-first CRC over a buffer of data.
+ *
+ * @param engine    - CRC engine, usually declared with NO_OS_DECLARE_CRC_ENGINE.
+ * @param pdata     - Pointer to data buffer.
+ * @param nbytes    - Number of bytes to compute the CRC over.
+ * @param crc       - Initial value for the CRC computation. Can be used to
+ *                    cascade calls to this function by providing a previous
+ *                    output of this function as the crc parameter.
+ *
+ * @return crc      - Computed CRC value, or the initial value if the engine
+ *                    parameters are invalid.
+*******************************************************************************/
+uint32_t no_os_crc_compute(struct no_os_crc_engine *engine,
+			   const uint8_t *pdata, size_t nbytes, uint32_t crc)
+{
+	if (!engine->ready && no_os_crc_engine_setup(engine))
+		return crc;
+
+	crc &= (1UL << engine->width) - 1;
+
+#ifdef NO_OS_CRC_HAVE_CLMUL
+	if (engine->clmul && nbytes >= NO_OS_CRC_CLMUL_MIN_BYTES)
+		return no_os_crc_clmul_compute(engine, pdata, nbytes, crc);
+#endif
+
+	return no_os_crc_table_compute(engine, pdata, nbytes, crc);
+}
@@ -96,3 +96,78 @@ uint32_t no_os_crc24(const uint32_t * table, const uint8_t *pdata,
 
 	return (crc & 0xffffff);
 }
+
+/***************************************************************************//**
+ * @brief Creates the CRC-24 slicing lookup tables for a given polynomial.
+ *
+ * table[0] is the table created by no_os_crc24_populate_msb(), so it can also
+ * be used with no_os_crc24(). table[k] holds the CRC-24 of a byte followed by
+ * k zero bytes.
+ *
+ * @param table      - Pointer to nb_slices CRC-24 lookup tables to write to.
+ * @param nb_slices  - Number of tables: 4 or 8.
+ * @param polynomial - msb-first representation of desired polynomial.
+ *
+ * @return None.
+*******************************************************************************/
+void no_os_crc24_populate_slice_msb(uint32_t (*table)[NO_OS_CRC24_TABLE_SIZE],
+				    uint8_t nb_slices, const uint32_t polynomial)
+{
+	uint32_t prev;
+
+	if (!table)
+		return;
+
+	no_os_crc24_populate_msb(table[0], polynomial);
+
+	for (uint8_t k = 1; k < nb_slices; k++) {
+		for (int16_t n = 0; n < NO_OS_CRC24_TABLE_SIZE; n++) {
+			prev = table[k - 1][n];
+			table[k][n] = (table[0][prev >> 16] ^ (prev << 8)) & 0xffffff;
+		}
+	}
+}
+
+/***************************************************************************//**
+ * @brief Computes the CRC-24 over a buffer of data, nb_slices bytes at a time.
+ *
+ * @param table     - Pointer to the tables created by
+ *                    no_os_crc24_populate_slice_msb().
+ * @param nb_slices - Number of tables: 4 or 8.
+ * @param pdata     - Pointer to data buffer.
+ * @param nbytes    - Number of bytes to compute the CRC-24 over.
+ * @param crc       - Initial value for the CRC-24 computation.
+ *
+ * @return crc      - Computed CRC-24 value, same as no_os_crc24().
+*******************************************************************************/
+uint32_t no_os_crc24_slice(const uint32_t (*table)[NO_OS_CRC24_TABLE_SIZE],
+			   uint8_t nb_slices, const uint8_t *pdata, size_t nbytes,
+			   uint32_t crc)
+{
+	crc &= 0xffffff;
+
+	if (nb_slices == 8) {
+		while (nbytes >= 8) {
+			crc = table[7][(crc >> 16) ^ pdata[0]] ^
+			      table[6][((crc >> 8) ^ pdata[1]) & 0xff] ^
+			      table[5][(crc ^ pdata[2]) & 0xff] ^ table[4][pdata[3]] ^
+			      table[3][pdata[4]] ^ table[2][pdata[5]] ^
+			      table[1][pdata[6]] ^ table[0][pdata[7]];
+			pdata += 8;
+			nbytes -= 8;
+		}
+	}
+
+	if (nb_slices >= 4) {
+		while (nbytes >= 4) {
+			crc = table[3][(crc >> 16) ^ pdata[0]] ^
+			      table[2][((crc >> 8) ^ pdata[1]) & 0xff] ^
+			      table[1][(crc ^ pdata[2]) & 0xff] ^
+			      table[0][pdata[3]];
+			pdata += 4;
+			nbytes -= 4;
+		}
+	}
+
+	return no_os_crc24(table[0], pdata, nbytes, crc);
+}
@@ -127,3 +127,68 @@ uint8_t no_os_crc8(const uint8_t * table, const uint8_t *pdata, size_t nbytes,
 
 	return crc;
 }
+
+/***************************************************************************//**
+ * @brief Creates the CRC-8 slicing lookup tables for a given polynomial.
+ *
+ * table[0] is the table created by no_os_crc8_populate_msb(), so it can also
+ * be used with no_os_crc8(). table[k] holds the CRC-8 of a byte followed by k
+ * zero bytes.
+ *
+ * @param table      - Pointer to nb_slices CRC-8 lookup tables to write to.
+ * @param nb_slices  - Number of tables: 4 or 8.
+ * @param polynomial - msb-first representation of desired polynomial.
+ *
+ * @return None.
+*******************************************************************************/
+void no_os_crc8_populate_slice_msb(uint8_t (*table)[NO_OS_CRC8_TABLE_SIZE],
+				   uint8_t nb_slices, const uint8_t polynomial)
+{
+	if (!table)
+		return;
+
+	no_os_crc8_populate_msb(table[0], polynomial);
+
+	for (uint8_t k = 1; k < nb_slices; k++)
+		for (int16_t n = 0; n < NO_OS_CRC8_TABLE_SIZE; n++)
+			table[k][n] = table[0][table[k - 1][n]];
+}
+
+/***************************************************************************//**
+ * @brief Computes the CRC-8 over a buffer of data, nb_slices bytes at a time.
+ *
+ * @param table     - Pointer to the tables created by
+ *                    no_os_crc8_populate_slice_msb().
+ * @param nb_slices - Number of tables: 4 or 8.
+ * @param pdata     - Pointer to 8-bit data buffer.
+ * @param nbytes    - Number of bytes to compute the CRC-8 over.
+ * @param crc       - Initial value for the CRC-8 computation.
+ *
+ * @return crc      - Computed CRC-8 value, same as no_os_crc8().
+*******************************************************************************/
+uint8_t no_os_crc8_slice(const uint8_t (*table)[NO_OS_CRC8_TABLE_SIZE],
+			 uint8_t nb_slices, const uint8_t *pdata, size_t nbytes,
+			 uint8_t crc)
+{
+	if (nb_slices == 8) {
+		while (nbytes >= 8) {
+			crc = table[7][crc ^ pdata[0]] ^ table[6][pdata[1]] ^
+			      table[5][pdata[2]] ^ table[4][pdata[3]] ^
+			      table[3][pdata[4]] ^ table[2][pdata[5]] ^
+			      table[1][pdata[6]] ^ table[0][pdata[7]];
+			pdata += 8;
+			nbytes -= 8;
+		}
+	}
+
+	if (nb_slices >= 4) {
+		while (nbytes >= 4) {
+			crc = table[3][crc ^ pdata[0]] ^ table[2][pdata[1]] ^
+			      table[1][pdata[2]] ^ table[0][pdata[3]];
+			pdata += 4;
+			nbytes -= 4;
+		}
+	}
+
+	return no_os_crc8(table[0], pdata, nbytes, crc);
+}
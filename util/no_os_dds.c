@@ -0,0 +1,254 @@
+/***************************************************************************//**
+ *   @file   no_os_dds.c
+ *   @brief  Source file of the direct digital synthesis library.
+********************************************************************************
+ * Copyright 2026(c) Analog Devices, Inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Analog Devices, Inc. nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ANALOG DEVICES, INC. “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL ANALOG DEVICES, INC. BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+#include <errno.h>
+#include <string.h>
+#include "no_os_dds.h"
+#include "no_os_alloc.h"
+#include "no_os_util.h"
+
+#define NO_OS_DDS_LUT_MASK	((1 << NO_OS_DDS_LUT_BITS) - 1)
+/* Phase bits used for the interpolation between two table entries */
+#define NO_OS_DDS_FRAC_BITS	16
+#define NO_OS_DDS_FRAC_SHIFT	(32 - NO_OS_DDS_LUT_BITS - NO_OS_DDS_FRAC_BITS)
+/* Samples generated per channel before interleaving */
+#define NO_OS_DDS_BLOCK		64
+
+extern const uint16_t no_os_sine_lut_16[1 << NO_OS_DDS_LUT_BITS];
+
+/**
+ * @brief Compute the tuning word of a tone.
+ * @param freq_hz - Tone frequency
+ * @param sample_rate_hz - Rate at which the samples are played
+ * @return The tuning word, or 0 if the tone is above the Nyquist frequency
+ */
+uint32_t no_os_dds_tuning_word(uint32_t freq_hz, uint32_t sample_rate_hz)
+{
+	if (!sample_rate_hz || freq_hz > sample_rate_hz / 2)
+		return 0;
+
+	return ((uint64_t)freq_hz << 32) / sample_rate_hz;
+}
+
+/**
+ * @brief Allocate a DDS.
+ * @param desc - The DDS descriptor.
+ * @param param - The DDS initialization parameters.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+int no_os_dds_init(struct no_os_dds_desc **desc,
+		   const struct no_os_dds_init_param *param)
+{
+	struct no_os_dds_desc *d;
+	int32_t s0, s1;
+	uint32_t i;
+
+	if (!desc || !param || !param->nb_channels ||
+	    param->nb_channels > NO_OS_DDS_MAX_CHANNELS)
+		return -EINVAL;
+
+	for (i = 0; i < param->nb_channels; i++)
+		if (param->channels[i].amplitude > NO_OS_DDS_FULL_SCALE)
+			return -EINVAL;
+
+	d = no_os_calloc(1, sizeof(*d));
+	if (!d)
+		return -ENOMEM;
+
+	d->tuning_word = param->tuning_word;
+	d->nb_channels = param->nb_channels;
+	memcpy(d->channels, param->channels, sizeof(d->channels));
+
+	for (i = 0; i <= NO_OS_DDS_LUT_MASK; i++) {
+		s0 = no_os_sine_lut_16[i];
+		s1 = no_os_sine_lut_16[(i + 1) & NO_OS_DDS_LUT_MASK];
+		d->lut[i] = (int32_t)((uint32_t)(s1 - s0) << 16) | s0;
+	}
+
+	*desc = d;
+
+	return 0;
+}
+
+/**
+ * @brief Free the resources allocated by no_os_dds_init().
+ * @param desc - The DDS descriptor.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+int no_os_dds_remove(struct no_os_dds_desc *desc)
+{
+	if (!desc)
+		return -EINVAL;
+
+	no_os_free(desc);
+
+	return 0;
+}
+
+/**
+ * @brief Change the tone frequency. The phase accumulator is kept, so the
+ * output stays continuous.
+ * @param desc - The DDS descriptor.
+ * @param tuning_word - The new phase increment per sample.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+int no_os_dds_set_tuning_word(struct no_os_dds_desc *desc, uint32_t tuning_word)
+{
+	if (!desc)
+		return -EINVAL;
+
+	desc->tuning_word = tuning_word;
+
+	return 0;
+}
+
+/**
+ * @brief Change the phase offset and amplitude of a channel.
+ * @param desc - The DDS descriptor.
+ * @param ch - The channel index.
+ * @param phase_offset - The phase offset, 2^32 is a full period.
+ * @param amplitude - The amplitude, Q15.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+int no_os_dds_set_channel(struct no_os_dds_desc *desc, uint8_t ch,
+			  uint32_t phase_offset, uint16_t amplitude)
+{
+	if (!desc || ch >= desc->nb_channels || amplitude > NO_OS_DDS_FULL_SCALE)
+		return -EINVAL;
+
+	desc->channels[ch].phase_offset = phase_offset;
+	desc->channels[ch].amplitude = amplitude;
+
+	return 0;
+}
+
+/**
+ * @brief Set the phase accumulator.
+ * @param desc - The DDS descriptor.
+ * @param phase - The new phase, 2^32 is a full period.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+int no_os_dds_set_phase(struct no_os_dds_desc *desc, uint32_t phase)
+{
+	if (!desc)
+		return -EINVAL;
+
+	desc->phase = phase;
+
+	return 0;
+}
+
+/**
+ * @brief Generate the samples of one channel. The phase of each sample is
+ * computed from the sample index instead of being accumulated, so iterations
+ * are independent and the compiler can vectorize the loop. Kept out of line,
+ * the restrict qualifiers are not honored once inlined in the caller.
+ * @param lut - The packed sine table of the descriptor.
+ * @param buf - Where to write the samples.
+ * @param nb_samples - Number of samples.
+ * @param phase - Phase of the first sample.
+ * @param tuning_word - Phase increment per sample.
+ * @param amplitude - Amplitude, Q15.
+ */
+static __attribute__((noinline))
+void no_os_dds_fill(const int32_t *restrict lut, uint16_t *restrict buf,
+		    uint32_t nb_samples, uint32_t phase, uint32_t tuning_word,
+		    uint16_t amplitude)
+{
+	uint32_t frac, p;
+	int32_t e, s;
+	uint32_t n;
+
+	for (n = 0; n < nb_samples; n++) {
+		p = phase + n * tuning_word;
+		e = lut[p >> (32 - NO_OS_DDS_LUT_BITS)];
+		frac = (p >> NO_OS_DDS_FRAC_SHIFT) &
+		       ((1 << NO_OS_DDS_FRAC_BITS) - 1);
+
+		s = (e & 0xffff) + (((e >> 16) * (int32_t)frac) >>
+				    NO_OS_DDS_FRAC_BITS);
+
+		/* The table is offset binary, scale around mid-scale. */
+		buf[n] = 0x8000 + (((s - 0x8000) * amplitude) >> 15);
+	}
+}
+
+/**
+ * @brief Generate the next samples of all the channels. The samples are
+ * interleaved: buf[n * nb_channels + ch] is sample n of channel ch, in the
+ * offset binary format of the sine table.
+ * @param desc - The DDS descriptor.
+ * @param buf - Buffer of nb_samples * nb_channels samples.
+ * @param nb_samples - Number of samples per channel.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+int no_os_dds_generate(struct no_os_dds_desc *desc, uint16_t *buf,
+		       uint32_t nb_samples)
+{
+	uint16_t block[NO_OS_DDS_BLOCK];
+	uint32_t nb_channels;
+	uint32_t phase;
+	uint32_t done;
+	uint32_t len;
+	uint32_t n;
+	uint8_t ch;
+
+	if (!desc || !buf)
+		return -EINVAL;
+
+	nb_channels = desc->nb_channels;
+	if (nb_channels == 1) {
+		no_os_dds_fill(desc->lut, buf, nb_samples,
+			       desc->phase + desc->channels[0].phase_offset,
+			       desc->tuning_word, desc->channels[0].amplitude);
+		goto end;
+	}
+
+	/* Generate contiguous blocks, which vectorize, then interleave them. */
+	for (done = 0; done < nb_samples; done += len) {
+		len = no_os_min(nb_samples - done, NO_OS_DDS_BLOCK);
+		phase = desc->phase + done * desc->tuning_word;
+		for (ch = 0; ch < nb_channels; ch++) {
+			no_os_dds_fill(desc->lut, block, len,
+				       phase + desc->channels[ch].phase_offset,
+				       desc->tuning_word,
+				       desc->channels[ch].amplitude);
+			for (n = 0; n < len; n++)
+				buf[(done + n) * nb_channels + ch] = block[n];
+		}
+	}
+
+end:
+	desc->phase += nb_samples * desc->tuning_word;
+
+	return 0;
+}
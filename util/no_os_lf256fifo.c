@@ -35,6 +35,16 @@
 #include "no_os_lf256fifo.h"
 #include "no_os_alloc.h"
 
+/*
+ * fempty is only written by the producer and ffilled only by the consumer.
+ * Each side publishes its index with a release store and reads the other
+ * side's index with an acquire load, so the data byte written before fempty
+ * is advanced is visible to the consumer, and a slot is reused only after the
+ * consumer read it, also when both sides run on different cores.
+ */
+#define LF256FIFO_LOAD(idx)		__atomic_load_n(&(idx), __ATOMIC_ACQUIRE)
+#define LF256FIFO_STORE(idx, val)	__atomic_store_n(&(idx), (val), __ATOMIC_RELEASE)
+
 /**
  * @struct lf256fifo
  * @brief Structure holding the fifo element parameters.
@@ -77,8 +87,8 @@ int lf256fifo_init(struct lf256fifo **fifo)
  */
 bool lf256fifo_is_full(struct lf256fifo *fifo)
 {
-	return (fifo->fempty + 1) ==
-	       fifo->ffilled; // intended overflow at 256 (data size is 256)
+	return (uint8_t)(LF256FIFO_LOAD(fifo->fempty) + 1) ==
+	       LF256FIFO_LOAD(fifo->ffilled); // intended overflow at 256 (data size is 256)
 }
 
 /**
@@ -88,7 +98,7 @@ bool lf256fifo_is_full(struct lf256fifo *fifo)
 */
 bool lf256fifo_is_empty(struct lf256fifo *fifo)
 {
-	return fifo->fempty == fifo->ffilled;
+	return LF256FIFO_LOAD(fifo->fempty) == LF256FIFO_LOAD(fifo->ffilled);
 }
 
 /**
@@ -99,11 +109,14 @@ bool lf256fifo_is_empty(struct lf256fifo *fifo)
 */
 int lf256fifo_read(struct lf256fifo * fifo, uint8_t *c)
 {
-	if (lf256fifo_is_empty(fifo))
+	uint8_t filled = fifo->ffilled;
+
+	if (filled == LF256FIFO_LOAD(fifo->fempty))
 		return -1; // buffer empty
 
-	*c = fifo->data[fifo->ffilled];
-	fifo->ffilled++; // intended overflow at 256 (data size is 256)
+	*c = fifo->data[filled];
+	// intended overflow at 256 (data size is 256)
+	LF256FIFO_STORE(fifo->ffilled, (uint8_t)(filled + 1));
 
 	return 0;
 }
@@ -116,11 +129,14 @@ int lf256fifo_read(struct lf256fifo * fifo, uint8_t *c)
 */
 int lf256fifo_write(struct lf256fifo *fifo, uint8_t c)
 {
-	if (lf256fifo_is_full(fifo))
+	uint8_t empty = fifo->fempty;
+
+	if ((uint8_t)(empty + 1) == LF256FIFO_LOAD(fifo->ffilled))
 		return -1; // buffer full
 
-	fifo->data[fifo->fempty] = c;
-	fifo->fempty++; // intended overflow at 256 (data size is 256)
+	fifo->data[empty] = c;
+	// intended overflow at 256 (data size is 256)
+	LF256FIFO_STORE(fifo->fempty, (uint8_t)(empty + 1));
 
 	return 0; // return success
 }
@@ -132,7 +148,7 @@ int lf256fifo_write(struct lf256fifo *fifo, uint8_t c)
 */
 void lf256fifo_flush(struct lf256fifo *fifo)
 {
-	fifo->ffilled = fifo->fempty;
+	LF256FIFO_STORE(fifo->ffilled, LF256FIFO_LOAD(fifo->fempty));
 }
 
 /**
@@ -31,9 +31,12 @@
  * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 *******************************************************************************/
 #include <errno.h>
+#include <stdbool.h>
+#include <string.h>
 #include "no_os_pid.h"
 #include "no_os_alloc.h"
 #include "no_os_print_log.h"
+#include "no_os_util.h"
 
 struct no_os_pid {
 	int iacc; // integral accumulator
@@ -200,3 +203,237 @@ int no_os_pid_remove(struct no_os_pid *pid)
 
 	return 0;
 }
+
+/**
+ * @brief Convert a micro-unit gain to Q NO_OS_PID_BANK_Q, rounding to nearest.
+ * @param gain - Gain in micro-units
+ * @return The fixed-point gain
+ */
+static int32_t no_os_pid_bank_gain(unsigned int gain)
+{
+	return (((uint64_t)gain << NO_OS_PID_BANK_Q) + 500000) / 1000000;
+}
+
+/**
+ * @brief Initialize a bank of PID controllers. Gains are converted from
+ * micro-units to Q NO_OS_PID_BANK_Q, so that a step needs no division. Gains
+ * multiple of 15625 micro-units are represented exactly and then give the same
+ * outputs as no_os_pid_control().
+ * @param bank - Double pointer to the bank descriptor that the function allocates
+ * @param configs - Array of nb_loops PID configurations
+ * @param nb_loops - Number of controllers
+ * @return
+ *  - 0 : On success
+ *  - -EINVAL : Invalid input
+ *  - -ENOMEM : Memory allocation failure
+ */
+int no_os_pid_bank_init(struct no_os_pid_bank **bank,
+			const struct no_os_pid_config *configs,
+			unsigned int nb_loops)
+{
+	struct no_os_pid_bank *b;
+	int32_t *arrays;
+	unsigned int n;
+
+	if (!bank || !configs || !nb_loops)
+		return -EINVAL;
+
+	for (n = 0; n < nb_loops; n++)
+		if (configs[n].output_clip.high < configs[n].output_clip.low)
+			return -EINVAL;
+
+	/* Descriptor, the 64-bit arrays, then the 32-bit arrays. */
+	b = no_os_calloc(1, sizeof(*b) + nb_loops * (3 * sizeof(int64_t) +
+			 8 * sizeof(int32_t)));
+	if (!b)
+		return -ENOMEM;
+
+	b->nb_loops = nb_loops;
+	b->output = (int64_t *)(b + 1);
+	b->o_high = b->output + nb_loops;
+	b->o_low = b->output + 2 * nb_loops;
+	arrays = (int32_t *)(b->output + 3 * nb_loops);
+	b->kp = arrays;
+	b->ki = arrays + nb_loops;
+	b->kd = arrays + 2 * nb_loops;
+	b->iacc = arrays + 3 * nb_loops;
+	b->dacc = arrays + 4 * nb_loops;
+	b->hysteresis = (uint32_t *)(arrays + 5 * nb_loops);
+	b->i_high = arrays + 6 * nb_loops;
+	b->i_low = arrays + 7 * nb_loops;
+
+	for (n = 0; n < nb_loops; n++) {
+		b->output[n] = configs[n].initial;
+		b->kp[n] = no_os_pid_bank_gain(configs[n].Kp);
+		b->ki[n] = no_os_pid_bank_gain(configs[n].Ki);
+		b->kd[n] = no_os_pid_bank_gain(configs[n].Kd);
+		b->hysteresis[n] = configs[n].hysteresis;
+		/* Disabled clipping is a clip to the full range, no branch needed */
+		if (configs[n].i_clip.high > configs[n].i_clip.low) {
+			b->i_high[n] = configs[n].i_clip.high;
+			b->i_low[n] = configs[n].i_clip.low;
+		} else {
+			b->i_high[n] = INT32_MAX;
+			b->i_low[n] = INT32_MIN;
+		}
+		if (configs[n].output_clip.high > configs[n].output_clip.low) {
+			b->o_high[n] = configs[n].output_clip.high;
+			b->o_low[n] = configs[n].output_clip.low;
+		} else {
+			b->o_high[n] = INT64_MAX;
+			b->o_low[n] = INT64_MIN;
+		}
+	}
+
+	*bank = b;
+
+	return 0;
+}
+
+/**
+ * @brief Step the controllers of a bank. All the arrays are restrict
+ * parameters and the loop body has no data dependent branches, so that the
+ * compiler can vectorize the loop on hosts with SIMD units. Kept out of line,
+ * the restrict qualifiers are not honored once inlined in the caller.
+ * @param nb_loops - Number of controllers
+ * @param SP - Set-points
+ * @param PV - Process variables
+ * @param output - Outputs of the PID control
+ * @param out - Output state of the controllers
+ * @param iacc - Integral accumulators
+ * @param dacc - Derivative accumulators
+ * @param kp - Proportional gains
+ * @param ki - Integral gains
+ * @param kd - Derivative gains
+ * @param hysteresis - Hysteresis
+ * @param i_high - Integral accumulator high limits
+ * @param i_low - Integral accumulator low limits
+ * @param o_high - Output high limits
+ * @param o_low - Output low limits
+ */
+static __attribute__((noinline))
+void no_os_pid_bank_step(unsigned int nb_loops,
+			 const int *restrict SP, const int *restrict PV,
+			 int *restrict output, int64_t *restrict out,
+			 int32_t *restrict iacc, int32_t *restrict dacc,
+			 const int32_t *restrict kp,
+			 const int32_t *restrict ki,
+			 const int32_t *restrict kd,
+			 const uint32_t *restrict hysteresis,
+			 const int32_t *restrict i_high,
+			 const int32_t *restrict i_low,
+			 const int64_t *restrict o_high,
+			 const int64_t *restrict o_low)
+{
+	int32_t acc, acc_clip;
+	int32_t prev_err;
+	int64_t o, t;
+	unsigned int n;
+	bool hold;
+	int err;
+
+	for (n = 0; n < nb_loops; n++) {
+		err = SP[n] - PV[n];
+		hold = (unsigned int)abs(err) < hysteresis[n];
+		o = out[n];
+		acc = iacc[n];
+		prev_err = dacc[n];
+
+		acc_clip = no_os_clamp(acc, i_low[n], i_high[n]);
+
+		t = o * (1 << NO_OS_PID_BANK_Q) -
+		    ((int64_t)kp[n] * err + (int64_t)ki[n] * acc_clip +
+		     (int64_t)kd[n] * (prev_err - err));
+		/* Round toward zero, like the division of no_os_pid_control(). */
+		t = (t + ((t >> 63) & ((1 << NO_OS_PID_BANK_Q) - 1))) >>
+		    NO_OS_PID_BANK_Q;
+		t = no_os_clamp(t, o_low[n], o_high[n]);
+
+		/* Within hysteresis the controller state is left untouched. */
+		out[n] = hold ? o : t;
+		iacc[n] = hold ? acc : acc_clip + err;
+		dacc[n] = hold ? prev_err : err;
+		output[n] = hold ? o : t;
+	}
+}
+
+/**
+ * @brief Perform one PID control step on all the controllers of a bank. Each
+ * controller behaves like no_os_pid_control(), including the hysteresis and the
+ * integrator and output clipping.
+ * @param bank - Bank descriptor created with no_os_pid_bank_init()
+ * @param SP - Array of nb_loops set-points
+ * @param PV - Array of nb_loops process variables
+ * @param output - Array of nb_loops outputs of the PID control
+ * @return
+ *  - 0 : On success
+ *  - -EINVAL : Invalid input
+ */
+int no_os_pid_bank_control(struct no_os_pid_bank *bank, const int *SP,
+			   const int *PV, int *output)
+{
+	if (!bank || !SP || !PV || !output)
+		return -EINVAL;
+
+	no_os_pid_bank_step(bank->nb_loops, SP, PV, output, bank->output,
+			    bank->iacc, bank->dacc, bank->kp, bank->ki, bank->kd,
+			    bank->hysteresis, bank->i_high, bank->i_low,
+			    bank->o_high, bank->o_low);
+
+	return 0;
+}
+
+/**
+ * @brief Change the hysteresis of one controller of a bank.
+ * @param bank - Bank descriptor created with no_os_pid_bank_init()
+ * @param loop - Index of the controller
+ * @param hyst - The new hysteresis value
+ * @return
+ *  - 0 : On success
+ *  - -EINVAL : Invalid input
+ */
+int no_os_pid_bank_hysteresis(struct no_os_pid_bank *bank, unsigned int loop,
+			      unsigned int hyst)
+{
+	if (!bank || loop >= bank->nb_loops)
+		return -EINVAL;
+
+	bank->hysteresis[loop] = hyst;
+
+	return 0;
+}
+
+/**
+ * @brief Reset the accumulators of all the controllers of a bank.
+ * @param bank - Bank descriptor created with no_os_pid_bank_init()
+ * @return
+ *  - 0 : On success
+ *  - -EINVAL : Invalid input
+ */
+int no_os_pid_bank_reset(struct no_os_pid_bank *bank)
+{
+	if (!bank)
+		return -EINVAL;
+
+	memset(bank->iacc, 0, bank->nb_loops * sizeof(*bank->iacc));
+	memset(bank->dacc, 0, bank->nb_loops * sizeof(*bank->dacc));
+
+	return 0;
+}
+
+/**
+ * @brief Free the memory allocated by no_os_pid_bank_init().
+ * @param bank - Bank descriptor created with no_os_pid_bank_init()
+ * @return
+ *  - 0 : On success
+ *  - -EINVAL : Invalid input
+ */
+int no_os_pid_bank_remove(struct no_os_pid_bank *bank)
+{
+	if (!bank)
+		return -EINVAL;
+
+	no_os_free(bank);
+
+	return 0;
+}
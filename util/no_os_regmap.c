@@ -0,0 +1,502 @@
+/***************************************************************************//**
+ *   @file   no_os_regmap.c
+ *   @brief  Implementation of the cached register map library.
+********************************************************************************
+ * Copyright 2026(c) Analog Devices, Inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Analog Devices, Inc. nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ANALOG DEVICES, INC. “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL ANALOG DEVICES, INC. BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+
+#include <stdbool.h>
+#include "no_os_regmap.h"
+#include "no_os_error.h"
+#include "no_os_util.h"
+#include "no_os_alloc.h"
+
+/**
+ * @brief Check if a register value can be served from the cache.
+ * @param map - The register map.
+ * @param reg - Register index.
+ * @return true if the cached value is valid.
+ */
+static bool no_os_regmap_cached(struct no_os_regmap *map, uint32_t reg)
+{
+	if (map->cache_type == NO_OS_REGMAP_CACHE_NONE)
+		return false;
+
+	return (map->flags[reg] & (NO_OS_REGMAP_F_VALID |
+				   NO_OS_REGMAP_F_VOLATILE)) == NO_OS_REGMAP_F_VALID;
+}
+
+/**
+ * @brief Store a value in the cache of a non-volatile register.
+ * @param map   - The register map.
+ * @param reg   - Register index.
+ * @param val   - Register value.
+ * @param dirty - Set if the value still has to be written to the device.
+ */
+static void no_os_regmap_cache_store(struct no_os_regmap *map, uint32_t reg,
+				     uint32_t val, bool dirty)
+{
+	if (map->cache_type == NO_OS_REGMAP_CACHE_NONE ||
+	    (map->flags[reg] & NO_OS_REGMAP_F_VOLATILE))
+		return;
+
+	map->cache[reg] = val;
+	map->flags[reg] |= NO_OS_REGMAP_F_VALID;
+
+	if (dirty && !(map->flags[reg] & NO_OS_REGMAP_F_DIRTY)) {
+		map->flags[reg] |= NO_OS_REGMAP_F_DIRTY;
+		map->nb_dirty++;
+	} else if (!dirty && (map->flags[reg] & NO_OS_REGMAP_F_DIRTY)) {
+		map->flags[reg] &= ~NO_OS_REGMAP_F_DIRTY;
+		map->nb_dirty--;
+	}
+}
+
+/**
+ * @brief Write consecutive registers to the device, splitting them in bulk
+ * writes of at most max_burst registers when the bus supports it.
+ * @param map  - The register map.
+ * @param reg  - First register index.
+ * @param vals - Register values.
+ * @param nb   - Number of registers.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+static int no_os_regmap_bus_write(struct no_os_regmap *map, uint32_t reg,
+				  const uint32_t *vals, uint32_t nb)
+{
+	uint32_t len;
+	uint32_t i;
+	int ret;
+
+	while (nb) {
+		len = nb;
+		if (map->max_burst && len > map->max_burst)
+			len = map->max_burst;
+
+		if (len > 1 && map->bus->bulk_write) {
+			ret = map->bus->bulk_write(map->ctx, reg, vals, len);
+			if (ret)
+				return ret;
+			map->stats.bursts++;
+		} else {
+			len = 1;
+			ret = map->bus->reg_write(map->ctx, reg, vals[0]);
+			if (ret)
+				return ret;
+			map->stats.bus_writes++;
+		}
+
+		for (i = 0; i < len; i++)
+			no_os_regmap_cache_store(map, reg + i, vals[i], false);
+
+		reg += len;
+		vals += len;
+		nb -= len;
+	}
+
+	return 0;
+}
+
+/**
+ * @brief Allocate a register map.
+ * @param map   - The register map.
+ * @param param - Initialization parameters.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+int no_os_regmap_init(struct no_os_regmap **map,
+		      const struct no_os_regmap_init_param *param)
+{
+	struct no_os_regmap *desc;
+	uint32_t i;
+
+	if (!map || !param || !param->bus || !param->bus->reg_read ||
+	    !param->bus->reg_write || !param->nb_regs)
+		return -EINVAL;
+
+	desc = no_os_calloc(1, sizeof(*desc));
+	if (!desc)
+		return -ENOMEM;
+
+	desc->cache = no_os_calloc(param->nb_regs, sizeof(*desc->cache));
+	if (!desc->cache)
+		goto error;
+
+	desc->flags = no_os_calloc(param->nb_regs, sizeof(*desc->flags));
+	if (!desc->flags)
+		goto error;
+
+	desc->bus = param->bus;
+	desc->ctx = param->ctx;
+	desc->nb_regs = param->nb_regs;
+	desc->cache_type = param->cache_type;
+	desc->max_burst = param->max_burst;
+
+	if (param->volatile_reg)
+		for (i = 0; i < desc->nb_regs; i++)
+			if (param->volatile_reg(desc->ctx, i))
+				desc->flags[i] = NO_OS_REGMAP_F_VOLATILE;
+
+	*map = desc;
+
+	return 0;
+
+error:
+	no_os_free(desc->cache);
+	no_os_free(desc);
+
+	return -ENOMEM;
+}
+
+/**
+ * @brief Free the resources allocated by no_os_regmap_init(). Registers which
+ * were not written back yet are lost.
+ * @param map - The register map.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+int no_os_regmap_remove(struct no_os_regmap *map)
+{
+	if (!map)
+		return -EINVAL;
+
+	no_os_free(map->flags);
+	no_os_free(map->cache);
+	no_os_free(map);
+
+	return 0;
+}
+
+/**
+ * @brief Read a register. Non-volatile registers are read from the device only
+ * once, further reads are served from the cache.
+ * @param map - The register map.
+ * @param reg - Register index.
+ * @param val - The register value.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+int no_os_regmap_read(struct no_os_regmap *map, uint32_t reg, uint32_t *val)
+{
+	int ret;
+
+	if (!map || !val || reg >= map->nb_regs)
+		return -EINVAL;
+
+	if (no_os_regmap_cached(map, reg)) {
+		*val = map->cache[reg];
+		map->stats.cache_hits++;
+		return 0;
+	}
+
+	ret = map->bus->reg_read(map->ctx, reg, val);
+	if (ret)
+		return ret;
+
+	map->stats.bus_reads++;
+	no_os_regmap_cache_store(map, reg, *val, false);
+
+	return 0;
+}
+
+/**
+ * @brief Write a register. In write-back mode non-volatile registers are only
+ * written to the cache, until no_os_regmap_sync() is called.
+ * @param map - The register map.
+ * @param reg - Register index.
+ * @param val - The register value.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+int no_os_regmap_write(struct no_os_regmap *map, uint32_t reg, uint32_t val)
+{
+	return no_os_regmap_bulk_write(map, reg, &val, 1);
+}
+
+/**
+ * @brief Read nb consecutive registers.
+ * @param map  - The register map.
+ * @param reg  - First register index.
+ * @param vals - The register values.
+ * @param nb   - Number of registers.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+int no_os_regmap_bulk_read(struct no_os_regmap *map, uint32_t reg,
+			   uint32_t *vals, uint32_t nb)
+{
+	uint32_t i;
+	int ret;
+
+	if (!map || !vals || reg >= map->nb_regs || nb > map->nb_regs - reg)
+		return -EINVAL;
+
+	for (i = 0; i < nb; i++) {
+		ret = no_os_regmap_read(map, reg + i, &vals[i]);
+		if (ret)
+			return ret;
+	}
+
+	return 0;
+}
+
+/**
+ * @brief Write nb consecutive registers. Without a write-back cache, they are
+ * sent to the device in as few bulk writes as the bus allows.
+ * @param map  - The register map.
+ * @param reg  - First register index.
+ * @param vals - The register values.
+ * @param nb   - Number of registers.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+int no_os_regmap_bulk_write(struct no_os_regmap *map, uint32_t reg,
+			    const uint32_t *vals, uint32_t nb)
+{
+	uint32_t i;
+
+	if (!map || !vals || reg >= map->nb_regs || nb > map->nb_regs - reg)
+		return -EINVAL;
+
+	if (map->cache_type != NO_OS_REGMAP_CACHE_WRITE_BACK)
+		return no_os_regmap_bus_write(map, reg, vals, nb);
+
+	/* Volatile registers still have to reach the device right away. */
+	for (i = 0; i < nb; i++) {
+		if (map->flags[reg + i] & NO_OS_REGMAP_F_VOLATILE) {
+			int ret = no_os_regmap_bus_write(map, reg + i,
+							 &vals[i], 1);
+			if (ret)
+				return ret;
+		} else {
+			no_os_regmap_cache_store(map, reg + i, vals[i], true);
+		}
+	}
+
+	return 0;
+}
+
+/**
+ * @brief Update the bits of a register selected by mask. The write is skipped
+ * when the register is cached and already holds the requested value.
+ * @param map  - The register map.
+ * @param reg  - Register index.
+ * @param mask - Bits to update.
+ * @param val  - New value of the bits, already shifted in place.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+int no_os_regmap_update_bits(struct no_os_regmap *map, uint32_t reg,
+			     uint32_t mask, uint32_t val)
+{
+	uint32_t old;
+	uint32_t new;
+	int ret;
+
+	ret = no_os_regmap_read(map, reg, &old);
+	if (ret)
+		return ret;
+
+	new = (old & ~mask) | (val & mask);
+	if (new == old && no_os_regmap_cached(map, reg)) {
+		map->stats.writes_skipped++;
+		return 0;
+	}
+
+	return no_os_regmap_write(map, reg, new);
+}
+
+/**
+ * @brief Read the field of a register selected by mask.
+ * @param map  - The register map.
+ * @param reg  - Register index.
+ * @param mask - Field mask.
+ * @param val  - The field value, shifted down to bit 0.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+int no_os_regmap_field_read(struct no_os_regmap *map, uint32_t reg,
+			    uint32_t mask, uint32_t *val)
+{
+	uint32_t reg_val;
+	int ret;
+
+	if (!val)
+		return -EINVAL;
+
+	ret = no_os_regmap_read(map, reg, &reg_val);
+	if (ret)
+		return ret;
+
+	*val = no_os_field_get(mask, reg_val);
+
+	return 0;
+}
+
+/**
+ * @brief Write the field of a register selected by mask.
+ * @param map  - The register map.
+ * @param reg  - Register index.
+ * @param mask - Field mask.
+ * @param val  - The field value, starting from bit 0.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+int no_os_regmap_field_write(struct no_os_regmap *map, uint32_t reg,
+			     uint32_t mask, uint32_t val)
+{
+	if (val > no_os_field_get(mask, mask))
+		return -EINVAL;
+
+	return no_os_regmap_update_bits(map, reg, mask,
+					no_os_field_prep(mask, val));
+}
+
+/**
+ * @brief Write all dirty registers to the device. Each run of consecutive
+ * dirty registers is sent as bulk writes of at most max_burst registers.
+ * @param map - The register map.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+int no_os_regmap_sync(struct no_os_regmap *map)
+{
+	uint32_t first;
+	uint32_t reg;
+	int ret;
+
+	if (!map)
+		return -EINVAL;
+
+	reg = 0;
+	while (map->nb_dirty && reg < map->nb_regs) {
+		if (!(map->flags[reg] & NO_OS_REGMAP_F_DIRTY)) {
+			reg++;
+			continue;
+		}
+
+		first = reg;
+		while (reg < map->nb_regs && (map->flags[reg] & NO_OS_REGMAP_F_DIRTY))
+			reg++;
+
+		ret = no_os_regmap_bus_write(map, first, &map->cache[first],
+					     reg - first);
+		if (ret)
+			return ret;
+	}
+
+	return 0;
+}
+
+/**
+ * @brief Change the cache policy. Dirty registers are written to the device
+ * when leaving the write-back mode.
+ * @param map        - The register map.
+ * @param cache_type - New cache policy.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+int no_os_regmap_set_cache_type(struct no_os_regmap *map,
+				enum no_os_regmap_cache_type cache_type)
+{
+	int ret;
+
+	if (!map)
+		return -EINVAL;
+
+	if (cache_type != NO_OS_REGMAP_CACHE_WRITE_BACK) {
+		ret = no_os_regmap_sync(map);
+		if (ret)
+			return ret;
+	}
+
+	if (cache_type == NO_OS_REGMAP_CACHE_NONE)
+		no_os_regmap_cache_invalidate(map, 0, map->nb_regs - 1);
+
+	map->cache_type = cache_type;
+
+	return 0;
+}
+
+/**
+ * @brief Mark registers first .. last as unknown, so they are read again from
+ * the device. Dirty values in this range are discarded.
+ * @param map   - The register map.
+ * @param first - First register index.
+ * @param last  - Last register index.
+ */
+void no_os_regmap_cache_invalidate(struct no_os_regmap *map, uint32_t first,
+				   uint32_t last)
+{
+	uint32_t reg;
+
+	if (!map)
+		return;
+
+	for (reg = first; reg <= last && reg < map->nb_regs; reg++) {
+		if (map->flags[reg] & NO_OS_REGMAP_F_DIRTY)
+			map->nb_dirty--;
+		map->flags[reg] &= NO_OS_REGMAP_F_VOLATILE;
+	}
+}
+
+/**
+ * @brief Mark a register as volatile or cacheable. A dirty register is written
+ * to the device before it becomes volatile.
+ * @param map         - The register map.
+ * @param reg         - Register index.
+ * @param is_volatile - New volatile state.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+int no_os_regmap_set_volatile(struct no_os_regmap *map, uint32_t reg,
+			      bool is_volatile)
+{
+	int ret;
+
+	if (!map || reg >= map->nb_regs)
+		return -EINVAL;
+
+	if (!is_volatile) {
+		map->flags[reg] &= ~NO_OS_REGMAP_F_VOLATILE;
+		return 0;
+	}
+
+	if (map->flags[reg] & NO_OS_REGMAP_F_DIRTY) {
+		ret = no_os_regmap_bus_write(map, reg, &map->cache[reg], 1);
+		if (ret)
+			return ret;
+	}
+
+	map->flags[reg] = NO_OS_REGMAP_F_VOLATILE;
+
+	return 0;
+}
+
+/**
+ * @brief Check if a register bypasses the cache, either because it is volatile
+ * or because it is outside of the register map.
+ * @param map - The register map.
+ * @param reg - Register index.
+ * @return true if every access to the register goes to the device.
+ */
+bool no_os_regmap_is_volatile(struct no_os_regmap *map, uint32_t reg)
+{
+	if (!map || reg >= map->nb_regs)
+		return true;
+
+	return map->flags[reg] & NO_OS_REGMAP_F_VOLATILE;
+}
@@ -0,0 +1,100 @@
+/*******************************************************************************
+ *   @file   util/no_os_thread.c
+ *   @brief  Default implementation of no-OS thread functionality.
+********************************************************************************
+ * Copyright 2026(c) Analog Devices, Inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Analog Devices, Inc. nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ANALOG DEVICES, INC. “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL ANALOG DEVICES, INC. BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+#include "no_os_thread.h"
+#include "no_os_error.h"
+#include "no_os_util.h"
+
+/**
+ * @brief Start a thread. Platforms without threads report -ENOSYS, so callers
+ * can run the function in their own context instead.
+ * @param thread - Pointer toward the thread handle.
+ * @param func - Thread function.
+ * @param arg - Argument of the thread function.
+ * @return -ENOSYS.
+ */
+__no_os_weak__((weak)) int no_os_thread_create(void **thread,
+		void (*func)(void *), void *arg)
+{
+	return -ENOSYS;
+}
+
+/**
+ * @brief Wait for a thread to return.
+ * @param thread - The thread handle.
+ * @return -ENOSYS.
+ */
+__no_os_weak__((weak)) int no_os_thread_join(void *thread)
+{
+	return -ENOSYS;
+}
+
+/**
+ * @brief Create a barrier.
+ * @param barrier - Pointer toward the barrier handle.
+ * @param nb - Number of threads released together.
+ * @return -ENOSYS.
+ */
+__no_os_weak__((weak)) int no_os_barrier_init(void **barrier, unsigned int nb)
+{
+	return -ENOSYS;
+}
+
+/**
+ * @brief Wait on a barrier.
+ * @param barrier - The barrier handle.
+ * @return -ENOSYS.
+ */
+__no_os_weak__((weak)) int no_os_barrier_wait(void *barrier)
+{
+	return -ENOSYS;
+}
+
+/**
+ * @brief Abort a barrier.
+ * @param barrier - The barrier handle.
+ * @return -ENOSYS.
+ */
+__no_os_weak__((weak)) int no_os_barrier_abort(void *barrier)
+{
+	return -ENOSYS;
+}
+
+/**
+ * @brief Free a barrier.
+ * @param barrier - The barrier handle.
+ * @return -ENOSYS.
+ */
+__no_os_weak__((weak)) int no_os_barrier_remove(void *barrier)
+{
+	return -ENOSYS;
+}
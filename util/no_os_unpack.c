@@ -0,0 +1,397 @@
+/***************************************************************************//**
+ *   @file   no_os_unpack.c
+ *   @brief  Implementation of the packed sample unpacking library.
+********************************************************************************
+ * Copyright 2026(c) Analog Devices, Inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Analog Devices, Inc. nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ANALOG DEVICES, INC. “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL ANALOG DEVICES, INC. BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+#include <errno.h>
+#include <string.h>
+#include "no_os_unpack.h"
+
+#if defined(__AVX2__) || defined(__SSSE3__)
+#include <immintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
+/* Samples converted per step by no_os_unpack_s16() */
+#define NO_OS_UNPACK_CHUNK	64
+
+/**
+ * @struct no_os_unpack_ctx
+ * @brief Precomputed conversion of a MSB aligned word into a sample
+ */
+struct no_os_unpack_ctx {
+	/** Bytes per word, 0 for words which are not byte aligned */
+	uint8_t bytes;
+	/** Left shift dropping the bits above the sample */
+	uint8_t lsh;
+	/** Right shift dropping the bits below the sample */
+	uint8_t rsh;
+	/** Arithmetic right shift, used by the SIMD kernels */
+	bool is_signed;
+	/** Mask clearing the sign extension of unsigned samples */
+	uint32_t mask;
+};
+
+/***************************************************************************//**
+ * @brief Validate a stream format and precompute its shifts.
+ *
+ * @param fmt      - Stream format.
+ * @param max_bits - Largest data_bits the output type holds.
+ * @param ctx      - Conversion context to fill.
+ *
+ * @return 0 in case of success, -EINVAL otherwise.
+*******************************************************************************/
+static int no_os_unpack_prepare(const struct no_os_unpack_fmt *fmt,
+				uint8_t max_bits, struct no_os_unpack_ctx *ctx)
+{
+	if (!fmt || !fmt->word_bits || fmt->word_bits > 32 || !fmt->data_bits ||
+	    fmt->data_bits > max_bits ||
+	    fmt->shift + fmt->data_bits > fmt->word_bits)
+		return -EINVAL;
+
+	if (fmt->little_endian && fmt->word_bits % 8)
+		return -EINVAL;
+
+	ctx->bytes = fmt->word_bits % 8 ? 0 : fmt->word_bits / 8;
+	ctx->lsh = fmt->word_bits - fmt->shift - fmt->data_bits;
+	ctx->rsh = 32 - fmt->data_bits;
+	ctx->is_signed = fmt->is_signed;
+	ctx->mask = fmt->is_signed ? 0xFFFFFFFF : 0xFFFFFFFF >> ctx->rsh;
+
+	return 0;
+}
+
+/***************************************************************************//**
+ * @brief Extract the sample from a word shifted so the sample MSB is bit 31.
+ * Bits below the sample are don't care.
+ *
+ * @param w    - Shifted word.
+ * @param rsh  - no_os_unpack_ctx.rsh
+ * @param mask - no_os_unpack_ctx.mask
+ *
+ * @return The sample.
+*******************************************************************************/
+static inline int32_t no_os_unpack_fix(uint32_t w, uint8_t rsh, uint32_t mask)
+{
+	return ((int32_t)w >> rsh) & mask;
+}
+
+/* Byte order helpers, compilers turn these into single (swapped) loads. */
+static inline uint32_t no_os_unpack_be32(const uint8_t *p)
+{
+	return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) |
+	       ((uint32_t)p[2] << 8) | p[3];
+}
+
+static inline uint32_t no_os_unpack_le32(const uint8_t *p)
+{
+	return ((uint32_t)p[3] << 24) | ((uint32_t)p[2] << 16) |
+	       ((uint32_t)p[1] << 8) | p[0];
+}
+
+static inline uint64_t no_os_unpack_be64(const uint8_t *p)
+{
+	return ((uint64_t)no_os_unpack_be32(p) << 32) | no_os_unpack_be32(p + 4);
+}
+
+#if defined(__SSSE3__) || (defined(__ARM_NEON) && defined(__aarch64__))
+/***************************************************************************//**
+ * @brief Build the byte shuffle placing 4 consecutive words MSB aligned in 4
+ * 32-bit lanes. Unused lane bytes select 0x80, which reads as zero.
+ *
+ * @param bytes - Bytes per word, 1 to 4.
+ * @param le    - Little endian words.
+ * @param mask  - Shuffle to fill, 16 bytes.
+*******************************************************************************/
+static void no_os_unpack_shuffle(uint8_t bytes, bool le, uint8_t *mask)
+{
+	uint8_t lane;
+	uint8_t j;
+
+	for (j = 0; j < 16; j++)
+		mask[j] = 0x80;
+
+	for (lane = 0; lane < 4; lane++)
+		for (j = 0; j < bytes; j++)
+			mask[lane * 4 + (le ? 4 - bytes + j : 3 - j)] =
+				lane * bytes + j;
+}
+#endif
+
+/***************************************************************************//**
+ * @brief Unpack byte aligned words first .. nb - 1 with 32-bit loads.
+ *
+ * @param ctx   - Conversion context.
+ * @param le    - Little endian words.
+ * @param src   - Packed words.
+ * @param first - First word to unpack.
+ * @param nb    - Number of words in src.
+ * @param dst   - Samples.
+*******************************************************************************/
+static void no_os_unpack_bytes_scalar(const struct no_os_unpack_ctx *ctx,
+				      bool le, const uint8_t *src, uint32_t first,
+				      uint32_t nb, int32_t *dst)
+{
+	/* Locals, as stores to dst could alias the context for the compiler */
+	uint8_t bytes = ctx->bytes;
+	uint8_t lsh = ctx->lsh;
+	uint8_t rsh = ctx->rsh;
+	uint32_t mask = ctx->mask;
+	uint32_t len = nb * bytes;
+	uint8_t tail[8] = {0};
+	const uint8_t *p;
+	uint32_t i = first;
+
+	/* Little endian words are MSB aligned first. */
+	if (le)
+		lsh += 32 - 8 * bytes;
+
+	/* The bytes loaded past a word are dropped by the shifts. */
+	if (le) {
+		for (; i * bytes + 4 <= len; i++)
+			dst[i] = no_os_unpack_fix(no_os_unpack_le32(src + i * bytes) << lsh,
+						  rsh, mask);
+	} else {
+		for (; i * bytes + 4 <= len; i++)
+			dst[i] = no_os_unpack_fix(no_os_unpack_be32(src + i * bytes) << lsh,
+						  rsh, mask);
+	}
+
+	if (i == nb)
+		return;
+
+	/* The last words are loaded from a zero padded copy. */
+	memcpy(tail, src + i * bytes, len - i * bytes);
+	for (p = tail; i < nb; i++, p += bytes)
+		dst[i] = no_os_unpack_fix((le ? no_os_unpack_le32(p) :
+					   no_os_unpack_be32(p)) << lsh, rsh, mask);
+}
+
+/***************************************************************************//**
+ * @brief Unpack byte aligned words, several words per iteration when SIMD is
+ * available.
+ *
+ * @param ctx - Conversion context.
+ * @param le  - Little endian words.
+ * @param src - Packed words.
+ * @param nb  - Number of words.
+ * @param dst - Samples.
+*******************************************************************************/
+static void no_os_unpack_bytes_s32(const struct no_os_unpack_ctx *ctx, bool le,
+				   const uint8_t *src, uint32_t nb, int32_t *dst)
+{
+	uint32_t i = 0;
+#if defined(__SSSE3__) || (defined(__ARM_NEON) && defined(__aarch64__))
+	uint8_t bytes = ctx->bytes;
+	/* Each step loads 16 bytes per 4 words, which must stay inside src. */
+	uint32_t len = nb * bytes;
+	uint8_t mask[16];
+
+	no_os_unpack_shuffle(bytes, le, mask);
+#endif
+
+#if defined(__AVX2__)
+	__m256i shuf8 = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)
+			mask));
+	__m128i lsh8 = _mm_cvtsi32_si128(ctx->lsh);
+	__m128i rsh8 = _mm_cvtsi32_si128(ctx->rsh);
+	__m256i v8;
+
+	for (; (i + 4) * bytes + 16 <= len; i += 8) {
+		v8 = _mm256_loadu2_m128i((const __m128i *)(src + (i + 4) * bytes),
+					 (const __m128i *)(src + i * bytes));
+		v8 = _mm256_shuffle_epi8(v8, shuf8);
+		v8 = _mm256_sll_epi32(v8, lsh8);
+		if (ctx->is_signed)
+			v8 = _mm256_sra_epi32(v8, rsh8);
+		else
+			v8 = _mm256_srl_epi32(v8, rsh8);
+		_mm256_storeu_si256((__m256i *)(dst + i), v8);
+	}
+#endif
+#if defined(__SSSE3__)
+	__m128i shuf = _mm_loadu_si128((const __m128i *)mask);
+	__m128i lsh = _mm_cvtsi32_si128(ctx->lsh);
+	__m128i rsh = _mm_cvtsi32_si128(ctx->rsh);
+	__m128i v;
+
+	for (; i * bytes + 16 <= len; i += 4) {
+		v = _mm_loadu_si128((const __m128i *)(src + i * bytes));
+		v = _mm_shuffle_epi8(v, shuf);
+		v = _mm_sll_epi32(v, lsh);
+		if (ctx->is_signed)
+			v = _mm_sra_epi32(v, rsh);
+		else
+			v = _mm_srl_epi32(v, rsh);
+		_mm_storeu_si128((__m128i *)(dst + i), v);
+	}
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+	uint8x16_t shuf = vld1q_u8(mask);
+	int32x4_t lsh = vdupq_n_s32(ctx->lsh);
+	int32x4_t rsh = vdupq_n_s32(-(int32_t)ctx->rsh);
+	uint32x4_t v;
+
+	for (; i * bytes + 16 <= len; i += 4) {
+		v = vreinterpretq_u32_u8(vqtbl1q_u8(vld1q_u8(src + i * bytes), shuf));
+		v = vshlq_u32(v, lsh);
+		if (ctx->is_signed)
+			vst1q_s32(dst + i, vshlq_s32(vreinterpretq_s32_u32(v), rsh));
+		else
+			vst1q_s32(dst + i, vreinterpretq_s32_u32(vshlq_u32(v, rsh)));
+	}
+#endif
+
+	no_os_unpack_bytes_scalar(ctx, le, src, i, nb, dst);
+}
+
+/***************************************************************************//**
+ * @brief Unpack words which are not byte aligned, MSB first.
+ *
+ * @param ctx  - Conversion context.
+ * @param bits - Packed word size in bits.
+ * @param src  - Packed words.
+ * @param nb   - Number of words.
+ * @param dst  - Samples.
+*******************************************************************************/
+static void no_os_unpack_bits_s32(const struct no_os_unpack_ctx *ctx,
+				  uint8_t bits, const uint8_t *src, uint32_t nb,
+				  int32_t *dst)
+{
+	uint8_t lsh = ctx->lsh;
+	uint8_t rsh = ctx->rsh;
+	uint32_t mask = ctx->mask;
+	uint32_t len = ((uint64_t)nb * bits + 7) / 8;
+	uint8_t tail[16] = {0};
+	uint32_t bitpos = 0;
+	uint32_t i = 0;
+	uint32_t base;
+
+	/*
+	 * A load at the byte holding the first bit of a word holds all of it, in
+	 * 7 + bits bits. 32-bit loads are enough up to 25-bit words.
+	 */
+	if (bits <= 25) {
+		for (; (bitpos >> 3) + 4 <= len; i++, bitpos += bits)
+			dst[i] = no_os_unpack_fix(no_os_unpack_be32(src + (bitpos >> 3)) <<
+						  ((bitpos & 7) + lsh), rsh, mask);
+	} else {
+		for (; (bitpos >> 3) + 8 <= len; i++, bitpos += bits)
+			dst[i] = no_os_unpack_fix((no_os_unpack_be64(src + (bitpos >> 3)) <<
+						   ((bitpos & 7) + lsh)) >> 32, rsh, mask);
+	}
+
+	if (i == nb)
+		return;
+
+	/* The last words are loaded from a zero padded copy. */
+	base = bitpos >> 3;
+	memcpy(tail, src + base, len - base);
+	for (; i < nb; i++, bitpos += bits)
+		dst[i] = no_os_unpack_fix((no_os_unpack_be64(tail + (bitpos >> 3) - base) <<
+					   ((bitpos & 7) + lsh)) >> 32, rsh, mask);
+}
+
+/***************************************************************************//**
+ * @brief Unpack a packed sample stream into 32-bit samples.
+ *
+ * src and dst may be the same buffer for 32-bit words.
+ *
+ * @param fmt        - Stream format.
+ * @param src        - Packed words, (nb_samples * word_bits + 7) / 8 bytes.
+ * @param nb_samples - Number of samples.
+ * @param dst        - Samples.
+ *
+ * @return 0 in case of success, -EINVAL otherwise.
+*******************************************************************************/
+int no_os_unpack_s32(const struct no_os_unpack_fmt *fmt, const uint8_t *src,
+		     uint32_t nb_samples, int32_t *dst)
+{
+	struct no_os_unpack_ctx ctx;
+	int ret;
+
+	if (!src || !dst)
+		return -EINVAL;
+
+	ret = no_os_unpack_prepare(fmt, 32, &ctx);
+	if (ret)
+		return ret;
+
+	if (ctx.bytes)
+		no_os_unpack_bytes_s32(&ctx, fmt->little_endian, src, nb_samples,
+				       dst);
+	else
+		no_os_unpack_bits_s32(&ctx, fmt->word_bits, src, nb_samples, dst);
+
+	return 0;
+}
+
+/***************************************************************************//**
+ * @brief Unpack a packed sample stream into 16-bit samples.
+ *
+ * src and dst may be the same buffer for 16-bit words.
+ *
+ * @param fmt        - Stream format, data_bits at most 16.
+ * @param src        - Packed words, (nb_samples * word_bits + 7) / 8 bytes.
+ * @param nb_samples - Number of samples.
+ * @param dst        - Samples.
+ *
+ * @return 0 in case of success, -EINVAL otherwise.
+*******************************************************************************/
+int no_os_unpack_s16(const struct no_os_unpack_fmt *fmt, const uint8_t *src,
+		     uint32_t nb_samples, int16_t *dst)
+{
+	int32_t buf[NO_OS_UNPACK_CHUNK];
+	uint32_t chunk;
+	uint32_t i;
+	int ret;
+
+	if (!fmt || fmt->data_bits > 16)
+		return -EINVAL;
+
+	while (nb_samples) {
+		chunk = nb_samples < NO_OS_UNPACK_CHUNK ? nb_samples :
+			NO_OS_UNPACK_CHUNK;
+
+		ret = no_os_unpack_s32(fmt, src, chunk, buf);
+		if (ret)
+			return ret;
+
+		for (i = 0; i < chunk; i++)
+			dst[i] = buf[i];
+
+		/* Chunks are a multiple of 8 words, so they end on a byte. */
+		src += chunk * fmt->word_bits / 8;
+		dst += chunk;
+		nb_samples -= chunk;
+	}
+
+	return 0;
+}